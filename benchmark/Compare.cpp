@@ -0,0 +1,130 @@
+///
+/// \file 				Compare.cpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				Compares two CSV files written by the benchmark program, to catch performance regressions.
+/// \details
+///		Benchmarks are matched by op, type, Q-format and variant, and the median ns/op of each is compared.
+///		Exits with 1 if any benchmark is slower than the baseline by more than the allowed percentage.
+///		See README.rst in root dir for more info.
+
+// System includes
+#include <fstream>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+/// \brief      Splits one CSV line into fields, handling quoted fields (as written by the harness).
+static std::vector<std::string> SplitCsvLine(const std::string& line) {
+    std::vector<std::string> fields(1);
+    bool inQuotes = false;
+    for(size_t i = 0; i < line.size(); i++) {
+        const char c = line[i];
+        if(inQuotes) {
+            if(c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                fields.back() += '"';
+                i++;
+            } else if(c == '"') {
+                inQuotes = false;
+            } else {
+                fields.back() += c;
+            }
+        } else if(c == '"') {
+            inQuotes = true;
+        } else if(c == ',') {
+            fields.push_back(std::string());
+        } else if(c != '\r') {
+            fields.back() += c;
+        }
+    }
+    return fields;
+}
+
+/// \brief      Reads the median ns/op of every benchmark in a results file, keyed by "op|type|q_format|variant".
+/// \returns    False if the file could not be read or is missing a required column.
+static bool ReadResults(const std::string& path, std::map<std::string, double>& results) {
+    std::ifstream file(path.c_str());
+    std::string line;
+    if(!file || !std::getline(file, line)) {
+        fprintf(stderr, "Could not read \"%s\".\n", path.c_str());
+        return false;
+    }
+
+    const char* columnNames[] = { "op", "type", "q_format", "variant", "ns_per_op" };
+    size_t columns[5];
+    const std::vector<std::string> header = SplitCsvLine(line);
+    for(size_t c = 0; c < 5; c++) {
+        columns[c] = header.size();
+        for(size_t i = 0; i < header.size(); i++) {
+            if(header[i] == columnNames[c])
+                columns[c] = i;
+        }
+        if(columns[c] == header.size()) {
+            fprintf(stderr, "\"%s\" has no \"%s\" column.\n", path.c_str(), columnNames[c]);
+            return false;
+        }
+    }
+
+    while(std::getline(file, line)) {
+        const std::vector<std::string> fields = SplitCsvLine(line);
+        if(fields.size() < header.size())
+            continue;
+        const std::string key = fields[columns[0]] + "|" + fields[columns[1]] + "|" + fields[columns[2]] + "|" +
+                                fields[columns[3]];
+        results[key] = atof(fields[columns[4]].c_str());
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> paths;
+    double maxSlowdownPercent = 10.0;
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--max-slowdown" && i + 1 < argc)
+            maxSlowdownPercent = atof(argv[++i]);
+        else
+            paths.push_back(arg);
+    }
+    if(paths.size() != 2) {
+        printf("Usage: %s <baseline.csv> <current.csv> [--max-slowdown <percent>]\n", argv[0]);
+        return 2;
+    }
+
+    std::map<std::string, double> baseline;
+    std::map<std::string, double> current;
+    if(!ReadResults(paths[0], baseline) || !ReadResults(paths[1], current))
+        return 2;
+
+    unsigned numRegressions = 0;
+    unsigned numCompared = 0;
+    printf("%-60s %12s %12s %9s\n", "op|type|q_format|variant", "baseline ns", "current ns", "change");
+    for(std::map<std::string, double>::const_iterator it = current.begin(); it != current.end(); ++it) {
+        std::map<std::string, double>::const_iterator base = baseline.find(it->first);
+        if(base == baseline.end()) {
+            printf("%-60s %12s %12.3f %9s\n", it->first.c_str(), "-", it->second, "new");
+            continue;
+        }
+        if(base->second <= 0.0)
+            continue;
+        const double changePercent = (it->second / base->second - 1.0) * 100.0;
+        const bool isRegression = changePercent > maxSlowdownPercent;
+        printf("%-60s %12.3f %12.3f %+8.1f%%%s\n", it->first.c_str(), base->second, it->second, changePercent,
+               isRegression ? "  REGRESSION" : "");
+        numCompared++;
+        if(isRegression)
+            numRegressions++;
+    }
+    for(std::map<std::string, double>::const_iterator it = baseline.begin(); it != baseline.end(); ++it) {
+        if(current.find(it->first) == current.end())
+            printf("%-60s %12.3f %12s %9s\n", it->first.c_str(), it->second, "-", "missing");
+    }
+
+    printf("\n%u of %u benchmarks are more than %.1f%% slower than the baseline.\n", numRegressions, numCompared,
+           maxSlowdownPercent);
+    return numRegressions == 0 ? 0 : 1;
+}
@@ -0,0 +1,532 @@
+///
+/// \file 				Harness.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				Micro-benchmark harness used by the benchmark program.
+/// \details
+///		Each benchmark is warmed up, its iteration count is calibrated so that one sample takes at least a
+///		minimum time, and then many samples are taken. The median, p99, mean and standard deviation of the
+///		time per operation are reported, along with TSC ticks per operation on x86 and, optionally, hardware
+///		performance counters (core cycles, instructions, IPC, branch misses and L1D misses per operation).
+///		Results can be written to JSON and CSV files.
+///		See README.rst in root dir for more info.
+
+#ifndef MN_MFIXEDPOINT_BENCHMARK_HARNESS_H
+#define MN_MFIXEDPOINT_BENCHMARK_HARNESS_H
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// User includes
+#include "PerfCounters.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define MN_BENCHMARK_HAS_TSC 1
+#else
+    #define MN_BENCHMARK_HAS_TSC 0
+#endif
+
+#ifndef MN_BENCHMARK_COMPILE_FLAGS
+    /// \brief      The compiler flags the benchmark was built with, set by CMake.
+    #define MN_BENCHMARK_COMPILE_FLAGS "unknown"
+#endif
+
+namespace mn {
+namespace MFixedPoint {
+namespace benchmark {
+
+//===============================================================================================//
+//===================================== OPTIMISATION BARRIERS ===================================//
+//===============================================================================================//
+
+namespace detail {
+
+    /// \brief      How DoNotOptimize() passes a value to the empty asm statement.
+    enum class BarrierKind { Memory, Register, VectorRegister };
+
+    template <class T>
+    struct BarrierKindOf {
+        static constexpr BarrierKind value =
+#if defined(__x86_64__) || defined(__i386__)
+                std::is_floating_point<T>::value && sizeof(T) <= sizeof(double) ? BarrierKind::VectorRegister :
+#endif
+                !std::is_floating_point<T>::value && std::is_trivially_copyable<T>::value &&
+                sizeof(T) <= sizeof(void*) ? BarrierKind::Register : BarrierKind::Memory;
+    };
+
+    template <BarrierKind kind>
+    using BarrierTag = std::integral_constant<BarrierKind, kind>;
+
+#if defined(__GNUC__)
+    template <class T>
+    inline void Barrier(T& value, BarrierTag<BarrierKind::Register>) {
+        asm volatile("" : "+r"(value) : : "memory");
+    }
+
+    template <class T>
+    inline void Barrier(T& value, BarrierTag<BarrierKind::VectorRegister>) {
+        asm volatile("" : "+x"(value) : : "memory");
+    }
+
+    template <class T>
+    inline void Barrier(T& value, BarrierTag<BarrierKind::Memory>) {
+        asm volatile("" : "+m"(value) : : "memory");
+    }
+#else
+    template <class T, class Tag>
+    inline void Barrier(T& value, Tag) {
+        volatile char sink = *reinterpret_cast<volatile char*>(&value);
+        (void)sink;
+    }
+#endif
+
+} // namespace detail
+
+/// \brief      Forces value to be materialised (in a register if it fits in one, otherwise in memory), and
+///             makes the compiler assume it has been read and modified, so computations that produce it can
+///             not be hoisted out of a loop or deleted.
+template <class T>
+inline void DoNotOptimize(T& value) {
+    detail::Barrier(value, detail::BarrierTag<detail::BarrierKindOf<T>::value>());
+}
+
+/// \brief      Makes the compiler assume all memory has been read and written, so pending stores (e.g. to an
+///             output array) can not be deleted.
+inline void ClobberMemory() {
+#if defined(__GNUC__)
+    asm volatile("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+//===============================================================================================//
+//============================================ CLOCK ============================================//
+//===============================================================================================//
+
+/// \brief      Monotonic wall clock in nanoseconds (std::chrono::steady_clock).
+inline int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// \brief      The CPU timestamp counter, or 0 if the platform does not have one.
+/// \details    On modern x86 CPUs the TSC ticks at a constant (nominal) frequency, so it measures reference
+///             cycles rather than core cycles when the CPU is boosting or throttling.
+inline uint64_t NowTicks() {
+#if MN_BENCHMARK_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+//===============================================================================================//
+//========================================= ENVIRONMENT =========================================//
+//===============================================================================================//
+
+/// \brief      Name and version of the compiler the benchmark was built with.
+inline std::string CompilerName() {
+#if defined(__clang__)
+    return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+/// \brief      The CPU model name from /proc/cpuinfo, or "unknown" on platforms without it.
+inline std::string CpuModelName() {
+    std::ifstream cpuInfo("/proc/cpuinfo");
+    std::string line;
+    while(std::getline(cpuInfo, line)) {
+        if(line.compare(0, 10, "model name") == 0) {
+            std::string::size_type colon = line.find(':');
+            if(colon != std::string::npos && colon + 2 <= line.size())
+                return line.substr(colon + 2);
+        }
+    }
+    return "unknown";
+}
+
+/// \brief      Returns the Q-format (Qm.n, m excluding the sign bit) of a signed numBits wide number with
+///             numFracBits fractional bits.
+inline std::string QFormat(int numBits, int numFracBits) {
+    return "Q" + std::to_string(numBits - 1 - numFracBits) + "." + std::to_string(numFracBits);
+}
+
+//===============================================================================================//
+//========================================== HARNESS ============================================//
+//===============================================================================================//
+
+/// \brief      Command line configurable settings of the harness.
+struct Options {
+    /// \brief      Only benchmarks whose "op/type/variant" name contains this string are run.
+    std::string filter;
+
+    /// \brief      The number of samples taken for each benchmark.
+    unsigned repetitions = 25;
+
+    /// \brief      The iteration count is calibrated so that each sample takes at least this long.
+    double minSampleMs = 1.0;
+
+    /// \brief      Count core cycles, instructions, branch misses and L1D misses with perf_event_open().
+    bool perfCounters = false;
+
+    std::string jsonPath;
+    std::string csvPath;
+};
+
+/// \brief      The statistics of one benchmark. All times are per operation.
+struct Result {
+    std::string op;
+    std::string type;
+    std::string qFormat;
+    std::string variant;
+    double nsPerOp;         ///< Median.
+    double p99NsPerOp;
+    double meanNsPerOp;
+    double stdDevNsPerOp;
+    double cyclesPerOp;     ///< Median TSC ticks, -1 if there is no TSC.
+
+    // Averages over all samples from the hardware performance counters, -1 if not measured
+    double coreCyclesPerOp;
+    double instructionsPerOp;
+    double ipc;
+    double branchMissesPerOp;
+    double l1dMissesPerOp;
+
+    unsigned repetitions;
+    uint64_t opsPerSample;
+};
+
+/// \brief      Runs benchmarks and collects their results.
+class Harness {
+
+public:
+
+    explicit Harness(const Options& options) :
+            options_(options),
+            compiler_(CompilerName()),
+            cpu_(CpuModelName()),
+            usePerf_(false) {
+        if(options_.perfCounters) {
+            usePerf_ = perf_.Open();
+            if(!usePerf_)
+                fprintf(stderr, "Hardware performance counters disabled, %s.\n", perf_.GetError().c_str());
+        }
+    }
+
+    /// \brief      Benchmarks fn, which is called as fn(iterations) and must perform iterations*opsPerIteration
+    ///             operations.
+    template <class Fn>
+    void Run(const std::string& op, const std::string& type, const std::string& qFormat,
+             const std::string& variant, uint64_t opsPerIteration, Fn fn) {
+        const std::string name = op + "/" + type + "/" + variant;
+        if(!options_.filter.empty() && name.find(options_.filter) == std::string::npos)
+            return;
+
+        // Warm up (caches, branch predictors, CPU frequency), then double the iteration count until one
+        // sample is long enough for the clock resolution to not matter
+        const int64_t minSampleNs = (int64_t)(options_.minSampleMs * 1e6);
+        uint64_t iterations = 1;
+        fn(iterations);
+        for(;;) {
+            const int64_t start = NowNs();
+            fn(iterations);
+            const int64_t elapsed = NowNs() - start;
+            if(elapsed >= minSampleNs)
+                break;
+            // Jump most of the way there once the sample is long enough to measure reliably
+            if(elapsed > minSampleNs / 16)
+                iterations = (uint64_t)((double)iterations * 1.2 * (double)minSampleNs / (double)elapsed) + 1;
+            else
+                iterations *= 2;
+        }
+
+        const double opsPerSample = (double)(iterations * opsPerIteration);
+        std::vector<double> nsPerOp(options_.repetitions);
+        std::vector<double> ticksPerOp(options_.repetitions);
+        uint64_t perfTotals[numPerfEvents] = { 0 };
+        for(unsigned i = 0; i < options_.repetitions; i++) {
+            if(usePerf_)
+                perf_.Start();
+            const uint64_t startTicks = NowTicks();
+            const int64_t start = NowNs();
+            fn(iterations);
+            const int64_t elapsed = NowNs() - start;
+            const uint64_t elapsedTicks = NowTicks() - startTicks;
+            if(usePerf_) {
+                perf_.Stop();
+                for(unsigned e = 0; e < numPerfEvents; e++)
+                    perfTotals[e] += perf_.GetCount((PerfEvent)e);
+            }
+            nsPerOp[i] = (double)elapsed / opsPerSample;
+            ticksPerOp[i] = (double)elapsedTicks / opsPerSample;
+        }
+
+        Result result;
+        result.op = op;
+        result.type = type;
+        result.qFormat = qFormat;
+        result.variant = variant;
+        result.meanNsPerOp = Mean(nsPerOp);
+        result.stdDevNsPerOp = StdDev(nsPerOp, result.meanNsPerOp);
+        result.nsPerOp = Percentile(nsPerOp, 50.0);
+        result.p99NsPerOp = Percentile(nsPerOp, 99.0);
+        result.cyclesPerOp = MN_BENCHMARK_HAS_TSC ? Percentile(ticksPerOp, 50.0) : -1.0;
+        const double totalOps = opsPerSample * (double)options_.repetitions;
+        result.coreCyclesPerOp = PerfPerOp(PerfEvent::Cycles, perfTotals, totalOps);
+        result.instructionsPerOp = PerfPerOp(PerfEvent::Instructions, perfTotals, totalOps);
+        result.branchMissesPerOp = PerfPerOp(PerfEvent::BranchMisses, perfTotals, totalOps);
+        result.l1dMissesPerOp = PerfPerOp(PerfEvent::L1dMisses, perfTotals, totalOps);
+        result.ipc = result.coreCyclesPerOp > 0.0 && result.instructionsPerOp >= 0.0 ?
+                result.instructionsPerOp / result.coreCyclesPerOp : -1.0;
+        result.repetitions = options_.repetitions;
+        result.opsPerSample = iterations * opsPerIteration;
+        results_.push_back(result);
+
+        printf("%-28s %-12s %-8s %-11s %10.3f %10.3f %8.3f %9.2f",
+               op.c_str(), type.c_str(), qFormat.c_str(), variant.c_str(),
+               result.nsPerOp, result.p99NsPerOp, result.stdDevNsPerOp, result.cyclesPerOp);
+        if(usePerf_)
+            printf(" %11.2f %9.2f %6.2f %10.4f %11.4f", result.coreCyclesPerOp, result.instructionsPerOp, result.ipc,
+                   result.branchMissesPerOp, result.l1dMissesPerOp);
+        printf("\n");
+        fflush(stdout);
+    }
+
+    /// \brief      Prints the environment and the column headings of the results table.
+    void PrintHeader() const {
+        printf("compiler: %s\nflags: %s\ncpu: %s\nrepetitions: %u, min. sample time: %.2fms\n\n",
+               compiler_.c_str(), MN_BENCHMARK_COMPILE_FLAGS, cpu_.c_str(), options_.repetitions,
+               options_.minSampleMs);
+        printf("%-28s %-12s %-8s %-11s %10s %10s %8s %9s",
+               "op", "type", "q_format", "variant", "ns/op", "p99 ns/op", "stddev", "cycles/op");
+        if(usePerf_)
+            printf(" %11s %9s %6s %10s %11s", "core cyc/op", "instr/op", "IPC", "br-miss/op", "L1D-miss/op");
+        printf("\n");
+    }
+
+    const std::vector<Result>& GetResults() const {
+        return results_;
+    }
+
+    /// \brief      Writes the results to a CSV file (one row per benchmark, with a header row).
+    /// \returns    False if the file could not be written.
+    bool WriteCsv(const std::string& path) const {
+        std::ofstream file(path.c_str());
+        if(!file)
+            return false;
+        file << "op,type,q_format,variant,ns_per_op,p99_ns_per_op,mean_ns_per_op,stddev_ns_per_op,"
+                "cycles_per_op,core_cycles_per_op,instructions_per_op,ipc,branch_misses_per_op,l1d_misses_per_op,"
+                "repetitions,ops_per_sample,compiler,flags,cpu\n";
+        for(const Result& r : results_) {
+            file << CsvField(r.op) << ',' << CsvField(r.type) << ',' << CsvField(r.qFormat) << ','
+                 << CsvField(r.variant) << ',' << Number(r.nsPerOp) << ',' << Number(r.p99NsPerOp) << ','
+                 << Number(r.meanNsPerOp) << ',' << Number(r.stdDevNsPerOp) << ',' << Number(r.cyclesPerOp)
+                 << ',' << Number(r.coreCyclesPerOp) << ',' << Number(r.instructionsPerOp) << ',' << Number(r.ipc)
+                 << ',' << Number(r.branchMissesPerOp) << ',' << Number(r.l1dMissesPerOp)
+                 << ',' << r.repetitions << ',' << r.opsPerSample << ',' << CsvField(compiler_) << ','
+                 << CsvField(MN_BENCHMARK_COMPILE_FLAGS) << ',' << CsvField(cpu_) << '\n';
+        }
+        return (bool)file;
+    }
+
+    /// \brief      Writes the environment and the results to a JSON file.
+    /// \returns    False if the file could not be written.
+    bool WriteJson(const std::string& path) const {
+        std::ofstream file(path.c_str());
+        if(!file)
+            return false;
+        file << "{\n"
+             << "  \"compiler\": " << JsonString(compiler_) << ",\n"
+             << "  \"flags\": " << JsonString(MN_BENCHMARK_COMPILE_FLAGS) << ",\n"
+             << "  \"cpu\": " << JsonString(cpu_) << ",\n"
+             << "  \"results\": [\n";
+        for(size_t i = 0; i < results_.size(); i++) {
+            const Result& r = results_[i];
+            file << "    {\"op\": " << JsonString(r.op)
+                 << ", \"type\": " << JsonString(r.type)
+                 << ", \"q_format\": " << JsonString(r.qFormat)
+                 << ", \"variant\": " << JsonString(r.variant)
+                 << ", \"ns_per_op\": " << Number(r.nsPerOp)
+                 << ", \"p99_ns_per_op\": " << Number(r.p99NsPerOp)
+                 << ", \"mean_ns_per_op\": " << Number(r.meanNsPerOp)
+                 << ", \"stddev_ns_per_op\": " << Number(r.stdDevNsPerOp)
+                 << ", \"cycles_per_op\": " << Number(r.cyclesPerOp)
+                 << ", \"core_cycles_per_op\": " << Number(r.coreCyclesPerOp)
+                 << ", \"instructions_per_op\": " << Number(r.instructionsPerOp)
+                 << ", \"ipc\": " << Number(r.ipc)
+                 << ", \"branch_misses_per_op\": " << Number(r.branchMissesPerOp)
+                 << ", \"l1d_misses_per_op\": " << Number(r.l1dMissesPerOp)
+                 << ", \"repetitions\": " << r.repetitions
+                 << ", \"ops_per_sample\": " << r.opsPerSample << "}"
+                 << (i + 1 < results_.size() ? ",\n" : "\n");
+        }
+        file << "  ]\n}\n";
+        return (bool)file;
+    }
+
+private:
+
+    /// \brief      Average count of event per operation, or -1 if the counter is not available.
+    double PerfPerOp(PerfEvent event, const uint64_t* totals, double totalOps) const {
+        if(!usePerf_ || !perf_.IsAvailable(event))
+            return -1.0;
+        return (double)totals[(unsigned)event] / totalOps;
+    }
+
+    static double Mean(const std::vector<double>& values) {
+        double sum = 0.0;
+        for(double value : values)
+            sum += value;
+        return values.empty() ? 0.0 : sum / (double)values.size();
+    }
+
+    /// \brief      Sample standard deviation.
+    static double StdDev(const std::vector<double>& values, double mean) {
+        if(values.size() < 2)
+            return 0.0;
+        double sumOfSquares = 0.0;
+        for(double value : values)
+            sumOfSquares += (value - mean) * (value - mean);
+        return std::sqrt(sumOfSquares / (double)(values.size() - 1));
+    }
+
+    /// \brief      Nearest-rank percentile (0 < percentile <= 100).
+    static double Percentile(std::vector<double> values, double percentile) {
+        if(values.empty())
+            return 0.0;
+        std::sort(values.begin(), values.end());
+        size_t rank = (size_t)std::ceil(percentile / 100.0 * (double)values.size());
+        return values[rank == 0 ? 0 : rank - 1];
+    }
+
+    static std::string Number(double value) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.4f", value);
+        return buffer;
+    }
+
+    static std::string CsvField(const std::string& value) {
+        if(value.find_first_of(",\"\n") == std::string::npos)
+            return value;
+        std::string quoted = "\"";
+        for(char c : value) {
+            if(c == '"')
+                quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    static std::string JsonString(const std::string& value) {
+        std::string escaped = "\"";
+        for(char c : value) {
+            if(c == '"' || c == '\\') {
+                escaped += '\\';
+                escaped += c;
+            } else if((unsigned char)c < 0x20) {
+                char buffer[8];
+                snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned)c);
+                escaped += buffer;
+            } else {
+                escaped += c;
+            }
+        }
+        return escaped + "\"";
+    }
+
+    Options options_;
+    std::string compiler_;
+    std::string cpu_;
+    PerfCounters perf_;
+    bool usePerf_;
+    std::vector<Result> results_;
+};
+
+//===============================================================================================//
+//====================================== LATENCY/THROUGHPUT =====================================//
+//===============================================================================================//
+
+/// \brief      Number of independent dependency chains used by the throughput variant.
+static constexpr unsigned numThroughputChains = 8;
+
+/// \brief      Latency variant: every operation depends on the result of the previous one, so the time per
+///             operation is the op's latency.
+template <class T, class Op>
+void LatencyChain(T x, T operand, uint64_t iterations, Op op) {
+    DoNotOptimize(operand);
+    for(uint64_t i = 0; i < iterations; i++) {
+        x = op(x, operand);
+        DoNotOptimize(x);
+    }
+}
+
+/// \brief      Throughput variant: numThroughputChains independent chains are interleaved, so the CPU can
+///             overlap them and the time per operation is the op's reciprocal throughput.
+template <class T, class Op>
+void ThroughputChains(T x, T operand, uint64_t iterations, Op op) {
+    DoNotOptimize(operand);
+    // Separate variables rather than an array, so the chains stay in registers even when the compiler does
+    // not unroll a loop over them
+    T c0 = x, c1 = x, c2 = x, c3 = x, c4 = x, c5 = x, c6 = x, c7 = x;
+    for(uint64_t i = 0; i < iterations; i++) {
+        c0 = op(c0, operand);
+        c1 = op(c1, operand);
+        c2 = op(c2, operand);
+        c3 = op(c3, operand);
+        c4 = op(c4, operand);
+        c5 = op(c5, operand);
+        c6 = op(c6, operand);
+        c7 = op(c7, operand);
+        DoNotOptimize(c0);
+        DoNotOptimize(c1);
+        DoNotOptimize(c2);
+        DoNotOptimize(c3);
+        DoNotOptimize(c4);
+        DoNotOptimize(c5);
+        DoNotOptimize(c6);
+        DoNotOptimize(c7);
+    }
+}
+
+/// \brief      Benchmarks op on type T as both a latency chain and a throughput chain.
+/// \details    x is the starting value and operand the right-hand side of every operation. Pick an operand
+///             that leaves x unchanged (0 for +/-, 1 for * and /) so the chains never overflow.
+template <class T, class Op>
+void RunLatencyAndThroughput(Harness& harness, const std::string& op, const std::string& type,
+                             const std::string& qFormat, T x, T operand, Op fn) {
+    harness.Run(op, type, qFormat, "latency", 1, [=](uint64_t iterations) {
+        LatencyChain(x, operand, iterations, fn);
+    });
+    harness.Run(op, type, qFormat, "throughput", numThroughputChains, [=](uint64_t iterations) {
+        ThroughputChains(x, operand, iterations, fn);
+    });
+}
+
+} // namespace benchmark
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_BENCHMARK_HARNESS_H
+
+// EOF
@@ -0,0 +1,190 @@
+///
+/// \file 				PerfCounters.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				Hardware performance counters (Linux perf_event_open) for the benchmark harness.
+/// \details
+///		Counts core cycles, instructions, branch misses and L1 data cache read misses of the calling thread
+///		(user-space only, so it works with the default perf_event_paranoid setting of 2). Counters that can
+///		not be opened (no PMU, e.g. in many VMs, perf_event_paranoid > 2, a seccomp filter, or not Linux)
+///		are reported as unavailable rather than failing the benchmark.
+///		See README.rst in root dir for more info.
+
+#ifndef MN_MFIXEDPOINT_BENCHMARK_PERF_COUNTERS_H
+#define MN_MFIXEDPOINT_BENCHMARK_PERF_COUNTERS_H
+
+// System includes
+#include <fstream>
+#include <stdint.h>
+#include <string>
+
+#if defined(__linux__)
+    #include <errno.h>
+    #include <linux/perf_event.h>
+    #include <string.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #define MN_BENCHMARK_HAS_PERF_EVENT 1
+#else
+    #define MN_BENCHMARK_HAS_PERF_EVENT 0
+#endif
+
+namespace mn {
+namespace MFixedPoint {
+namespace benchmark {
+
+/// \brief      The events counted by PerfCounters.
+enum class PerfEvent {
+    Cycles,
+    Instructions,
+    BranchMisses,
+    L1dMisses,
+};
+
+static constexpr unsigned numPerfEvents = 4;
+
+/// \brief      A set of hardware counters that can be started and stopped around a benchmark sample.
+class PerfCounters {
+
+public:
+
+    PerfCounters() {
+        for(unsigned i = 0; i < numPerfEvents; i++) {
+            fds_[i] = -1;
+            counts_[i] = 0;
+        }
+    }
+
+    ~PerfCounters() {
+        Close();
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /// \brief      Opens every counter the kernel allows.
+    /// \returns    True if at least one counter could be opened. If not, GetError() says why.
+    bool Open() {
+#if MN_BENCHMARK_HAS_PERF_EVENT
+        const uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                     (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const uint32_t types[numPerfEvents] = {
+                PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE };
+        const uint64_t configs[numPerfEvents] = {
+                PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, l1dReadMiss };
+
+        int firstErrno = 0;
+        for(unsigned i = 0; i < numPerfEvents; i++) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = types[i];
+            attr.config = configs[i];
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // So the counts can be scaled if the kernel has to multiplex the counters
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds_[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+            if(fds_[i] < 0 && firstErrno == 0)
+                firstErrno = errno;
+        }
+        if(IsAnyAvailable())
+            return true;
+        error_ = std::string("perf_event_open() failed: ") + strerror(firstErrno);
+        if(firstErrno == EACCES || firstErrno == EPERM)
+            error_ += " (kernel.perf_event_paranoid = " + ReadParanoidLevel() + ")";
+        else if(firstErrno == ENOENT || firstErrno == EOPNOTSUPP)
+            error_ += " (no hardware performance counters, e.g. running in a VM)";
+        return false;
+#else
+        error_ = "hardware performance counters are only supported on Linux";
+        return false;
+#endif
+    }
+
+    void Close() {
+#if MN_BENCHMARK_HAS_PERF_EVENT
+        for(unsigned i = 0; i < numPerfEvents; i++) {
+            if(fds_[i] >= 0)
+                close(fds_[i]);
+            fds_[i] = -1;
+        }
+#endif
+    }
+
+    bool IsAvailable(PerfEvent event) const {
+        return fds_[(unsigned)event] >= 0;
+    }
+
+    bool IsAnyAvailable() const {
+        for(unsigned i = 0; i < numPerfEvents; i++) {
+            if(fds_[i] >= 0)
+                return true;
+        }
+        return false;
+    }
+
+    const std::string& GetError() const {
+        return error_;
+    }
+
+    /// \brief      Resets and starts all open counters.
+    void Start() {
+#if MN_BENCHMARK_HAS_PERF_EVENT
+        for(unsigned i = 0; i < numPerfEvents; i++) {
+            if(fds_[i] >= 0) {
+                ioctl(fds_[i], PERF_EVENT_IOC_RESET, 0);
+                ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /// \brief      Stops all open counters and reads their (multiplexing-scaled) counts.
+    void Stop() {
+#if MN_BENCHMARK_HAS_PERF_EVENT
+        for(unsigned i = 0; i < numPerfEvents; i++) {
+            if(fds_[i] >= 0)
+                ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for(unsigned i = 0; i < numPerfEvents; i++) {
+            counts_[i] = 0;
+            uint64_t values[3]; // value, time enabled, time running
+            if(fds_[i] < 0 || read(fds_[i], values, sizeof(values)) != (ssize_t)sizeof(values))
+                continue;
+            counts_[i] = values[2] == 0 ? 0 :
+                    values[2] >= values[1] ? values[0] :
+                    (uint64_t)((double)values[0] * (double)values[1] / (double)values[2]);
+        }
+#endif
+    }
+
+    /// \brief      The count of event between the last Start() and Stop().
+    uint64_t GetCount(PerfEvent event) const {
+        return counts_[(unsigned)event];
+    }
+
+private:
+
+    static std::string ReadParanoidLevel() {
+        std::ifstream file("/proc/sys/kernel/perf_event_paranoid");
+        std::string level;
+        return (file >> level) ? level : "unknown";
+    }
+
+    int fds_[numPerfEvents];
+    uint64_t counts_[numPerfEvents];
+    std::string error_;
+};
+
+} // namespace benchmark
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_BENCHMARK_PERF_COUNTERS_H
+
+// EOF
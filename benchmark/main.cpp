@@ -3,447 +3,1271 @@
 /// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 /// \edited 			n/a
 /// \reated			    2013-05-30
-/// \last-modified		2018-02-12
+/// \last-modified		2026-10-16
 /// \brief 				Has the entry point for the benchmark program.
 /// \details
 ///		See README.rst in root dir for more info.
 
 // System includes
-#include <sys/time.h>
-#include <sys/resource.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdexcept>
 #include <iostream>
+#include <string>
+#include <vector>
 
 // 3rd party includes
+#include "MFixedPoint/BiquadCascade.hpp"
+#include "MFixedPoint/BlockFp.hpp"
+#include "MFixedPoint/FpBinary.hpp"
+#include "MFixedPoint/Fft.hpp"
+#include "MFixedPoint/FirFilter.hpp"
+#include "MFixedPoint/FpComplex.hpp"
 #include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFExpr.hpp"
+#include "MFixedPoint/FpFArray.hpp"
+#include "MFixedPoint/FpFConvert.hpp"
+#include "MFixedPoint/FpFMath.hpp"
+#include "MFixedPoint/FpFParse.hpp"
+#include "MFixedPoint/FpFSat.hpp"
+#include "MFixedPoint/FpMatrix.hpp"
+#include "MFixedPoint/FpQ.hpp"
 #include "MFixedPoint/FpS.hpp"
+#include "MFixedPoint/FpSSat.hpp"
+#include "MFixedPoint/FpSVector.hpp"
+#include "MFixedPoint/Rounding.hpp"
 
 // User includes
+#include "Harness.hpp"
 #include "SoftFloat.hpp"
 
 using namespace mn::MFixedPoint;
+using namespace mn::MFixedPoint::benchmark;
 
-static constexpr uint32_t numCyclesPerTest = 100000;
+/// \brief      Array length used for the per-element array benchmarks (small enough to stay in the L1/L2
+///             cache, so these measure compute rather than memory bandwidth).
+static constexpr uint32_t arrayLength = 4096;
 
-class ExpectedRunTimes {
-public:
+/// \brief      Array lengths used for the batch (array) operation benchmarks.
+static constexpr uint32_t batchLengths[] = { 1024, 64*1024, 1024*1024 };
+
+//===============================================================================================//
+//========================================= OPERATIONS ==========================================//
+//===============================================================================================//
+
+struct AddOp {
+    template <class T>
+    T operator()(T a, T b) const { return a + b; }
+};
+
+struct SubtractOp {
+    template <class T>
+    T operator()(T a, T b) const { return a - b; }
+};
 
-    static constexpr double fpF32Add_ns = 6.7;
-    static constexpr double fpF64Add_ns = 8.2;
-    static constexpr double fpS32Add_ns = 10.6;
-    static constexpr double fpS64Add_ns = 14.2;
-    static constexpr double softwareFloatAdd_ns = 17.0;
-    static constexpr double hardwareFloatAdd_ns = 3.4;
-
-    static constexpr double fpF32Sub_ns = 7.5;
-    static constexpr double fpF64Sub_ns = 7.5;
-    static constexpr double fpS32Sub_ns = 14.0;
-    static constexpr double fpS64Sub_ns = 10.4;
-    static constexpr double softwareFloatSub_ns = -1.0;
-    static constexpr double hardwareFloatSub_ns = 2.6;
-
-    static constexpr double fpF32Mul_ns = 10.3;
-    static constexpr double fpF64Mul_ns = 10.1;
-	static constexpr double fpS32Mul_ns = 12.2;
-    static constexpr double fpS64Mul_ns = 10.4;
-	static constexpr double softwareFloatMul_ns = 32.0;
-    static constexpr double hardwareFloatMul_ns = 2.5;
-
-    static constexpr double fpF32Div_ns = 19.0;
-    static constexpr double fpF64Div_ns = 18.0;
-    static constexpr double fpS32Div_ns = 10.8;
-    static constexpr double fpS64Div_ns = 19.8;
-    static constexpr double softwareFloatDiv_ns = -1.0;
-    static constexpr double hardwareFloatDiv_ns = 5.1;
+struct MultiplyOp {
+    template <class T>
+    T operator()(T a, T b) const { return a * b; }
 };
 
-typedef struct tag_time_measure {
-  struct timeval startTimeVal;
-  struct timeval stopTimeVal;
+struct DivideOp {
+    template <class T>
+    T operator()(T a, T b) const { return a / b; }
+};
 
-  struct rusage startTimeUsage;
-  struct rusage stopTimeUsage;
-} time_measure;
+/// \brief      SoftFloat only implements addition (of numbers with the same sign) and multiplication.
+struct SoftFloatAddOp {
+    f32 operator()(f32 a, f32 b) const { return SoftFloat().Add(a, b); }
+};
 
-time_measure* StartTimeMeasuring() {
-  time_measure* tu = (time_measure*)malloc(sizeof(time_measure));
-  if(!tu)
-    exit(1);
+struct SoftFloatMultiplyOp {
+    f32 operator()(f32 a, f32 b) const { return SoftFloat().Multiply(a, b); }
+};
 
-  getrusage(RUSAGE_SELF, &tu->startTimeUsage);
-  gettimeofday(&tu->startTimeVal,0);
+/// \brief      FpS addition, with the operands aligned by the branching or branchless method (the FpS
+///             operators use the one selected by MN_MFIXEDPOINT_FPS_BRANCHLESS).
+template <bool branchless>
+struct FpSAlignedAddOp {
+    FpS32 operator()(FpS32 a, FpS32 b) const {
+        int32_t l = a.GetRawVal(), r = b.GetRawVal();
+        const uint8_t numFracBits = mn::MFixedPoint::detail::FpSAlign<branchless>::Align(l, a.GetNumFracBits(), r, b.GetNumFracBits());
+        return FpS32::FromRaw(l + r, numFracBits);
+    }
+};
 
-  return tu;
+template <bool branchless>
+struct FpSAlignedMultiplyOp {
+    FpS32 operator()(FpS32 a, FpS32 b) const {
+        int32_t l = a.GetRawVal(), r = b.GetRawVal();
+        const uint8_t numFracBits = mn::MFixedPoint::detail::FpSAlign<branchless>::Align(l, a.GetNumFracBits(), r, b.GetNumFracBits());
+        return FpS32::FromRaw((int32_t)(((int64_t)l * (int64_t)r) >> numFracBits), numFracBits);
+    }
+};
+
+template <bool branchless>
+struct FpSAlignedLessThanOp {
+    bool operator()(FpS32 a, FpS32 b) const {
+        int32_t l = a.GetRawVal(), r = b.GetRawVal();
+        mn::MFixedPoint::detail::FpSAlign<branchless>::Align(l, a.GetNumFracBits(), r, b.GetNumFracBits());
+        return l < r;
+    }
+};
+
+static f32 FloatToBits(float value) {
+    f32 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
 }
 
-void StopTimeMeasuring(time_measure * tu) {
-  getrusage(RUSAGE_SELF, &tu->stopTimeUsage);
-  gettimeofday(&tu->stopTimeVal,0);
+static float BitsToFloat(f32 bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
 }
 
-void PrintMetrics(time_measure * tu, char* testName, uint32_t testCount, double avgDurationPerTest_ns) {
-	struct timeval elapsedVal;
-	struct timeval userVal;
-	struct timeval systemVal;
-
-	double elapsed_millis = 0.0f;
-	double user_millis = 0.0f;
-	double system_millis = 0.0f;
-
-	timersub(&tu->stopTimeVal, &tu->startTimeVal, &elapsedVal);
-	timersub(&tu->stopTimeUsage.ru_utime, &tu->startTimeUsage.ru_utime, &userVal);
-	timersub(&tu->stopTimeUsage.ru_stime, &tu->startTimeUsage.ru_stime, &systemVal);
-
-	elapsed_millis = elapsedVal.tv_sec * 1000 + (double) elapsedVal.tv_usec / 1000;
-	user_millis = userVal.tv_sec * 1000 + (double) userVal.tv_usec / 1000;
-	system_millis = systemVal.tv_sec * 1000 + (double) systemVal.tv_usec / 1000;
-	double timePerSingleTest_ns = (elapsed_millis*1000.)/((double)testCount)*1000.0;
-	double percGreaterThanAvg = ((timePerSingleTest_ns-avgDurationPerTest_ns)/avgDurationPerTest_ns)*100.0;
-
-	printf("\n\n---%s--- \n", testName);
-	printf(
-		"Total (ms):\t\t\t %f\n"
-		"User (ms):\t\t\t %f\n"
-		"System (ms):\t\t\t %f\n"
-		"Num. Tests:\t\t\t %u\n"
-		"Time Per Single Test (ns):\t %f (%.0f%% higher than expected)\n",
-		elapsed_millis,
-		user_millis,
-		system_millis,
-		testCount,
-		timePerSingleTest_ns,
-		percGreaterThanAvg);
+/// \brief      Benchmarks +, -, * and / of type T, starting from x. zero and one are used as the operands so
+///             that the chains never overflow.
+template <class T>
+static void BenchmarkArithmetic(Harness& harness, const std::string& type, const std::string& qFormat,
+                                T x, T zero, T one) {
+    RunLatencyAndThroughput(harness, "add", type, qFormat, x, zero, AddOp());
+    RunLatencyAndThroughput(harness, "sub", type, qFormat, x, zero, SubtractOp());
+    RunLatencyAndThroughput(harness, "mul", type, qFormat, x, one, MultiplyOp());
+    RunLatencyAndThroughput(harness, "div", type, qFormat, x, one, DivideOp());
 }
 
+template <class FpFType, int numBits, int numFracBits>
+static void BenchmarkFpF(Harness& harness, const std::string& type) {
+    BenchmarkArithmetic(harness, type, QFormat(numBits, numFracBits), FpFType(1.5), FpFType(0), FpFType(1));
+}
 
+template <class FpSType, int numBits>
+static void BenchmarkFpS(Harness& harness, const std::string& type, uint8_t numFracBits) {
+    BenchmarkArithmetic(harness, type, QFormat(numBits, numFracBits),
+                        FpSType(1.5, numFracBits), FpSType(0.0, numFracBits), FpSType(1.0, numFracBits));
+}
 
+/// \brief      Benchmarks fn(i), called for every element i of an array of length, reported per element.
+template <class Fn>
+static void RunArray(Harness& harness, const std::string& op, const std::string& type, const std::string& qFormat,
+                     const std::string& variant, uint32_t length, Fn fn) {
+    harness.Run(op, type, qFormat, variant, length, [&](uint64_t iterations) {
+        for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+            for(uint32_t i = 0; i < length; i++)
+                fn(i);
+            ClobberMemory();
+        }
+    });
+}
 
-int main() {
+static const char* SimdIsaName(SimdIsa isa) {
+    switch(isa) {
+        case SimdIsa::Sse41: return "sse4.1";
+        case SimdIsa::Avx2: return "avx2";
+        case SimdIsa::Avx512: return "avx512";
+        default: return "scalar";
+    }
+}
 
-	// Make sure our custom float addition works
-	float testFloat1 = 4.32f;
-	float testFloat2 = 7.89f;
+/// \brief      Benchmarks a 4 section BiquadCascade of numChannels interleaved channels (reported per sample of
+///             each channel), and a double-precision Direct Form I cascade.
+template <std::size_t numChannels, bool errorFeedback>
+static void BenchmarkBiquadCascade(Harness& harness) {
+    typedef BiquadCascade<FpF32<28>, 4, numChannels, errorFeedback> Cascade;
+    const std::size_t numSections = 4;
+    const uint32_t numFrames = 1024;
+    // Low-pass sections with cut-off frequencies of 0.05, 0.1, 0.15 and 0.2 of the sample rate
+    double c[numSections][5];
+    typename Cascade::Coefficients coefficients[numSections];
+    for(std::size_t s = 0; s < numSections; s++) {
+        const double w = 2.0 * M_PI * 0.05 * (s + 1);
+        const double alpha = std::sin(w) / (2.0 * 0.707);
+        const double a0 = 1.0 + alpha;
+        c[s][0] = c[s][2] = (1.0 - std::cos(w)) / 2.0 / a0;
+        c[s][1] = (1.0 - std::cos(w)) / a0;
+        c[s][3] = -2.0 * std::cos(w) / a0;
+        c[s][4] = (1.0 - alpha) / a0;
+        coefficients[s].b0 = FpF32<28>(c[s][0]);
+        coefficients[s].b1 = FpF32<28>(c[s][1]);
+        coefficients[s].b2 = FpF32<28>(c[s][2]);
+        coefficients[s].a1 = FpF32<28>(c[s][3]);
+        coefficients[s].a2 = FpF32<28>(c[s][4]);
+    }
+    std::vector<FpF32<28>> in(numFrames * numChannels), out(numFrames * numChannels);
+    std::vector<double> inDouble(numFrames * numChannels), outDouble(numFrames * numChannels);
+    for(std::size_t i = 0; i < in.size(); i++) {
+        inDouble[i] = 0.5 * std::sin(0.01 * (double) i) + 0.1 * (double) (i % 7) / 7.0;
+        in[i] = FpF32<28>(inDouble[i]);
+    }
+    const std::string variant = "sections-4-channels-" + std::to_string(numChannels) +
+                                (errorFeedback ? "-error-feedback" : "");
+
+    Cascade cascade(coefficients);
+    harness.Run("BiquadCascade", "FpF32", QFormat(32, 28), variant, numFrames * numChannels, [&](uint64_t iterations) {
+        for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+            cascade.Process(in.data(), out.data(), numFrames);
+            ClobberMemory();
+        }
+    });
+
+    if(errorFeedback)
+        return;
+    double state[numSections + 1][2][numChannels] = {};
+    harness.Run("BiquadCascade", "double", "double", variant, numFrames * numChannels, [&](uint64_t iterations) {
+        for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+            for(uint32_t n = 0; n < numFrames; n++) {
+                double x[numChannels];
+                for(std::size_t ch = 0; ch < numChannels; ch++)
+                    x[ch] = inDouble[n*numChannels + ch];
+                for(std::size_t s = 0; s < numSections; s++) {
+                    for(std::size_t ch = 0; ch < numChannels; ch++) {
+                        const double y = c[s][0] * x[ch] + c[s][1] * state[s][0][ch] + c[s][2] * state[s][1][ch] -
+                                         c[s][3] * state[s + 1][0][ch] - c[s][4] * state[s + 1][1][ch];
+                        state[s][1][ch] = state[s][0][ch];
+                        state[s][0][ch] = x[ch];
+                        x[ch] = y;
+                    }
+                }
+                for(std::size_t ch = 0; ch < numChannels; ch++) {
+                    state[numSections][1][ch] = state[numSections][0][ch];
+                    state[numSections][0][ch] = x[ch];
+                    outDouble[n*numChannels + ch] = x[ch];
+                }
+            }
+            ClobberMemory();
+        }
+    });
+}
+
+/// \brief      A double-precision FIR filter with the same mirrored circular buffer as FirFilter, used as the
+///             reference for the FirFilter benchmarks.
+template <std::size_t numTaps>
+class DoubleFirFilter {
+public:
+    explicit DoubleFirFilter(const double* coefficients) : position_(0) {
+        for(std::size_t i = 0; i < numTaps; i++)
+            coefficients_[numTaps - 1 - i] = coefficients[i];
+        for(std::size_t i = 0; i < 2*numTaps; i++)
+            delayLine_[i] = 0.0;
+    }
+
+    double Process(double sample) {
+        delayLine_[position_] = sample;
+        delayLine_[position_ + numTaps] = sample;
+        position_ = position_ + 1 == numTaps ? 0 : position_ + 1;
+        double sum = 0.0;
+        for(std::size_t i = 0; i < numTaps; i++)
+            sum += delayLine_[position_ + i] * coefficients_[i];
+        return sum;
+    }
+
+private:
+    double coefficients_[numTaps];
+    double delayLine_[2*numTaps];
+    std::size_t position_;
+};
+
+/// \brief      Benchmarks a numTaps FirFilter on FpFType with every instruction set (reported per sample, so
+///             samples/second = 1e9 / ns_per_op), and the double-precision reference if runReference is true (it
+///             only depends on numTaps, so is only run once per num. of taps).
+template <class FpFType, std::size_t numTaps>
+static void BenchmarkFirFilter(Harness& harness, const std::string& type, const std::string& qFormat,
+                               bool runReference = true) {
+    const uint32_t length = 4096;
+    std::vector<double> h(numTaps);
+    std::vector<FpFType> hFp, in, out(length);
+    std::vector<double> inDouble(length), outDouble(length);
+    for(std::size_t i = 0; i < numTaps; i++) {
+        // A windowed moving average (the sum of the coefficients is about 1, so the output never overflows)
+        h[i] = (1.0 - std::cos(2.0 * M_PI * (i + 1) / (numTaps + 1))) / (numTaps + 1);
+        hFp.push_back(FpFType(h[i]));
+    }
+    for(uint32_t i = 0; i < length; i++) {
+        inDouble[i] = std::sin(0.01 * i) + 0.1 * (double)(i % 7) / 7.0;
+        in.push_back(FpFType(inDouble[i]));
+    }
+    const std::string taps = "taps-" + std::to_string(numTaps);
 
+    const SimdIsa bestIsa = GetSimdIsa();
+    for(SimdIsa isa = SimdIsa::Scalar; isa <= bestIsa; isa = (SimdIsa)((int)isa + 1)) {
+        SetSimdIsa(isa);
+        FirFilter<FpFType, numTaps> filter(hFp.data());
+        harness.Run("FirFilter", type, qFormat, taps + "-" + SimdIsaName(isa), length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                filter.Process(in.data(), out.data(), length);
+                ClobberMemory();
+            }
+        });
+    }
+    SetSimdIsa(bestIsa);
+
+    if(!runReference)
+        return;
+    DoubleFirFilter<numTaps> reference(h.data());
+    RunArray(harness, "FirFilter", "double", "double", taps, length, [&](uint32_t i) {
+        outDouble[i] = reference.Process(inDouble[i]);
+    });
+}
+
+/// \brief      An in-place radix-2 float FFT with precomputed twiddle factors, used as the reference for the FFT
+///             benchmarks.
+template <std::size_t size>
+class FloatFft {
+public:
+    FloatFft() : cos_(size / 2), sin_(size / 2) {
+        for(std::size_t k = 0; k < size / 2; k++) {
+            cos_[k] = (float)std::cos(2.0 * M_PI * k / size);
+            sin_[k] = (float)std::sin(2.0 * M_PI * k / size);
+        }
+    }
+
+    void Forward(float* re, float* im) const {
+        for(std::size_t i = 1, j = 0; i < size; i++) {
+            std::size_t bit = size >> 1;
+            for(; j & bit; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+            if(i < j) {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+        for(std::size_t half = 1; half < size; half *= 2) {
+            const std::size_t stride = size / (2 * half);
+            for(std::size_t group = 0; group < size; group += 2 * half) {
+                for(std::size_t j = 0; j < half; j++) {
+                    const float c = cos_[j * stride], s = sin_[j * stride];
+                    const std::size_t a = group + j, b = a + half;
+                    const float tRe = re[b] * c + im[b] * s;
+                    const float tIm = im[b] * c - re[b] * s;
+                    re[b] = re[a] - tRe;
+                    im[b] = im[a] - tIm;
+                    re[a] += tRe;
+                    im[a] += tIm;
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<float> cos_, sin_;
+};
+
+/// \brief      Benchmarks complex and real FFTs of FpF32<16> numbers, and the float reference (reported per
+///             transform). Every iteration copies the input to the work arrays first.
+template <std::size_t size>
+static void BenchmarkFft(Harness& harness, const std::string& qFormat) {
+    std::vector<FpF32<16>> inRe, inIm, re(size), im(size);
+    std::vector<float> inReFloat(size), inImFloat(size), reFloat(size), imFloat(size);
+    for(std::size_t n = 0; n < size; n++) {
+        inReFloat[n] = (float)(std::sin(0.01 * n) + 0.1 * (double)(n % 7) / 7.0);
+        inImFloat[n] = (float)std::cos(0.03 * n);
+        inRe.push_back(FpF32<16>(inReFloat[n]));
+        inIm.push_back(FpF32<16>(inImFloat[n]));
+    }
+    const std::string variant = "size-" + std::to_string(size);
+
+    harness.Run("Fft", "FpF32", qFormat, variant, 1, [&](uint64_t iterations) {
+        for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+            std::copy(inRe.begin(), inRe.end(), re.begin());
+            std::copy(inIm.begin(), inIm.end(), im.begin());
+            int exponent = Fft<size>(re.data(), im.data());
+            DoNotOptimize(exponent);
+            ClobberMemory();
+        }
+    });
+    harness.Run("RealFft", "FpF32", qFormat, variant, 1, [&](uint64_t iterations) {
+        for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+            int exponent = RealFft<size>(inRe.data(), re.data(), im.data());
+            DoNotOptimize(exponent);
+            ClobberMemory();
+        }
+    });
+
+    const FloatFft<size> reference;
+    harness.Run("Fft", "float", "float", variant, 1, [&](uint64_t iterations) {
+        for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+            std::copy(inReFloat.begin(), inReFloat.end(), reFloat.begin());
+            std::copy(inImFloat.begin(), inImFloat.end(), imFloat.begin());
+            reference.Forward(reFloat.data(), imFloat.data());
+            ClobberMemory();
+        }
+    });
+}
+
+//===============================================================================================//
+//====================================== COMMAND LINE ARGS ======================================//
+//===============================================================================================//
+
+static void PrintUsage(const char* programName) {
+    printf("Usage: %s [options]\n"
+           "  --filter <text>          Only run benchmarks whose op/type/variant contains <text>.\n"
+           "  --repetitions <n>        Samples taken per benchmark (default 25).\n"
+           "  --min-sample-ms <ms>     Minimum duration of each sample (default 1.0).\n"
+           "  --perf                   Also count core cycles, instructions, branch misses and L1D misses\n"
+           "                           per op with perf_event_open() (Linux only).\n"
+           "  --json <file>            Write the results to <file> as JSON.\n"
+           "  --csv <file>             Write the results to <file> as CSV.\n",
+           programName);
+}
+
+/// \returns    False if the arguments are invalid.
+static bool ParseArgs(int argc, char** argv, Options& options) {
+    for(int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if(arg == "--perf") {
+            options.perfCounters = true;
+            continue;
+        }
+        if(i + 1 >= argc)
+            return false;
+        const char* value = argv[++i];
+        if(arg == "--filter")
+            options.filter = value;
+        else if(arg == "--repetitions")
+            options.repetitions = (unsigned)atoi(value);
+        else if(arg == "--min-sample-ms")
+            options.minSampleMs = atof(value);
+        else if(arg == "--json")
+            options.jsonPath = value;
+        else if(arg == "--csv")
+            options.csvPath = value;
+        else
+            return false;
+    }
+    return options.repetitions > 0 && options.minSampleMs > 0.0;
+}
+
+int main(int argc, char** argv) {
+
+    Options options;
+    if(!ParseArgs(argc, argv, options)) {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+
+	// Make sure our custom float multiplication works
 	SoftFloat softFloat;
-	f32 rawResult = softFloat.Multiply(reinterpret_cast<uint32_t&>(testFloat1), reinterpret_cast<uint32_t&>(testFloat2));
-	float result = reinterpret_cast<float&>(rawResult);
+	float result = BitsToFloat(softFloat.Multiply(FloatToBits(4.32f), FloatToBits(7.89f)));
 	if(result > 4.32 * 7.89 + 0.1 || result < 4.32 * 7.89 - 0.1) {
 		std::cout << "result = " << result;
-		throw std::runtime_error("add() did not work.");
+		throw std::runtime_error("Multiply() did not work.");
 	}
 
+    Harness harness(options);
+    harness.PrintHeader();
+
     //===============================================================================================//
-    //======================================== TEST VARIABLE INIT ===================================//
+    //================================== BASIC ARITHMETIC BENCHMARKING ==============================//
     //===============================================================================================//
 
+    BenchmarkFpF<FpF8<4>, 8, 4>(harness, "FpF8");
+    BenchmarkFpF<FpF16<8>, 16, 8>(harness, "FpF16");
+    BenchmarkFpF<FpF32<16>, 32, 16>(harness, "FpF32");
+    BenchmarkFpF<FpF64<32>, 64, 32>(harness, "FpF64");
 
-	FpF32<8> fpF32_1(5.6);
-	FpF32<8> fpF32_2(8.9);
-	FpF32<8> fpF32_3;
+    BenchmarkFpS<FpS8, 8>(harness, "FpS8", 4);
+    BenchmarkFpS<FpS16, 16>(harness, "FpS16", 8);
+    BenchmarkFpS<FpS32, 32>(harness, "FpS32", 16);
+    BenchmarkFpS<FpS64, 64>(harness, "FpS64", 32);
 
-	FpS32 fpS32_1(5.6, 8);
-	FpS32 fpS32_2(8.9, 8);
-	FpS32 fpS32_3(8.9, 8);
-	
-	FpF64<8> fpF64_1(5.6);
-	FpF64<8> fpF64_2(8.9);
-	FpF64<8> fpF64_3;
-	
-	FpS64 fpS64_1(5.6, 12);
-	FpS64 fpS64_2(8.9, 12);
-	FpS64 fpS64_3(0.0, 12);
+    BenchmarkArithmetic(harness, "float", "binary32", 1.5f, 0.0f, 1.0f);
 
-	float float1 = 5.6;
-	float float2 = 8.9;
-	float float3 = 0.0;
+    // SoftFloat has no subtraction or division
+    RunLatencyAndThroughput(harness, "add", "SoftFloat", "binary32",
+                            FloatToBits(1.5f), FloatToBits(0.0f), SoftFloatAddOp());
+    RunLatencyAndThroughput(harness, "mul", "SoftFloat", "binary32",
+                            FloatToBits(1.5f), FloatToBits(1.0f), SoftFloatMultiplyOp());
 
-    time_measure * tu;
+    const std::string q16 = QFormat(32, 16);
 
-	//===============================================================================================//
-	//====================================== ADDITION BENCHMARKING ==================================//
-	//===============================================================================================//
-
-    //===== FpF32 ADDITION =====//
-	tu = StartTimeMeasuring();
-	{	
-		uint32_t x = 0;
-		for(x = 0; x < numCyclesPerTest; x++) {
-			fpF32_3 = fpF32_1 + fpF32_2;
-		}
-	}
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpF32 Addition", numCyclesPerTest, ExpectedRunTimes::fpF32Add_ns);
-    free(tu);
+    //===============================================================================================//
+    //======================================= DIVISION BENCHMARKING =================================//
+    //===============================================================================================//
 
-    //===== FpF64 ADDITION =====//
-    tu = StartTimeMeasuring();
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpF64_3 = fpF64_1 + fpF64_2;
+        std::vector<FpF32<16>> a(arrayLength), b(arrayLength), out(arrayLength);
+        for(uint32_t i = 0; i < arrayLength; i++) {
+            a[i] = FpF32<16>((double)(i % 1000) / 10.0 - 50.0);
+            b[i] = FpF32<16>((double)(i % 77) / 7.0 + 0.5);
         }
+
+        //===== FpF32 DIVISION OVER AN ARRAY (DIFFERENT DIVISORS) =====//
+        RunArray(harness, "div", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = a[i] / b[i];
+        });
+        RunArray(harness, "FastDivide", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = FastDivide(a[i], b[i]);
+        });
+
+        //===== FpF32 DIVISION OF AN ARRAY BY ONE NUMBER =====//
+        harness.Run("ArrayFastDivide", "FpF32", q16, "array", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                ArrayFastDivide(a.data(), b[3], out.data(), arrayLength);
+                ClobberMemory();
+            }
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpF64 Addition", numCyclesPerTest, ExpectedRunTimes::fpF64Add_ns);
-    free(tu);
 
-    //===== FpS32 ADDITION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //======================================== SIN BENCHMARKING =====================================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpS32_3 = fpS32_1 + fpS32_2;
+        std::vector<FpF32<16>> angles(arrayLength), out(arrayLength);
+        for(uint32_t i = 0; i < arrayLength; i++) {
+            angles[i] = FpF32<16>((double)i * 0.025 - 50.0);
         }
+
+        //===== FpF32 SIN (LOOKUP TABLE) =====//
+        RunArray(harness, "Sin", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = Sin(angles[i]);
+        });
+
+        //===== FpF32 SIN (VIA DOUBLE AND std::sin()) =====//
+        RunArray(harness, "SinViaDouble", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = FpF32<16>(std::sin(angles[i].ToDouble()));
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpS32 Addition", numCyclesPerTest, ExpectedRunTimes::fpS32Add_ns);
-    free(tu);
 
-    //===== FpS64 ADDITION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //==================================== SQUARE ROOT BENCHMARKING =================================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpS64_3 = fpS64_1 + fpS64_2;
+        std::vector<FpF32<16>> in(arrayLength), out(arrayLength);
+        for(uint32_t i = 0; i < arrayLength; i++) {
+            in[i] = FpF32<16>((double)i * 0.25 + 0.001);
         }
+
+        //===== FpF32 SQRT =====//
+        harness.Run("Sqrt", "FpF32", q16, "array", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                ArraySqrt(in.data(), out.data(), arrayLength);
+                ClobberMemory();
+            }
+        });
+
+        //===== FpF32 RSQRT =====//
+        harness.Run("RSqrt", "FpF32", q16, "array", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                ArrayRSqrt(in.data(), out.data(), arrayLength);
+                ClobberMemory();
+            }
+        });
+
+        //===== FpF32 RSQRT (VIA DOUBLE AND std::sqrt()) =====//
+        RunArray(harness, "RSqrtViaDouble", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = FpF32<16>(1.0/std::sqrt(in[i].ToDouble()));
+        });
+    }
+
+    //===============================================================================================//
+    //================================ MULTIPLY-ACCUMULATE BENCHMARKING =============================//
+    //===============================================================================================//
+
+    for(uint32_t length : batchLengths) {
+        // Small values so the sum of the raw products does not overflow int64_t
+        std::vector<FpF32<16>> a(length);
+        std::vector<FpF32<16>> b(length);
+        for(uint32_t i = 0; i < length; i++) {
+            a[i] = FpF32<16>((double)(i % 100) / 100.0);
+            b[i] = FpF32<16>(-(double)(i % 37) / 37.0);
+        }
+        const std::string lengthSuffix = "/" + std::to_string(length);
+
+        //===== FpF32 MAC, PER-ELEMENT OPERATOR LOOP =====//
+        harness.Run("MacOperatorLoop" + lengthSuffix, "FpF32", q16, "array", length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                FpF32<16> acc(0);
+                for(uint32_t i = 0; i < length; i++) {
+                    acc += a[i] * b[i];
+                }
+                DoNotOptimize(acc);
+            }
+        });
+
+        //===== FpF32 MAC, BATCH =====//
+        harness.Run("DotProduct" + lengthSuffix, "FpF32", q16, "array", length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                FpF32<16> acc = DotProduct(a.data(), b.data(), length);
+                DoNotOptimize(acc);
+            }
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpS64 Addition", numCyclesPerTest, ExpectedRunTimes::fpS64Add_ns);
-    free(tu);
 
-    //===== SOFTWARE FLOAT ADDITION =====//
-    tu = StartTimeMeasuring();
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            uint32_t rawFloat = softFloat.Add(*(uint32_t*)&float1, *(uint32_t*)&float2);
-            float3 = *(float*)&rawFloat;
+        //===== a*b + c*d - e*f, WITH FpF OPERATORS AND FUSED =====//
+        std::vector<FpF32<16>> a(arrayLength), b(arrayLength), c(arrayLength), out(arrayLength);
+        for(uint32_t i = 0; i < arrayLength; i++) {
+            a[i] = FpF32<16>(std::sin(0.01 * i));
+            b[i] = FpF32<16>(std::cos(0.02 * i));
+            c[i] = FpF32<16>(0.5 * std::sin(0.03 * i));
         }
+        RunArray(harness, "SumOfProducts", "FpF32", q16, "FpF-operators", arrayLength, [&](uint32_t i) {
+            out[i] = a[i] * b[i] + b[i] * c[i] - c[i] * a[i];
+        });
+        RunArray(harness, "SumOfProducts", "FpF32", q16, "Lazy", arrayLength, [&](uint32_t i) {
+            out[i] = Lazy(a[i]) * b[i] + Lazy(b[i]) * c[i] - Lazy(c[i]) * a[i];
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"Software Float Addition", numCyclesPerTest, ExpectedRunTimes::softwareFloatAdd_ns);
-    free(tu);
 
-    //===== HARDWARE FLOAT ADDITION =====//
-    tu = StartTimeMeasuring();
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            float3 = float1 + float2;
+        //===== a*b + c NARROWED BACK TO Q8.8, WITH FpF16 AND FpQ (WHICH IS EXACT UNTIL THE NARROWING) =====//
+        std::vector<FpF16<8>> a(arrayLength), b(arrayLength), c(arrayLength), out(arrayLength);
+        std::vector<FpQ<8, 8>> aQ(arrayLength), bQ(arrayLength), cQ(arrayLength), outQ(arrayLength);
+        for(uint32_t i = 0; i < arrayLength; i++) {
+            aQ[i] = FpQ<8, 8>(8.0 * std::sin(0.01 * i));
+            bQ[i] = FpQ<8, 8>(2.0 * std::cos(0.02 * i));
+            cQ[i] = FpQ<8, 8>(std::sin(0.03 * i));
+            a[i] = FpF16<8>::FromRaw(aQ[i].GetRawVal());
+            b[i] = FpF16<8>::FromRaw(bQ[i].GetRawVal());
+            c[i] = FpF16<8>::FromRaw(cQ[i].GetRawVal());
         }
+        const std::string qFormat = QFormat(16, 8);
+        RunArray(harness, "MultiplyAdd", "FpF16", qFormat, "FpF", arrayLength, [&](uint32_t i) {
+            out[i] = a[i] * b[i] + c[i];
+        });
+        RunArray(harness, "MultiplyAdd", "FpQ", qFormat, "FpQ", arrayLength, [&](uint32_t i) {
+            outQ[i] = FpQ<8, 8>(aQ[i] * bQ[i] + cQ[i]);
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"Hardware Float Addition", numCyclesPerTest, ExpectedRunTimes::hardwareFloatAdd_ns);
-    free(tu);
 
     //===============================================================================================//
-    //==================================== SUBTRACTION BENCHMARKING =================================//
+    //================================== ARRAY ARITHMETIC BENCHMARKING ==============================//
     //===============================================================================================//
 
-    //===== FpF32 SUBTRACTION =====//
-	tu = StartTimeMeasuring();
-	{	
-		uint32_t x = 0;
-		for(x = 0; x < numCyclesPerTest; x++) {
-			fpF32_3 = fpF32_1 - fpF32_2;
-		}
-	}
-	StopTimeMeasuring(tu);
-	PrintMetrics(tu, (char*)"FpF32 Subtraction", numCyclesPerTest, ExpectedRunTimes::fpF32Sub_ns);
-	//PrintMeasuredTime(tu);
-	free(tu);
-
-    //===== FpF64 SUBTRACTION =====//
-	tu = StartTimeMeasuring();
-	{	
-		uint32_t x = 0;
-		for(x = 0; x < numCyclesPerTest; x++) {
-			fpF64_3 = fpF64_1 - fpF64_2;
-		}
-	}
-	StopTimeMeasuring(tu);
-	PrintMetrics(tu, (char*)"FpF64 Subtraction", numCyclesPerTest, ExpectedRunTimes::fpF64Sub_ns);
-	free(tu);
-
-    //===== FpS32 SUBTRACTION =====//
-    tu = StartTimeMeasuring();
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpS32_3 = fpS32_1 - fpS32_2;
+        const uint32_t length = 64*1024;
+        std::vector<FpF32<16>> a32(length), b32(length), out32(length);
+        std::vector<FpF16<8>> a16(length), b16(length), out16(length);
+        for(uint32_t i = 0; i < length; i++) {
+            a32[i] = FpF32<16>((double)(i % 100) / 10.0);
+            b32[i] = FpF32<16>(-(double)(i % 37) / 3.7);
+            a16[i] = FpF16<8>((double)(i % 100) / 10.0);
+            b16[i] = FpF16<8>(-(double)(i % 37) / 37.0);
+        }
+        const SimdIsa bestIsa = GetSimdIsa();
+        std::vector<SimdIsa> isas(1, SimdIsa::Scalar);
+        if(bestIsa != SimdIsa::Scalar)
+            isas.push_back(bestIsa);
+
+        for(SimdIsa isa : isas) {
+            SetSimdIsa(isa);
+            const std::string variant = std::string("array-") + SimdIsaName(isa);
+
+            //===== FpF32 ARRAY MULTIPLICATION =====//
+            harness.Run("ArrayMultiply", "FpF32", q16, variant, length, [&](uint64_t iterations) {
+                for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                    ArrayMultiply(a32.data(), b32.data(), out32.data(), length);
+                    ClobberMemory();
+                }
+            });
+
+            //===== FpF16 ARRAY MULTIPLICATION =====//
+            harness.Run("ArrayMultiply", "FpF16", QFormat(16, 8), variant, length, [&](uint64_t iterations) {
+                for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                    ArrayMultiply(a16.data(), b16.data(), out16.data(), length);
+                    ClobberMemory();
+                }
+            });
         }
+        SetSimdIsa(bestIsa);
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpS32 Subtraction", numCyclesPerTest, ExpectedRunTimes::fpS32Sub_ns);
-    free(tu);
 
-    //===== FpS64 SUBTRACTION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //================================ SATURATING ARITHMETIC BENCHMARKING ===========================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpS64_3 = fpS64_1 - fpS64_2;
+        std::vector<FpF32<16>> a(arrayLength), b(arrayLength), out(arrayLength);
+        std::vector<FpFSat32<16>> aSat(arrayLength), bSat(arrayLength), outSat(arrayLength);
+        std::vector<FpS32> aS(arrayLength, FpS32(0, 16)), bS(arrayLength, FpS32(0, 16)), outS(arrayLength, FpS32(0, 16));
+        std::vector<FpSSat32> aSSat(arrayLength, FpSSat32(0, 16)), bSSat(arrayLength, FpSSat32(0, 16)), outSSat(arrayLength, FpSSat32(0, 16));
+        for(uint32_t i = 0; i < arrayLength; i++) {
+            // The inputs fit in Q15.16 but some of the sums and products do not, so that the saturating
+            // types actually saturate
+            const double aDbl = (double)(i % 1000) * 30.0;
+            const double bDbl = (double)(i % 700) * 45.0;
+            a[i] = FpF32<16>(aDbl);
+            b[i] = FpF32<16>(bDbl);
+            aSat[i] = FpFSat32<16>(aDbl);
+            bSat[i] = FpFSat32<16>(bDbl);
+            aS[i] = FpS32(aDbl, 16);
+            bS[i] = FpS32(bDbl, 16);
+            aSSat[i] = FpSSat32(aDbl, 16);
+            bSSat[i] = FpSSat32(bDbl, 16);
         }
+
+        RunArray(harness, "add", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = a[i] + b[i];
+        });
+        RunArray(harness, "add", "FpFSat32", q16, "array", arrayLength, [&](uint32_t i) {
+            outSat[i] = aSat[i] + bSat[i];
+        });
+        RunArray(harness, "mul", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = a[i] * b[i];
+        });
+        RunArray(harness, "mul", "FpFSat32", q16, "array", arrayLength, [&](uint32_t i) {
+            outSat[i] = aSat[i] * bSat[i];
+        });
+        RunArray(harness, "add", "FpS32", q16, "array", arrayLength, [&](uint32_t i) {
+            outS[i] = aS[i] + bS[i];
+        });
+        RunArray(harness, "add", "FpSSat32", q16, "array", arrayLength, [&](uint32_t i) {
+            outSSat[i] = aSSat[i] + bSSat[i];
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpS64 Subtraction", numCyclesPerTest, ExpectedRunTimes::fpS64Sub_ns);
-    free(tu);
 
-    //===== HARDWARE FLOAT SUBTRACTION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //============================== FpS MIXED-PRECISION BENCHMARKING ===============================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            float3 = float1 - float2;
+        // Long enough that the branch predictor can not learn the sequence of random num. of frac. bits
+        const uint32_t length = 64*1024;
+
+        // Operands with the same num. of frac. bits, and with a random num. of frac. bits per element (which
+        // makes the branching alignment mispredict about half the time)
+        std::vector<FpS32> aSame(length, FpS32(0, 16)), bSame(length, FpS32(0, 16));
+        std::vector<FpS32> aRandom(length, FpS32(0, 16)), bRandom(length, FpS32(0, 16));
+        std::vector<FpS32> out(length, FpS32(0, 16));
+        std::vector<uint8_t> outBool(length);
+        uint32_t random = 12345;
+        for(uint32_t i = 0; i < length; i++) {
+            const double aDbl = (double)(i % 100) / 10.0;
+            const double bDbl = -(double)(i % 37) / 3.7;
+            aSame[i] = FpS32(aDbl, 12);
+            bSame[i] = FpS32(bDbl, 12);
+            random = random * 1664525 + 1013904223;
+            aRandom[i] = FpS32(aDbl, (uint8_t)(8 + (random >> 24) % 9));
+            random = random * 1664525 + 1013904223;
+            bRandom[i] = FpS32(bDbl, (uint8_t)(8 + (random >> 24) % 9));
+        }
+
+        const std::vector<FpS32>* aInputs[] = { &aSame, &aRandom };
+        const std::vector<FpS32>* bInputs[] = { &bSame, &bRandom };
+        const char* inputNames[] = { "same-q", "random-q" };
+        for(unsigned input = 0; input < 2; input++) {
+            const std::vector<FpS32>& a = *aInputs[input];
+            const std::vector<FpS32>& b = *bInputs[input];
+            const std::string branching = std::string("array-") + inputNames[input] + "-branching";
+            const std::string branchless = std::string("array-") + inputNames[input] + "-branchless";
+
+            RunArray(harness, "add", "FpS32", "mixed", branching, length, [&](uint32_t i) {
+                out[i] = FpSAlignedAddOp<false>()(a[i], b[i]);
+            });
+            RunArray(harness, "add", "FpS32", "mixed", branchless, length, [&](uint32_t i) {
+                out[i] = FpSAlignedAddOp<true>()(a[i], b[i]);
+            });
+            RunArray(harness, "mul", "FpS32", "mixed", branching, length, [&](uint32_t i) {
+                out[i] = FpSAlignedMultiplyOp<false>()(a[i], b[i]);
+            });
+            RunArray(harness, "mul", "FpS32", "mixed", branchless, length, [&](uint32_t i) {
+                out[i] = FpSAlignedMultiplyOp<true>()(a[i], b[i]);
+            });
+            RunArray(harness, "lt", "FpS32", "mixed", branching, length, [&](uint32_t i) {
+                outBool[i] = FpSAlignedLessThanOp<false>()(a[i], b[i]);
+            });
+            RunArray(harness, "lt", "FpS32", "mixed", branchless, length, [&](uint32_t i) {
+                outBool[i] = FpSAlignedLessThanOp<true>()(a[i], b[i]);
+            });
         }
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"Hardware Float Subtraction", numCyclesPerTest, ExpectedRunTimes::hardwareFloatSub_ns);
-    free(tu);
 
     //===============================================================================================//
-    //================================== MULTIPLICATION BENCHMARKING ================================//
+    //======================================= FpSVector BENCHMARKING ================================//
     //===============================================================================================//
 
-    //===== FpF32 MULTIPLICATION =====//
-    tu = StartTimeMeasuring();
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpF32_3 = fpF32_1*fpF32_2;
+        // std::vector<FpS32> (8 bytes per element) vs. FpSVector32 (4 bytes per element). Every iteration adds and
+        // then subtracts b (and multiplies by 1.0) in-place, so the values never overflow.
+        const uint32_t length = 64*1024;
+        std::vector<FpS32> a(length, FpS32(0, 16)), b(length, FpS32(0, 16)), one(length, FpS32(1.0, 16));
+        FpSVector32 aVector(length, 16), bVector(length, 16), oneVector(length, FpS32(1.0, 16));
+        for(uint32_t i = 0; i < length; i++) {
+            a[i] = FpS32((double)(i % 100) / 10.0, 16);
+            b[i] = FpS32(-(double)(i % 37) / 3.7, 16);
+            aVector[i] = a[i];
+            bVector[i] = b[i];
         }
+
+        harness.Run("add", "FpS32", q16, "std::vector", 2*length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                for(uint32_t i = 0; i < length; i++)
+                    a[i] += b[i];
+                for(uint32_t i = 0; i < length; i++)
+                    a[i] -= b[i];
+                ClobberMemory();
+            }
+        });
+        harness.Run("add", "FpS32", q16, "FpSVector", 2*length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                aVector += bVector;
+                aVector -= bVector;
+                ClobberMemory();
+            }
+        });
+        harness.Run("mul", "FpS32", q16, "std::vector", length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                for(uint32_t i = 0; i < length; i++)
+                    a[i] *= one[i];
+                ClobberMemory();
+            }
+        });
+        harness.Run("mul", "FpS32", q16, "FpSVector", length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                aVector *= oneVector;
+                ClobberMemory();
+            }
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpF32 Multiplication", numCyclesPerTest, ExpectedRunTimes::fpF32Mul_ns);
-    free(tu);
 
-    //===== FpF64 MULTIPLICATION =====//
-    tu = StartTimeMeasuring();
-    {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpF64_3 = fpF64_1*fpF64_2;
-        }
-    }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpF64 Multiplication", numCyclesPerTest, ExpectedRunTimes::fpF64Mul_ns);
-    free(tu);
-
-    //===== FpS32 MULTIPLICATION =====//
-	tu = StartTimeMeasuring();
-	{	
-		uint32_t x = 0;
-		for(x = 0; x < numCyclesPerTest; x++) {
-			fpS32_3 = fpS32_1*fpS32_2;
-		}
-	}
-	StopTimeMeasuring(tu);
-	PrintMetrics(tu, (char*)"FpS32 Multiplication", numCyclesPerTest, ExpectedRunTimes::fpS32Mul_ns);
-	free(tu);
+    //===============================================================================================//
+    //======================================== FIR FILTER BENCHMARKING ==============================//
+    //===============================================================================================//
+
+    BenchmarkFirFilter<FpF32<16>, 16>(harness, "FpF32", q16);
+    BenchmarkFirFilter<FpF32<16>, 64>(harness, "FpF32", q16);
+    BenchmarkFirFilter<FpF32<16>, 256>(harness, "FpF32", q16);
+    BenchmarkFirFilter<FpF16<12>, 64>(harness, "FpF16", QFormat(16, 12), false);
+
+    //===============================================================================================//
+    //====================================== BIQUAD CASCADE BENCHMARKING ============================//
+    //===============================================================================================//
+
+    BenchmarkBiquadCascade<1, false>(harness);
+    BenchmarkBiquadCascade<1, true>(harness);
+    BenchmarkBiquadCascade<8, false>(harness);
+    BenchmarkBiquadCascade<8, true>(harness);
+
+    //===============================================================================================//
+    //============================================ FFT BENCHMARKING =================================//
+    //===============================================================================================//
+
+    BenchmarkFft<64>(harness, q16);
+    BenchmarkFft<256>(harness, q16);
+    BenchmarkFft<1024>(harness, q16);
+    BenchmarkFft<4096>(harness, q16);
+    BenchmarkFft<16384>(harness, q16);
+    BenchmarkFft<65536>(harness, q16);
+
+    //===============================================================================================//
+    //================================= COMPLEX ARITHMETIC BENCHMARKING =============================//
+    //===============================================================================================//
 
-    //===== FpS64 MULTIPLICATION =====//
-    tu = StartTimeMeasuring();
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpS64_3 = fpS64_1*fpS64_2;
+        typedef FpF16<15> Q15;
+        const uint32_t length = 4096;
+        std::vector<FpComplex<Q15>> a(length), b(length), out(length);
+        std::vector<Q15> aRe(length), aIm(length), bRe(length), bIm(length), outRe(length), outIm(length);
+        for(uint32_t i = 0; i < length; i++) {
+            aRe[i] = Q15(0.9 * std::sin(0.01 * i));
+            aIm[i] = Q15(0.9 * std::cos(0.01 * i));
+            bRe[i] = Q15(0.5 * std::cos(0.37 * i));
+            bIm[i] = Q15(-0.5 * std::sin(0.37 * i));
+            a[i] = FpComplex<Q15>(aRe[i], aIm[i]);
+            b[i] = FpComplex<Q15>(bRe[i], bIm[i]);
+        }
+        const std::string qFormat = QFormat(16, 15);
+
+        //===== COMPLEX MULTIPLICATION WITH FpF OPERATORS (4 MULTIPLY-SHIFTS) =====//
+        harness.Run("ComplexMultiply", "FpF16", qFormat, "FpF-operators", length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                for(uint32_t i = 0; i < length; i++) {
+                    outRe[i] = aRe[i] * bRe[i] - aIm[i] * bIm[i];
+                    outIm[i] = aRe[i] * bIm[i] + aIm[i] * bRe[i];
+                }
+                ClobberMemory();
+            }
+        });
+
+        //===== COMPLEX MULTIPLICATION WITH THE FpComplex OPERATOR =====//
+        harness.Run("ComplexMultiply", "FpF16", qFormat, "FpComplex-operator", length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                for(uint32_t i = 0; i < length; i++)
+                    out[i] = a[i] * b[i];
+                ClobberMemory();
+            }
+        });
+
+        const SimdIsa bestIsa = GetSimdIsa();
+        std::vector<SimdIsa> isas(1, SimdIsa::Scalar);
+        if(bestIsa != SimdIsa::Scalar)
+            isas.push_back(bestIsa);
+        for(SimdIsa isa : isas) {
+            SetSimdIsa(isa);
+            harness.Run("ComplexMultiply", "FpF16", qFormat, std::string("array-") + SimdIsaName(isa), length,
+                        [&](uint64_t iterations) {
+                for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                    ArrayComplexMultiply(a.data(), b.data(), out.data(), length);
+                    ClobberMemory();
+                }
+            });
         }
+        SetSimdIsa(bestIsa);
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpS64 Multiplication", numCyclesPerTest, ExpectedRunTimes::fpS64Mul_ns);
-    free(tu);
 
-    //===== SOFTWARE FLOAT MULTIPLICATION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //========================================= MATRIX BENCHMARKING =================================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            SoftFloat softFloat;
-            uint32_t rawFloat = softFloat.Multiply(reinterpret_cast<uint32_t&>(float1), reinterpret_cast<uint32_t&>(float2));
-            float3 = *(float*)&rawFloat;
-        }
-    }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"Software Float Multiplication", numCyclesPerTest, ExpectedRunTimes::softwareFloatMul_ns);
-    free(tu);
-
-    //===== HARDWARE FLOAT MULTIPLICATION =====//
-	tu = StartTimeMeasuring();	
-	{	
-		uint32_t x = 0;
-		for(x = 0; x < numCyclesPerTest; x++) {
-			float3 = float1 * float2;
-		}
-	}	
-	StopTimeMeasuring(tu);
-	PrintMetrics(tu, (char*)"Hardware Float Multiplication", numCyclesPerTest, ExpectedRunTimes::hardwareFloatMul_ns);
-	free(tu);
+        //===== 4x4 TRANSFORM OF A 4-VECTOR =====//
+        typedef FpF32<16> Q16;
+        const uint32_t length = 4096;
+        FpMatrix<Q16, 4, 4> transform;
+        for(uint32_t i = 0; i < 16; i++)
+            transform[i] = Q16(0.1 * (double)(i % 5) - 0.2);
+        std::vector<FpVec<Q16, 4>> vecs(length), outVecs(length);
+        for(uint32_t i = 0; i < length; i++) {
+            for(uint32_t j = 0; j < 4; j++)
+                vecs[i][j] = Q16(std::sin(0.01 * (4 * i + j)));
+        }
+
+        harness.Run("Transform4x4", "FpF32", q16, "FpF-operators", length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                for(uint32_t i = 0; i < length; i++) {
+                    for(uint32_t r = 0; r < 4; r++) {
+                        Q16 sum = transform(r, 0) * vecs[i][0];
+                        for(uint32_t c = 1; c < 4; c++)
+                            sum += transform(r, c) * vecs[i][c];
+                        outVecs[i][r] = sum;
+                    }
+                }
+                ClobberMemory();
+            }
+        });
+        harness.Run("Transform4x4", "FpF32", q16, "FpMatrix", length, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                for(uint32_t i = 0; i < length; i++)
+                    outVecs[i] = transform * vecs[i];
+                ClobberMemory();
+            }
+        });
+
+        //===== 256x256 BY 256x256 MATRIX MULTIPLY =====//
+        const uint32_t n = 256;
+        std::vector<Q16> a(n * n), b(n * n), out(n * n);
+        std::vector<float> aFloat(n * n), bFloat(n * n), outFloat(n * n);
+        for(uint32_t i = 0; i < n * n; i++) {
+            aFloat[i] = (float)std::sin(0.001 * i);
+            bFloat[i] = (float)std::cos(0.003 * i);
+            a[i] = Q16(aFloat[i]);
+            b[i] = Q16(bFloat[i]);
+        }
+        const std::string variant = std::to_string(n) + "x" + std::to_string(n);
+
+        harness.Run("MatrixMultiply", "FpF32", q16, variant + "-naive", 1, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                for(uint32_t i = 0; i < n; i++) {
+                    for(uint32_t j = 0; j < n; j++) {
+                        Q16 sum = Q16::FromRaw(0);
+                        for(uint32_t k = 0; k < n; k++)
+                            sum += a[i * n + k] * b[k * n + j];
+                        out[i * n + j] = sum;
+                    }
+                }
+                ClobberMemory();
+            }
+        });
+
+        const SimdIsa bestIsa = GetSimdIsa();
+        std::vector<SimdIsa> isas(1, SimdIsa::Scalar);
+        if(bestIsa != SimdIsa::Scalar)
+            isas.push_back(bestIsa);
+        for(SimdIsa isa : isas) {
+            SetSimdIsa(isa);
+            harness.Run("MatrixMultiply", "FpF32", q16, variant + "-" + SimdIsaName(isa), 1,
+                        [&](uint64_t iterations) {
+                for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                    MatrixMultiply(a.data(), b.data(), out.data(), n, n, n);
+                    ClobberMemory();
+                }
+            });
+        }
+        SetSimdIsa(bestIsa);
+
+        //===== FLOAT REFERENCE (i-k-j LOOP ORDER, SO THE INNER LOOP VECTORIZES) =====//
+        harness.Run("MatrixMultiply", "float", "float", variant, 1, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                std::fill(outFloat.begin(), outFloat.end(), 0.0f);
+                for(uint32_t i = 0; i < n; i++) {
+                    for(uint32_t k = 0; k < n; k++) {
+                        const float aik = aFloat[i * n + k];
+                        for(uint32_t j = 0; j < n; j++)
+                            outFloat[i * n + j] += aik * bFloat[k * n + j];
+                    }
+                }
+                ClobberMemory();
+            }
+        });
+    }
 
     //===============================================================================================//
-    //======================================= DIVISION BENCHMARKING =================================//
+    //================================ FLOAT CONVERSION BENCHMARKING ================================//
     //===============================================================================================//
 
-    //===== FpF32 DIVISION =====//
-    tu = StartTimeMeasuring();
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++)
-        {
-            fpF32_3 = fpF32_1/fpF32_2;
-        }
+        // Converting a frame of floats to FpF32 and back
+        std::vector<float> floats(arrayLength), floatsOut(arrayLength);
+        for(uint32_t i = 0; i < arrayLength; i++)
+            floats[i] = 1000.0f * std::sin(0.01f * (float) i);
+        std::vector<FpF32<16>> values(arrayLength);
+
+        RunArray(harness, "FromFloat", "FpF32", q16, "constructor", arrayLength, [&](uint32_t i) {
+            values[i] = FpF32<16>(floats[i]);
+        });
+        RunArray(harness, "FromFloat", "FpF32", q16, "FromFloat", arrayLength, [&](uint32_t i) {
+            values[i] = FromFloat<FpF32<16>>(floats[i]);
+        });
+        RunArray(harness, "ToFloat", "FpF32", q16, "ToFloat", arrayLength, [&](uint32_t i) {
+            floatsOut[i] = values[i].ToFloat();
+        });
 
+        const SimdIsa bestIsa = GetSimdIsa();
+        std::vector<SimdIsa> isas(1, SimdIsa::Scalar);
+        if(bestIsa != SimdIsa::Scalar)
+            isas.push_back(bestIsa);
+        for(SimdIsa isa : isas) {
+            SetSimdIsa(isa);
+            const std::string variant = std::string("array-") + SimdIsaName(isa);
+            harness.Run("FromFloat", "FpF32", q16, variant, arrayLength, [&](uint64_t iterations) {
+                for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                    ArrayFromFloat(floats.data(), values.data(), arrayLength);
+                    ClobberMemory();
+                }
+            });
+            harness.Run("FromFloat", "FpF32", q16, variant + "-unchecked", arrayLength, [&](uint64_t iterations) {
+                for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                    ArrayFromFloat<RoundingMode::HalfEven, OverflowMode::Unchecked>(floats.data(), values.data(),
+                                                                                    arrayLength);
+                    ClobberMemory();
+                }
+            });
+            harness.Run("ToFloat", "FpF32", q16, variant, arrayLength, [&](uint64_t iterations) {
+                for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                    ArrayToFloat(values.data(), floatsOut.data(), arrayLength);
+                    ClobberMemory();
+                }
+            });
+        }
+        SetSimdIsa(bestIsa);
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpF32 Division", numCyclesPerTest, ExpectedRunTimes::fpF32Div_ns);
-    free(tu);
 
-    //===== FpF64 DIVISION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //===================================== STRING FORMATTING BENCHMARKING ==========================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpF64_3 = fpF64_1/fpF64_2;
+        std::vector<FpF32<16>> values(arrayLength);
+        for(uint32_t i = 0; i < arrayLength; i++)
+            values[i] = FpF32<16>(1000.0 * std::sin(0.01 * i));
+        std::vector<char> buffer(arrayLength * 32);
+        std::size_t totalLength = 0;
+
+        //===== THE OLD ToString(), VIA A DOUBLE AND A HEAP ALLOCATED STRING =====//
+        RunArray(harness, "ToString", "FpF32", q16, "std::to_string", arrayLength, [&](uint32_t i) {
+            totalLength += std::to_string(values[i].ToDouble()).size();
+        });
+        RunArray(harness, "ToString", "FpF32", q16, "ToString", arrayLength, [&](uint32_t i) {
+            totalLength += values[i].ToString().size();
+        });
+        RunArray(harness, "ToChars", "FpF32", q16, "6-digits", arrayLength, [&](uint32_t i) {
+            totalLength += (std::size_t) (values[i].ToChars(&buffer[i * 32], &buffer[i * 32] + 32, 6).ptr -
+                                          &buffer[i * 32]);
+        });
+        RunArray(harness, "ToChars", "FpF32", q16, "exact", arrayLength, [&](uint32_t i) {
+            totalLength += (std::size_t) (values[i].ToChars(&buffer[i * 32], &buffer[i * 32] + 32).ptr -
+                                          &buffer[i * 32]);
+        });
+        harness.Run("ArrayToChars", "FpF32", q16, "6-digits", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                ToCharsResult result = ArrayToChars(values.data(), arrayLength, buffer.data(),
+                                                    buffer.data() + buffer.size(), ',', 6);
+                DoNotOptimize(result);
+                ClobberMemory();
+            }
+        });
+
+        //===== PARSING A COLUMN OF NUMBERS WITH 4 DECIMAL PLACES (LIKE A CSV FILE OF SENSOR DATA) =====//
+        const ToCharsResult column = ArrayToChars(values.data(), arrayLength, buffer.data(),
+                                                  buffer.data() + buffer.size(), '\n', 4);
+        std::vector<FpF32<16>> parsed(arrayLength);
+        harness.Run("ParseColumn", "FpF32", q16, "strtod", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                const char* p = buffer.data();
+                for(uint32_t i = 0; i < arrayLength; i++) {
+                    char* end;
+                    parsed[i] = FpF32<16>(strtod(p, &end));
+                    p = end + 1;
+                }
+                ClobberMemory();
+            }
+        });
+        harness.Run("ParseColumn", "FpF32", q16, "FromChars", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                const char* p = buffer.data();
+                for(uint32_t i = 0; i < arrayLength; i++)
+                    p = FpF32<16>::FromChars(p, column.ptr, parsed[i]).ptr + 1;
+                ClobberMemory();
+            }
+        });
+        const SimdIsa bestIsa = GetSimdIsa();
+        std::vector<SimdIsa> isas(1, SimdIsa::Scalar);
+        if(bestIsa != SimdIsa::Scalar)
+            isas.push_back(bestIsa);
+        for(SimdIsa isa : isas) {
+            SetSimdIsa(isa);
+            harness.Run("ParseColumn", "FpF32", q16, SimdIsaName(isa), arrayLength, [&](uint64_t iterations) {
+                for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                    ParseColumnResult result = ParseColumn(buffer.data(), column.ptr, parsed.data(), arrayLength);
+                    DoNotOptimize(result);
+                    ClobberMemory();
+                }
+            });
         }
+        SetSimdIsa(bestIsa);
+        DoNotOptimize(totalLength);
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpF64 Division", numCyclesPerTest, ExpectedRunTimes::fpF64Div_ns);
-    free(tu);
 
-    //===== FpS32 DIVISION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //=================================== BINARY SERIALIZATION BENCHMARKING =========================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpS32_3 = fpS32_1*fpS32_2;
+        std::vector<FpF32<16>> values(arrayLength);
+        std::vector<FpS32> fpsValues;
+        for(uint32_t i = 0; i < arrayLength; i++) {
+            values[i] = FpF32<16>(1000.0 * std::sin(0.01 * i));
+            fpsValues.push_back(FpS32(1000.0 * std::sin(0.01 * i), (uint8_t) (16 + i % 3)));
         }
+        std::vector<uint64_t> buffer(WriteFpBinary(nullptr, 0, values.data(), arrayLength) / 8);
+        std::vector<uint64_t> fpsBuffer(WriteFpBinary(nullptr, 0, fpsValues.data(), arrayLength) / 8 + 1);
+        std::vector<FpF32<16>> read;
+
+        harness.Run("WriteFpBinary", "FpF32", q16, "array", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                WriteFpBinary(buffer.data(), buffer.size() * 8, values.data(), arrayLength);
+                ClobberMemory();
+            }
+        });
+        harness.Run("WriteFpBinary", "FpS32", "mixed", "256-blocks", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                WriteFpBinary(fpsBuffer.data(), fpsBuffer.size() * 8, fpsValues.data(), arrayLength);
+                ClobberMemory();
+            }
+        });
+        harness.Run("ReadFpBinary", "FpF32", q16, "copy", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                FpBinaryError error = ReadFpBinary(buffer.data(), buffer.size() * 8, read);
+                DoNotOptimize(error);
+                ClobberMemory();
+            }
+        });
+        // In place, so the cost doesn't depend on the num. of values
+        harness.Run("ReadFpBinary", "FpF32", q16, "view", arrayLength, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                FpFSpan<FpF32<16>> span;
+                FpBinaryError error = ViewFpBinary(buffer.data(), buffer.size() * 8, span);
+                DoNotOptimize(error);
+                DoNotOptimize(span);
+                ClobberMemory();
+            }
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpS32 Division", numCyclesPerTest, ExpectedRunTimes::fpS32Div_ns);
-    free(tu);
 
-    //===== FpS64 DIVISION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //==================================== BLOCK FLOATING-POINT BENCHMARKING ========================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            fpS64_3 = fpS64_1/fpS64_2;
+        // Element-wise operations on blocks of 64 numbers (reported per element), compared to float
+        const std::size_t blockSize = 64;
+        typedef BlockFp32<blockSize> Block;
+        std::vector<FpS32> aFpS, bFpS;
+        std::vector<float> aFloat(blockSize), bFloat(blockSize), outFloat(blockSize);
+        for(std::size_t i = 0; i < blockSize; i++) {
+            aFloat[i] = (float)(i % 10) / 10.0f;
+            bFloat[i] = -(float)(i % 7) / 7.0f;
+            aFpS.push_back(FpS32(aFloat[i], 24));
+            bFpS.push_back(FpS32(bFloat[i], 24));
         }
+        const Block a = Block::FromFpS(aFpS.data());
+        const Block b = Block::FromFpS(bFpS.data());
+        Block out;
+        const std::string q = "block";
+
+        harness.Run("add", "BlockFp32", q, "block-64", blockSize, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                out = a + b;
+                DoNotOptimize(out);
+            }
+        });
+        harness.Run("mul", "BlockFp32", q, "block-64", blockSize, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                out = a * b;
+                DoNotOptimize(out);
+            }
+        });
+        harness.Run("MultiplyAccumulate", "BlockFp32", q, "block-64", blockSize, [&](uint64_t iterations) {
+            Block acc;
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                acc.MultiplyAccumulate(a, b);
+                DoNotOptimize(acc);
+            }
+        });
+        harness.Run("FromFpS+ToFpS", "BlockFp32", q, "block-64", blockSize, [&](uint64_t iterations) {
+            for(uint64_t iteration = 0; iteration < iterations; iteration++) {
+                out = Block::FromFpS(aFpS.data());
+                out.ToFpS(bFpS.data());
+                ClobberMemory();
+            }
+        });
+        RunArray(harness, "mul", "float", "float", "block-64", blockSize, [&](uint32_t i) {
+            outFloat[i] = aFloat[i] * bFloat[i];
+        });
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"FpS64 Division", numCyclesPerTest, ExpectedRunTimes::fpS64Div_ns);
-    free(tu);
 
-    //===== HARDWARE FLOAT DIVISION =====//
-    tu = StartTimeMeasuring();
+    //===============================================================================================//
+    //=================================== ROUNDING MODE BENCHMARKING ================================//
+    //===============================================================================================//
+
     {
-        uint32_t x = 0;
-        for(x = 0; x < numCyclesPerTest; x++) {
-            float3 = float1 / float2;
+        std::vector<FpF32<16>> a(arrayLength), b(arrayLength), out(arrayLength);
+        for(uint32_t i = 0; i < arrayLength; i++) {
+            a[i] = FpF32<16>((double)(i % 100) / 10.0);
+            b[i] = FpF32<16>(-(double)(i % 37) / 3.7);
         }
+
+        RunArray(harness, "Multiply<Truncate>", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = Multiply<RoundingMode::Truncate>(a[i], b[i]);
+        });
+        RunArray(harness, "Multiply<HalfUp>", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = Multiply<RoundingMode::HalfUp>(a[i], b[i]);
+        });
+        RunArray(harness, "Multiply<HalfEven>", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = Multiply<RoundingMode::HalfEven>(a[i], b[i]);
+        });
+        RunArray(harness, "Multiply<Stochastic>", "FpF32", q16, "array", arrayLength, [&](uint32_t i) {
+            out[i] = Multiply<RoundingMode::Stochastic>(a[i], b[i]);
+        });
+    }
+
+    //===============================================================================================//
+    //============================================ OUTPUT ===========================================//
+    //===============================================================================================//
+
+    if(!options.jsonPath.empty() && !harness.WriteJson(options.jsonPath)) {
+        fprintf(stderr, "Could not write \"%s\".\n", options.jsonPath.c_str());
+        return 1;
+    }
+    if(!options.csvPath.empty() && !harness.WriteCsv(options.csvPath)) {
+        fprintf(stderr, "Could not write \"%s\".\n", options.csvPath.c_str());
+        return 1;
     }
-    StopTimeMeasuring(tu);
-    PrintMetrics(tu, (char*)"Hardware Float Division", numCyclesPerTest, ExpectedRunTimes::hardwareFloatDiv_ns);
-    free(tu);
+    return 0;
 }
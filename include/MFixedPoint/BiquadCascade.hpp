@@ -0,0 +1,290 @@
+///
+/// \file 				BiquadCascade.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				A cascade of biquad (second-order IIR) filter sections for FpF numbers.
+/// \details
+///		Each section is Direct Form I, accumulating all five products in OverflowType and only shifting
+///		(truncating) once per output, optionally with first-order error feedback (the truncation error of
+///		the previous output is added to the accumulator), which removes the DC bias and most of the limit
+///		cycles truncation causes. Several channels can be processed at once, interleaved. FpF32 cascades with
+///		4 or more channels are processed 4 channels at a time by an AVX2 kernel (which gives identical
+///		results) when the CPU supports it.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_BIQUAD_CASCADE_H
+#define MN_MFIXEDPOINT_BIQUAD_CASCADE_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+
+#include <type_traits>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFArray.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+namespace detail {
+
+#if MN_MFIXEDPOINT_X86_SIMD
+
+    /// \brief      Gathers the low 32 bits of the four 64-bit lanes of x.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline __m128i LowHalvesAvx2(__m256i x) {
+        return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+    }
+
+    /// \brief      Processes channels 0 to numVectorChannels - 1 (a multiple of 4) of an FpF32 biquad cascade, 4
+    ///             channels at a time in 64-bit lanes.
+    /// \details    The arrays have the same layout as the BiquadCascade members. error is nullptr without error
+    ///             feedback. Each group of 4 channels is run through every frame with its state held in 64-bit
+    ///             lanes, where only the low 32 bits are meaningful: _mm256_mul_epi32() ignores the high 32 bits,
+    ///             so samples never have to be sign-extended between sections. For the same reason a logical shift
+    ///             of the accumulator gives the same result as an arithmetic one, and the truncation error is just
+    ///             the bits below numFracBits.
+    template<std::size_t numSections>
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void BiquadCascadeAvx2(const int32_t* coefficients, int32_t* delay1, int32_t* delay2, int32_t* error,
+                                  std::size_t numChannels, std::size_t numVectorChannels,
+                                  const int32_t* in, int32_t* out, std::size_t numFrames, uint8_t numFracBits) {
+        const __m128i shift = _mm_cvtsi32_si128(numFracBits);
+        const __m256i errorMask = _mm256_set1_epi64x(((int64_t) 1 << numFracBits) - 1);
+        __m256i h[numSections][5];
+        for(std::size_t s = 0; s < numSections; s++) {
+            for(std::size_t k = 0; k < 5; k++)
+                h[s][k] = _mm256_set1_epi64x(coefficients[5*s + k]);
+        }
+
+        for(std::size_t c = 0; c < numVectorChannels; c += 4) {
+            __m256i d1[numSections + 1], d2[numSections + 1], e[numSections];
+            for(std::size_t s = 0; s <= numSections; s++) {
+                d1[s] = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) (delay1 + s*numChannels + c)));
+                d2[s] = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) (delay2 + s*numChannels + c)));
+                if(s < numSections)
+                    e[s] = error ? _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) (error + s*numChannels + c)))
+                                 : _mm256_setzero_si256();
+            }
+
+            for(std::size_t n = 0; n < numFrames; n++) {
+                __m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) (in + n*numChannels + c)));
+                for(std::size_t s = 0; s < numSections; s++) {
+                    __m256i acc = _mm256_mul_epi32(x, h[s][0]);
+                    acc = _mm256_add_epi64(acc, _mm256_mul_epi32(d1[s], h[s][1]));
+                    acc = _mm256_add_epi64(acc, _mm256_mul_epi32(d2[s], h[s][2]));
+                    acc = _mm256_sub_epi64(acc, _mm256_mul_epi32(d1[s + 1], h[s][3]));
+                    acc = _mm256_sub_epi64(acc, _mm256_mul_epi32(d2[s + 1], h[s][4]));
+                    if(error) {
+                        acc = _mm256_add_epi64(acc, e[s]);
+                        e[s] = _mm256_and_si256(acc, errorMask);
+                    }
+                    d2[s] = d1[s];
+                    d1[s] = x;
+                    x = _mm256_srl_epi64(acc, shift);
+                }
+                d2[numSections] = d1[numSections];
+                d1[numSections] = x;
+                _mm_storeu_si128((__m128i*) (out + n*numChannels + c), LowHalvesAvx2(x));
+            }
+
+            for(std::size_t s = 0; s <= numSections; s++) {
+                _mm_storeu_si128((__m128i*) (delay1 + s*numChannels + c), LowHalvesAvx2(d1[s]));
+                _mm_storeu_si128((__m128i*) (delay2 + s*numChannels + c), LowHalvesAvx2(d2[s]));
+                if(error && s < numSections)
+                    _mm_storeu_si128((__m128i*) (error + s*numChannels + c), LowHalvesAvx2(e[s]));
+            }
+        }
+    }
+
+#endif // #if MN_MFIXEDPOINT_X86_SIMD
+
+} // namespace detail
+
+/// \brief      A cascade of numSections biquads, each y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2].
+/// \details    FpFType must be an FpF type (e.g. FpF32<28>). Every channel uses the same coefficients. If
+///             errorFeedback is true, each section adds the truncation error of its previous output to the next.
+template<class FpFType, std::size_t numSections, std::size_t numChannels = 1, bool errorFeedback = false>
+class BiquadCascade;
+
+template<class BaseType, class OverflowType, uint8_t numFracBits, std::size_t numSections, std::size_t numChannels,
+         bool errorFeedback>
+class BiquadCascade<FpF<BaseType, OverflowType, numFracBits>, numSections, numChannels, errorFeedback> {
+
+    static_assert(numSections > 0, "A biquad cascade must have at least one section.");
+    static_assert(numChannels > 0, "A biquad cascade must have at least one channel.");
+
+public:
+
+    typedef FpF<BaseType, OverflowType, numFracBits> FpFType;
+
+    /// \brief      The coefficients of one section (normalised so that a0 = 1).
+    struct Coefficients {
+        FpFType b0, b1, b2, a1, a2;
+    };
+
+    //===============================================================================================//
+    //================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+    //===============================================================================================//
+
+    /// \brief      Creates a cascade where every section passes its input straight through (b0 = 1).
+    BiquadCascade() {
+        Coefficients passThrough;
+        passThrough.b0 = FpFType(1);
+        passThrough.b1 = passThrough.b2 = passThrough.a1 = passThrough.a2 = FpFType(0);
+        for(std::size_t s = 0; s < numSections; s++)
+            SetCoefficients(s, passThrough);
+        Reset();
+    }
+
+    /// \brief      Creates a cascade with the numSections coefficients in sections (the first is applied first).
+    explicit BiquadCascade(const Coefficients* sections) {
+        for(std::size_t s = 0; s < numSections; s++)
+            SetCoefficients(s, sections[s]);
+        Reset();
+    }
+
+    //===============================================================================================//
+    //========================================= GETTERS/SETTERS =====================================//
+    //===============================================================================================//
+
+    /// \brief      Sets the coefficients of one section. Does not reset the state.
+    void SetCoefficients(std::size_t section, const Coefficients& coefficients) {
+        coefficients_[section][0] = coefficients.b0.GetRawVal();
+        coefficients_[section][1] = coefficients.b1.GetRawVal();
+        coefficients_[section][2] = coefficients.b2.GetRawVal();
+        coefficients_[section][3] = coefficients.a1.GetRawVal();
+        coefficients_[section][4] = coefficients.a2.GetRawVal();
+    }
+
+    Coefficients GetCoefficients(std::size_t section) const {
+        Coefficients coefficients;
+        coefficients.b0 = FpFType::FromRaw(coefficients_[section][0]);
+        coefficients.b1 = FpFType::FromRaw(coefficients_[section][1]);
+        coefficients.b2 = FpFType::FromRaw(coefficients_[section][2]);
+        coefficients.a1 = FpFType::FromRaw(coefficients_[section][3]);
+        coefficients.a2 = FpFType::FromRaw(coefficients_[section][4]);
+        return coefficients;
+    }
+
+    /// \brief      Sets the state (delayed samples and truncation errors) of every section and channel to 0.
+    void Reset() {
+        for(std::size_t s = 0; s <= numSections; s++) {
+            for(std::size_t c = 0; c < numChannels; c++) {
+                delay1_[s][c] = 0;
+                delay2_[s][c] = 0;
+            }
+        }
+        for(std::size_t s = 0; s < numSections; s++) {
+            for(std::size_t c = 0; c < numChannels; c++)
+                error_[s][c] = 0;
+        }
+    }
+
+    //===============================================================================================//
+    //========================================== PROCESSING =========================================//
+    //===============================================================================================//
+
+    /// \brief      Processes one sample (only for a single channel).
+    FpFType Process(FpFType sample) {
+        static_assert(numChannels == 1, "Use Process(in, out, numFrames) for more than one channel.");
+        FpFType output;
+        Process(&sample, &output, 1);
+        return output;
+    }
+
+    /// \brief      Processes numFrames frames of interleaved samples (in[n*numChannels + c] is sample n of
+    ///             channel c), writing the outputs to out in the same order.
+    /// \details    Every frame passes through all the sections before the next one is read. out may be the same
+    ///             array as in.
+    void Process(const FpFType* in, FpFType* out, std::size_t numFrames) {
+        std::size_t firstChannel = 0;
+#if MN_MFIXEDPOINT_X86_SIMD
+        if(std::is_same<BaseType, int32_t>::value && std::is_same<OverflowType, int64_t>::value && numChannels >= 4 &&
+           detail::ActiveSimdIsa() >= SimdIsa::Avx2) {
+            static_assert(sizeof(FpFType) == sizeof(BaseType),
+                          "FpF arrays must have the same memory layout as arrays of BaseType.");
+            firstChannel = numChannels / 4 * 4;
+            detail::BiquadCascadeAvx2<numSections>(reinterpret_cast<const int32_t*>(&coefficients_[0][0]),
+                                      reinterpret_cast<int32_t*>(&delay1_[0][0]),
+                                      reinterpret_cast<int32_t*>(&delay2_[0][0]),
+                                      errorFeedback ? reinterpret_cast<int32_t*>(&error_[0][0]) : nullptr,
+                                      numChannels, firstChannel,
+                                      reinterpret_cast<const int32_t*>(in), reinterpret_cast<int32_t*>(out),
+                                      numFrames, numFracBits);
+        }
+#endif
+        if(firstChannel < numChannels)
+            ProcessChannels(in, out, numFrames, firstChannel);
+    }
+
+private:
+
+    /// \brief      The portable implementation of Process(), for channels firstChannel to numChannels - 1.
+    void ProcessChannels(const FpFType* in, FpFType* out, std::size_t numFrames, std::size_t firstChannel) {
+        for(std::size_t n = 0; n < numFrames; n++) {
+            BaseType x[numChannels];
+            for(std::size_t c = firstChannel; c < numChannels; c++)
+                x[c] = in[n*numChannels + c].GetRawVal();
+
+            for(std::size_t s = 0; s < numSections; s++) {
+                const BaseType* h = coefficients_[s];
+                // delay1_[s + 1]/delay2_[s + 1] are both this section's delayed outputs and the next section's
+                // delayed inputs
+                for(std::size_t c = firstChannel; c < numChannels; c++) {
+                    OverflowType acc = (OverflowType) h[0] * x[c] +
+                                       (OverflowType) h[1] * delay1_[s][c] +
+                                       (OverflowType) h[2] * delay2_[s][c] -
+                                       (OverflowType) h[3] * delay1_[s + 1][c] -
+                                       (OverflowType) h[4] * delay2_[s + 1][c];
+                    if(errorFeedback)
+                        acc += error_[s][c];
+                    const BaseType y = (BaseType) (acc >> numFracBits);
+                    if(errorFeedback)
+                        error_[s][c] = (BaseType) (acc - (OverflowType) y * ((OverflowType) 1 << numFracBits));
+                    delay2_[s][c] = delay1_[s][c];
+                    delay1_[s][c] = x[c];
+                    x[c] = y;
+                }
+            }
+
+            for(std::size_t c = firstChannel; c < numChannels; c++) {
+                delay2_[numSections][c] = delay1_[numSections][c];
+                delay1_[numSections][c] = x[c];
+                out[n*numChannels + c] = FpFType::FromRaw(x[c]);
+            }
+        }
+    }
+
+    /// \brief      The raw b0, b1, b2, a1 and a2 of each section.
+    BaseType coefficients_[numSections][5];
+
+    /// \brief      delay1_[s][c]/delay2_[s][c] are the input to section s (the output of section s - 1) of channel
+    ///             c, delayed by 1 and 2 samples. delay1_[numSections] is the delayed output of the cascade.
+    BaseType delay1_[numSections + 1][numChannels];
+    BaseType delay2_[numSections + 1][numChannels];
+
+    /// \brief      The truncation error of the previous output of each section, with numFracBits fractional bits
+    ///             (only used with errorFeedback).
+    BaseType error_[numSections][numChannels];
+
+};
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_BIQUAD_CASCADE_H
+
+// EOF
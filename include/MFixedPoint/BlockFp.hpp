@@ -0,0 +1,349 @@
+///
+/// \file 				BlockFp.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				Block floating-point numbers, a block of integer mantissas which share one exponent.
+/// \details
+///		Where FpS stores an exponent (the num. of fractional bits) with every number, BlockFp stores one for
+///		a whole block of numbers. After every operation the block is renormalised (using a count-leading-zeros)
+///		so the largest mantissa uses the full width of the BaseType. This gives close to floating-point
+///		dynamic range between blocks while the arithmetic within a block is integer (and SIMD) arithmetic.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_BLOCK_FP_H
+#define MN_MFIXEDPOINT_BLOCK_FP_H
+
+// System includes
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+
+// User includes
+#include "MFixedPoint/FpFArray.hpp"
+#include "MFixedPoint/FpFMath.hpp"
+#include "MFixedPoint/FpS.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+namespace detail {
+
+	/// \brief		Returns the num. of bits x can be shifted left by without overflowing (the num. of redundant
+	///				sign bits). Returns numBits - 1 for 0 and -1.
+	template <class BaseType>
+	int Headroom(BaseType x) {
+		typedef typename std::make_unsigned<BaseType>::type UnsignedType;
+		const int numBits = (int)sizeof(BaseType)*8;
+		const UnsignedType norm = (UnsignedType)(x ^ (x >> (numBits - 1)));
+		return CountLeadingZeros((uint64_t)norm) - (64 - numBits) - 1;
+	}
+
+	/// \brief		Shifts x left if shift is positive, right (rounding towards negative infinity) if it is negative.
+	/// \details	Shifts of the full width of the BaseType (or more) are limited to numBits - 1.
+	template <class BaseType>
+	BaseType ShiftRaw(BaseType x, int shift) {
+		typedef typename std::make_unsigned<BaseType>::type UnsignedType;
+		const int maxShift = (int)sizeof(BaseType)*8 - 1;
+		if(shift >= 0)
+			return (BaseType)((UnsignedType)x << (shift < maxShift ? shift : maxShift));
+		return (BaseType)(x >> (-shift < maxShift ? -shift : maxShift));
+	}
+
+} // namespace detail
+
+/// \brief		A block of BlockSize numbers, stored as BaseType mantissas which share one exponent (the value of
+///				element i is mantissa[i] * 2^exponent).
+/// \details	The arithmetic operators work element-wise and renormalise the result. Addition and subtraction
+///				align the two blocks to the larger exponent, and only lose a bit if the result would overflow.
+///				Multiplication keeps the most significant numBits - 1 bits of every product.
+template <class BaseType, class OverflowType, std::size_t BlockSize>
+class BlockFp {
+
+	public:
+
+	typedef FpS<BaseType, OverflowType> FpSType;
+
+	static constexpr std::size_t blockSize = BlockSize;
+
+	/// \brief		The exponent of a block of zeros. It is small enough that a block of zeros never limits the
+	///				precision of a block it is added to, and large enough that multiplying never overflows it.
+	static constexpr int zeroExponent = -(1 << 24);
+
+	//===============================================================================================//
+	//================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+	//===============================================================================================//
+
+	/// \brief		Creates a block of zeros.
+	BlockFp() :
+			exponent_(zeroExponent) {
+		for(std::size_t i = 0; i < BlockSize; i++)
+			mantissas_[i] = 0;
+	}
+
+	/// \brief		Creates a block from BlockSize raw mantissas and their shared exponent. Does not normalise.
+	static BlockFp FromRaw(const BaseType* mantissas, int exponent) {
+		BlockFp block;
+		for(std::size_t i = 0; i < BlockSize; i++)
+			block.mantissas_[i] = mantissas[i];
+		block.exponent_ = exponent;
+		return block;
+	}
+
+	/// \brief		Creates a normalised block from BlockSize FpS numbers.
+	/// \details	Uses the smallest exponent which every number fits in, so the conversion is exact whenever the
+	///				numbers can be represented with one exponent (e.g. they all have the same num. of fractional
+	///				bits). Otherwise the least significant bits of the numbers with the most fractional bits are lost.
+	static BlockFp FromFpS(const FpSType* values) {
+		BlockFp block;
+		bool isZero = true;
+		int exponent = INT_MIN;
+		for(std::size_t i = 0; i < BlockSize; i++) {
+			const BaseType rawVal = values[i].GetRawVal();
+			if(rawVal == 0)
+				continue;
+			const int minExponent = -(int)values[i].GetNumFracBits() - detail::Headroom(rawVal);
+			exponent = minExponent > exponent ? minExponent : exponent;
+			isZero = false;
+		}
+		if(isZero)
+			return block;
+		for(std::size_t i = 0; i < BlockSize; i++)
+			block.mantissas_[i] = detail::ShiftRaw(values[i].GetRawVal(), -(int)values[i].GetNumFracBits() - exponent);
+		block.exponent_ = exponent;
+		return block;
+	}
+
+	//===============================================================================================//
+	//========================================= GETTERS/SETTERS =====================================//
+	//===============================================================================================//
+
+	const BaseType* GetMantissas() const {
+		return mantissas_;
+	}
+
+	BaseType GetMantissa(std::size_t i) const {
+		return mantissas_[i];
+	}
+
+	int GetExponent() const {
+		return exponent_;
+	}
+
+	//===============================================================================================//
+	//========================================== CONVERSIONS ========================================//
+	//===============================================================================================//
+
+	/// \brief		Converts element i to an FpS number.
+	/// \details	Exact whenever the number can be represented by an FpS with 0 to numBits - 1 fractional bits.
+	///				Numbers too large wrap around, and bits below 2^-(numBits - 1) are lost.
+	FpSType ToFpS(std::size_t i) const {
+		const int maxNumFracBits = numBits - 1;
+		int numFracBits = -exponent_;
+		BaseType rawVal = mantissas_[i];
+		if(numFracBits > maxNumFracBits) {
+			rawVal = detail::ShiftRaw(rawVal, maxNumFracBits - numFracBits);
+			numFracBits = maxNumFracBits;
+		} else if(numFracBits < 0) {
+			rawVal = detail::ShiftRaw(rawVal, -numFracBits);
+			numFracBits = 0;
+		}
+		return FpSType::FromRaw(rawVal, (uint8_t)numFracBits);
+	}
+
+	/// \brief		Converts every element to an FpS number, see ToFpS(std::size_t).
+	void ToFpS(FpSType* values) const {
+		for(std::size_t i = 0; i < BlockSize; i++)
+			values[i] = ToFpS(i);
+	}
+
+	double ToDouble(std::size_t i) const {
+		return std::ldexp((double)mantissas_[i], exponent_);
+	}
+
+	//===============================================================================================//
+	//========================================= NORMALISATION =======================================//
+	//===============================================================================================//
+
+	/// \brief		Shifts every mantissa left by the headroom of the largest one (so it uses the full width of the
+	///				BaseType), and adjusts the exponent to match. Blocks of zeros get the exponent zeroExponent.
+	void Normalise() {
+		BaseType norm = 0;
+		BaseType any = 0;
+		for(std::size_t i = 0; i < BlockSize; i++)
+			AccumulateNorm(mantissas_[i], norm, any);
+		StoreNormalised(mantissas_, norm, any);
+	}
+
+	//===============================================================================================//
+	//================================== COMPOUND ARITHMETIC OPERATORS ==============================//
+	//===============================================================================================//
+
+	BlockFp& operator += (const BlockFp& r) {
+		AddOrSubtract<false>(r);
+		return *this;
+	}
+
+	BlockFp& operator -= (const BlockFp& r) {
+		AddOrSubtract<true>(r);
+		return *this;
+	}
+
+	BlockFp& operator *= (const BlockFp& r) {
+		// The products fit in numBits after a shift of numBits - 1, except for min*min
+		const BaseType minVal = std::numeric_limits<BaseType>::min();
+		bool isMinTimesMin = false;
+		for(std::size_t i = 0; i < BlockSize; i++)
+			isMinTimesMin |= (mantissas_[i] == minVal) & (r.mantissas_[i] == minVal);
+		const uint8_t shift = (uint8_t)(isMinTimesMin ? numBits : numBits - 1);
+		// Same kernel as FpF array multiplication (SIMD for 16 and 32-bit mantissas)
+		detail::ArrayOpDispatch<BaseType, OverflowType>(detail::ArrayOp::Multiply, mantissas_, r.mantissas_,
+														mantissas_, BlockSize, shift);
+		exponent_ += r.exponent_ + shift;
+		Normalise();
+		return *this;
+	}
+
+	/// \brief		Adds a * b (element-wise) to this block.
+	BlockFp& MultiplyAccumulate(const BlockFp& a, const BlockFp& b) {
+		BlockFp product = a;
+		product *= b;
+		return *this += product;
+	}
+
+	//===============================================================================================//
+	//==================================== SIMPLE ARITHMETIC OPERATORS ==============================//
+	//===============================================================================================//
+
+	BlockFp operator + (const BlockFp& r) const {
+		BlockFp x = *this;
+		x += r;
+		return x;
+	}
+
+	BlockFp operator - (const BlockFp& r) const {
+		BlockFp x = *this;
+		x -= r;
+		return x;
+	}
+
+	BlockFp operator * (const BlockFp& r) const {
+		BlockFp x = *this;
+		x *= r;
+		return x;
+	}
+
+	private:
+
+	typedef typename std::make_unsigned<BaseType>::type UnsignedType;
+
+	static constexpr int numBits = (int)sizeof(BaseType)*8;
+
+	/// \brief		OR-s the magnitude of x (the one's complement if it is negative) into norm, and x into any.
+	/// \details	norm ends up with the highest set bit of the largest magnitude, so only one count-leading-zeros
+	///				is needed for the whole block.
+	static void AccumulateNorm(BaseType x, BaseType& norm, BaseType& any) {
+		norm |= (BaseType)(x ^ (x >> (numBits - 1)));
+		any |= x;
+	}
+
+	/// \brief		Stores values (whose AccumulateNorm() results are norm and any) in the mantissas, shifted left
+	///				by the headroom of the largest one. Subtracts the shift from the exponent.
+	void StoreNormalised(const BaseType* values, BaseType norm, BaseType any) {
+		if(any == 0) {
+			for(std::size_t i = 0; i < BlockSize; i++)
+				mantissas_[i] = 0;
+			exponent_ = zeroExponent;
+			return;
+		}
+		const int headroom = detail::Headroom(norm);
+		for(std::size_t i = 0; i < BlockSize; i++)
+			mantissas_[i] = (BaseType)((UnsignedType)values[i] << headroom);
+		exponent_ -= headroom;
+	}
+
+	/// \brief		Aligns both blocks to the larger exponent and adds (or subtracts) them. If any element overflows,
+	///				the whole block is recalculated with one less bit (so the exponent goes up by 1).
+	template <bool isSubtract>
+	void AddOrSubtract(const BlockFp& r) {
+		const int exponent = exponent_ > r.exponent_ ? exponent_ : r.exponent_;
+		const int lShift = exponent - exponent_ < numBits - 1 ? exponent - exponent_ : numBits - 1;
+		const int rShift = exponent - r.exponent_ < numBits - 1 ? exponent - r.exponent_ : numBits - 1;
+
+		BaseType result[BlockSize];
+		BaseType overflow = 0;
+		BaseType norm = 0;
+		BaseType any = 0;
+		for(std::size_t i = 0; i < BlockSize; i++) {
+			const BaseType a = (BaseType)(mantissas_[i] >> lShift);
+			const BaseType b = (BaseType)(r.mantissas_[i] >> rShift);
+			// Wraps around on overflow, which makes the sign of the result wrong
+			const BaseType sum = (BaseType)(isSubtract ? (UnsignedType)a - (UnsignedType)b : (UnsignedType)a + (UnsignedType)b);
+			overflow |= (BaseType)(isSubtract ? (a ^ b) & (a ^ sum) : (sum ^ a) & (sum ^ b));
+			AccumulateNorm(sum, norm, any);
+			result[i] = sum;
+		}
+
+		exponent_ = exponent;
+		if(overflow < 0) {
+			norm = 0;
+			for(std::size_t i = 0; i < BlockSize; i++) {
+				const OverflowType a = (BaseType)(mantissas_[i] >> lShift);
+				const OverflowType b = (BaseType)(r.mantissas_[i] >> rShift);
+				result[i] = (BaseType)((isSubtract ? a - b : a + b) >> 1);
+				AccumulateNorm(result[i], norm, any);
+			}
+			exponent_ = exponent + 1;
+		}
+		StoreNormalised(result, norm, any);
+	}
+
+	BaseType mantissas_[BlockSize];
+
+	int exponent_;
+
+}; // class BlockFp
+
+template <class BaseType, class OverflowType, std::size_t BlockSize>
+constexpr std::size_t BlockFp<BaseType, OverflowType, BlockSize>::blockSize;
+
+template <class BaseType, class OverflowType, std::size_t BlockSize>
+constexpr int BlockFp<BaseType, OverflowType, BlockSize>::zeroExponent;
+
+template <class BaseType, class OverflowType, std::size_t BlockSize>
+constexpr int BlockFp<BaseType, OverflowType, BlockSize>::numBits;
+
+//===============================================================================================//
+//========================================= SPECIALIZATIONS =====================================//
+//===============================================================================================//
+
+template <std::size_t BlockSize>
+using BlockFp8 = BlockFp<int8_t, int16_t, BlockSize>;
+
+template <std::size_t BlockSize>
+using BlockFp16 = BlockFp<int16_t, int32_t, BlockSize>;
+
+template <std::size_t BlockSize>
+using BlockFp32 = BlockFp<int32_t, int64_t, BlockSize>;
+
+template <std::size_t BlockSize>
+using BlockFp64 = BlockFp<int64_t, Int128, BlockSize>;
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_BLOCK_FP_H
+
+// EOF
@@ -0,0 +1,637 @@
+///
+/// \file 				Fft.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				In-place fast Fourier transforms of FpF numbers and BlockFp blocks.
+/// \details
+///		Decimation-in-frequency radix-4 stages (after a radix-2 first stage when log2(size) is odd), followed
+///		by a bit-reversal permutation. The twiddle factors come from a quarter-wave sine table in Q(numBits - 2)
+///		format, generated at compile time for each BaseType and size. Before each stage the largest value
+///		is checked, and the inputs are only shifted right (by 0 to 3 bits) if the stage could overflow, so
+///		the result is a block floating-point number: the transforms return the exponent of their output.
+///		FpF32 FFTs of 32 or more points do all their stages with AVX2 kernels (which give identical
+///		results) when the CPU supports it.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FFT_H
+#define MN_MFIXEDPOINT_FFT_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// User includes
+#include "MFixedPoint/BlockFp.hpp"
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFArray.hpp"
+#include "MFixedPoint/FpFMath.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+namespace detail {
+
+    /// \brief      Returns log2(x), for x a power of 2.
+    constexpr int Log2(std::size_t x) {
+        return x <= 1 ? 0 : 1 + Log2(x / 2);
+    }
+
+    /// \brief      Returns the size of the twiddle factor table used by a size point FFT (at least 4, so that the
+    ///             quarter-wave table is not empty).
+    constexpr std::size_t FftTableSize(std::size_t size) {
+        return size < 4 ? 4 : size;
+    }
+
+    /// \brief      The i'th entry of a quarter-wave sine table with quarterSize intervals, sin(pi/2 * i/quarterSize),
+    ///             with numFracBits fractional bits.
+    template<class BaseType>
+    constexpr BaseType FftSinTableEntry(std::size_t i, std::size_t quarterSize, int numFracBits) {
+        return quarterSize == 0 ? 0 :
+               (BaseType) (SinTaylor(1.5707963267948966 * (double) i / (double) quarterSize,
+                                     1.5707963267948966 * (double) i / (double) quarterSize, 0.0, 1)
+                           * (double) ((uint64_t) 1 << numFracBits) + 0.5);
+    }
+
+    /// \brief      The twiddle factor table of a size point FFT: sin(2pi * k/size) for k = 0 to size/4, in
+    ///             Q(numBits - 2) format (so 1.0 is exact), generated at compile time.
+    template<class BaseType, std::size_t size, class Indices = typename MakeIndexSequence<size / 4 + 1>::type>
+    struct FftSinTable;
+
+    template<class BaseType, std::size_t size, std::size_t... indices>
+    struct FftSinTable<BaseType, size, IndexSequence<indices...>> {
+        static constexpr BaseType values[sizeof...(indices)] = {
+            FftSinTableEntry<BaseType>(indices, size / 4, (int) sizeof(BaseType)*8 - 2)... };
+    };
+
+    template<class BaseType, std::size_t size, std::size_t... indices>
+    constexpr BaseType FftSinTable<BaseType, size, IndexSequence<indices...>>::values[sizeof...(indices)];
+
+    /// \brief      Looks up the twiddle factor W^k = cos(2pi * k/tableSize) - i*sin(2pi * k/tableSize), for k = 0
+    ///             to 3*tableSize/4, from a table with quarterSize = tableSize/4 intervals.
+    template<class BaseType>
+    inline void FftTwiddle(const BaseType* sinTable, std::size_t quarterSize, std::size_t k, BaseType& c, BaseType& s) {
+        if(k <= quarterSize) {
+            c = sinTable[quarterSize - k];
+            s = sinTable[k];
+        } else if(k <= 2*quarterSize) {
+            c = (BaseType) -sinTable[k - quarterSize];
+            s = sinTable[2*quarterSize - k];
+        } else {
+            c = (BaseType) -sinTable[3*quarterSize - k];
+            s = (BaseType) -sinTable[k - 2*quarterSize];
+        }
+    }
+
+    /// \brief      Returns the value which, ORed over a set of values, gives their headroom with Headroom().
+    template<class BaseType>
+    inline BaseType FftNorm(BaseType x) {
+        return (BaseType) (x ^ (x >> (sizeof(BaseType)*8 - 1)));
+    }
+
+    /// \brief      Shifts the size values in re and im right (by the same num. of bits), if needed so that they
+    ///             have at least requiredHeadroom bits of headroom, so values which grow by less than
+    ///             2^requiredHeadroom cannot overflow.
+    /// \returns    The num. of bits the values were shifted by.
+    template<class BaseType, std::size_t size>
+    int FftScale(BaseType* re, BaseType* im, int requiredHeadroom) {
+        BaseType norm = 0;
+        for(std::size_t i = 0; i < size; i++)
+            norm |= FftNorm(re[i]) | FftNorm(im[i]);
+        const int headroom = Headroom(norm);
+        if(headroom >= requiredHeadroom)
+            return 0;
+        const int shift = requiredHeadroom - headroom;
+        for(std::size_t i = 0; i < size; i++) {
+            re[i] = (BaseType) (re[i] >> shift);
+            im[i] = (BaseType) (im[i] >> shift);
+        }
+        return shift;
+    }
+
+    /// \brief      Multiplies (re + i*im) by the twiddle factor (c - i*s) in Q(numBits - 2) format, rounding to
+    ///             nearest.
+    template<class BaseType, class OverflowType>
+    inline void FftTwiddleMultiply(BaseType re, BaseType im, BaseType c, BaseType s, BaseType& outRe, BaseType& outIm) {
+        const int twiddleFracBits = (int) sizeof(BaseType)*8 - 2;
+        const OverflowType half = (OverflowType) 1 << (twiddleFracBits - 1);
+        outRe = (BaseType) (((OverflowType) re * c + (OverflowType) im * s + half) >> twiddleFracBits);
+        outIm = (BaseType) (((OverflowType) im * c - (OverflowType) re * s + half) >> twiddleFracBits);
+    }
+
+    /// \brief      One radix-4 decimation-in-frequency butterfly on the elements i, i + q, i + 2q and i + 3q. w
+    ///             holds the twiddle factors W^j, W^2j and W^3j as (c, s) pairs.
+    template<class BaseType, class OverflowType>
+    inline void FftRadix4Butterfly(BaseType* re, BaseType* im, std::size_t i, std::size_t q, const BaseType* w) {
+        const BaseType t0Re = (BaseType) (re[i] + re[i + 2*q]);
+        const BaseType t0Im = (BaseType) (im[i] + im[i + 2*q]);
+        const BaseType t1Re = (BaseType) (re[i] - re[i + 2*q]);
+        const BaseType t1Im = (BaseType) (im[i] - im[i + 2*q]);
+        const BaseType t2Re = (BaseType) (re[i + q] + re[i + 3*q]);
+        const BaseType t2Im = (BaseType) (im[i + q] + im[i + 3*q]);
+        const BaseType t3Re = (BaseType) (re[i + q] - re[i + 3*q]);
+        const BaseType t3Im = (BaseType) (im[i + q] - im[i + 3*q]);
+
+        re[i] = (BaseType) (t0Re + t2Re);
+        im[i] = (BaseType) (t0Im + t2Im);
+        // (t0 - t2)*W^2j, (t1 - i*t3)*W^j and (t1 + i*t3)*W^3j
+        FftTwiddleMultiply<BaseType, OverflowType>((BaseType) (t0Re - t2Re), (BaseType) (t0Im - t2Im), w[2], w[3],
+                                                   re[i + q], im[i + q]);
+        FftTwiddleMultiply<BaseType, OverflowType>((BaseType) (t1Re + t3Im), (BaseType) (t1Im - t3Re), w[0], w[1],
+                                                   re[i + 2*q], im[i + 2*q]);
+        FftTwiddleMultiply<BaseType, OverflowType>((BaseType) (t1Re - t3Im), (BaseType) (t1Im + t3Re), w[4], w[5],
+                                                   re[i + 3*q], im[i + 3*q]);
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+
+    /// \brief      Looks up 8 twiddle factors (see FftTwiddle()) from an int32 sine table with 2^quarterShift
+    ///             intervals.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void FftTwiddleAvx2(const int32_t* sinTable, int quarterShift, __m256i k, __m256i& c, __m256i& s) {
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i quarterSize = _mm256_set1_epi32(1 << quarterShift);
+        // k = quadrant*quarterSize + r, where quadrant is 0, 1 or 2
+        const __m256i r = _mm256_and_si256(k, _mm256_sub_epi32(quarterSize, one));
+        const __m256i quadrant = _mm256_srli_epi32(k, quarterShift);
+        const __m256i a = _mm256_i32gather_epi32(sinTable, r, 4);
+        const __m256i b = _mm256_i32gather_epi32(sinTable, _mm256_sub_epi32(quarterSize, r), 4);
+        const __m256i isOdd = _mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one);
+        const __m256i negateC = _mm256_cmpgt_epi32(quadrant, _mm256_setzero_si256());
+        const __m256i negateS = _mm256_cmpeq_epi32(quadrant, _mm256_set1_epi32(2));
+        // x ^ -1 - -1 = -x
+        c = _mm256_sub_epi32(_mm256_xor_si256(_mm256_blendv_epi8(b, a, isOdd), negateC), negateC);
+        s = _mm256_sub_epi32(_mm256_xor_si256(_mm256_blendv_epi8(a, b, isOdd), negateS), negateS);
+    }
+
+    /// \brief      Multiplies 8 complex numbers by twiddle factors (c - i*s) in Q30 format, rounding to nearest.
+    /// \details    The products of the even and odd lanes are calculated separately in 64-bit lanes, and only the
+    ///             low 32 bits of each result are kept, so logical shifts can be used.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void FftTwiddleMultiplyAvx2(__m256i re, __m256i im, __m256i c, __m256i s, __m256i& outRe, __m256i& outIm) {
+        const __m256i half = _mm256_set1_epi64x((int64_t) 1 << 29);
+        const __m256i reOdd = _mm256_srli_epi64(re, 32), imOdd = _mm256_srli_epi64(im, 32);
+        const __m256i cOdd = _mm256_srli_epi64(c, 32), sOdd = _mm256_srli_epi64(s, 32);
+        const __m256i outReEven = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epi32(re, c),
+                                                                    _mm256_mul_epi32(im, s)), half);
+        const __m256i outReOdd = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epi32(reOdd, cOdd),
+                                                                   _mm256_mul_epi32(imOdd, sOdd)), half);
+        const __m256i outImEven = _mm256_add_epi64(_mm256_sub_epi64(_mm256_mul_epi32(im, c),
+                                                                    _mm256_mul_epi32(re, s)), half);
+        const __m256i outImOdd = _mm256_add_epi64(_mm256_sub_epi64(_mm256_mul_epi32(imOdd, cOdd),
+                                                                   _mm256_mul_epi32(reOdd, sOdd)), half);
+        outRe = _mm256_blend_epi32(_mm256_srli_epi64(outReEven, 30), _mm256_slli_epi64(outReOdd, 2), 0xAA);
+        outIm = _mm256_blend_epi32(_mm256_srli_epi64(outImEven, 30), _mm256_slli_epi64(outImOdd, 2), 0xAA);
+    }
+
+    /// \brief      8 radix-4 butterflies (see FftRadix4Butterfly()) on x0 to x3, which are overwritten with the
+    ///             outputs. (c1, s1), (c2, s2) and (c3, s3) are the twiddle factors W^j, W^2j and W^3j.
+    /// \details    Takes named vectors rather than arrays, so they stay in registers.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void FftRadix4ButterflyAvx2(__m256i& x0Re, __m256i& x0Im, __m256i& x1Re, __m256i& x1Im,
+                                       __m256i& x2Re, __m256i& x2Im, __m256i& x3Re, __m256i& x3Im,
+                                       __m256i c1, __m256i s1, __m256i c2, __m256i s2, __m256i c3, __m256i s3) {
+        const __m256i t0Re = _mm256_add_epi32(x0Re, x2Re), t0Im = _mm256_add_epi32(x0Im, x2Im);
+        const __m256i t1Re = _mm256_sub_epi32(x0Re, x2Re), t1Im = _mm256_sub_epi32(x0Im, x2Im);
+        const __m256i t2Re = _mm256_add_epi32(x1Re, x3Re), t2Im = _mm256_add_epi32(x1Im, x3Im);
+        const __m256i t3Re = _mm256_sub_epi32(x1Re, x3Re), t3Im = _mm256_sub_epi32(x1Im, x3Im);
+        x0Re = _mm256_add_epi32(t0Re, t2Re);
+        x0Im = _mm256_add_epi32(t0Im, t2Im);
+        FftTwiddleMultiplyAvx2(_mm256_sub_epi32(t0Re, t2Re), _mm256_sub_epi32(t0Im, t2Im), c2, s2, x1Re, x1Im);
+        FftTwiddleMultiplyAvx2(_mm256_add_epi32(t1Re, t3Im), _mm256_sub_epi32(t1Im, t3Re), c1, s1, x2Re, x2Im);
+        FftTwiddleMultiplyAvx2(_mm256_sub_epi32(t1Re, t3Im), _mm256_add_epi32(t1Im, t3Re), c3, s3, x3Re, x3Im);
+    }
+
+    /// \brief      Loads 4 int32s from x into the low 128-bit lane and 4 from x + offset into the high lane.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline __m256i FftLoadLanesAvx2(const int32_t* x, std::size_t offset) {
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) x)),
+                                       _mm_loadu_si128((const __m128i*) (x + offset)), 1);
+    }
+
+    /// \brief      The opposite of FftLoadLanesAvx2().
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void FftStoreLanesAvx2(int32_t* x, std::size_t offset, __m256i v) {
+        _mm_storeu_si128((__m128i*) x, _mm256_castsi256_si128(v));
+        _mm_storeu_si128((__m128i*) (x + offset), _mm256_extracti128_si256(v, 1));
+    }
+
+    /// \brief      One radix-4 stage with quarter span q (4, or a multiple of 8) of an int32 FFT. Gives the same
+    ///             results as FftRadix4Butterfly().
+    /// \details    Does the butterflies of 8 consecutive j at once, or when q is 4, of 4 j in each of 2 groups.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void FftRadix4StageAvx2(int32_t* re, int32_t* im, std::size_t size, std::size_t q, const int32_t* sinTable,
+                                   std::size_t tableSize) {
+        const std::size_t span = 4*q;
+        const int quarterShift = Log2(tableSize / 4);
+        const __m256i stride = _mm256_set1_epi32((int32_t) (tableSize / span));
+        __m256i c1, s1, c2, s2, c3, s3;
+        if(q == 4) {
+            const __m256i k = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 0, 1, 2, 3), stride);
+            FftTwiddleAvx2(sinTable, quarterShift, k, c1, s1);
+            FftTwiddleAvx2(sinTable, quarterShift, _mm256_add_epi32(k, k), c2, s2);
+            FftTwiddleAvx2(sinTable, quarterShift, _mm256_add_epi32(_mm256_add_epi32(k, k), k), c3, s3);
+            for(std::size_t group = 0; group < size; group += 2*span) {
+                int32_t* xRe = re + group;
+                int32_t* xIm = im + group;
+                __m256i x0Re = FftLoadLanesAvx2(xRe, span), x0Im = FftLoadLanesAvx2(xIm, span);
+                __m256i x1Re = FftLoadLanesAvx2(xRe + q, span), x1Im = FftLoadLanesAvx2(xIm + q, span);
+                __m256i x2Re = FftLoadLanesAvx2(xRe + 2*q, span), x2Im = FftLoadLanesAvx2(xIm + 2*q, span);
+                __m256i x3Re = FftLoadLanesAvx2(xRe + 3*q, span), x3Im = FftLoadLanesAvx2(xIm + 3*q, span);
+                FftRadix4ButterflyAvx2(x0Re, x0Im, x1Re, x1Im, x2Re, x2Im, x3Re, x3Im, c1, s1, c2, s2, c3, s3);
+                FftStoreLanesAvx2(xRe, span, x0Re);
+                FftStoreLanesAvx2(xIm, span, x0Im);
+                FftStoreLanesAvx2(xRe + q, span, x1Re);
+                FftStoreLanesAvx2(xIm + q, span, x1Im);
+                FftStoreLanesAvx2(xRe + 2*q, span, x2Re);
+                FftStoreLanesAvx2(xIm + 2*q, span, x2Im);
+                FftStoreLanesAvx2(xRe + 3*q, span, x3Re);
+                FftStoreLanesAvx2(xIm + 3*q, span, x3Im);
+            }
+            return;
+        }
+        for(std::size_t j = 0; j < q; j += 8) {
+            const __m256i k = _mm256_mullo_epi32(_mm256_add_epi32(_mm256_set1_epi32((int32_t) j),
+                                                                  _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), stride);
+            FftTwiddleAvx2(sinTable, quarterShift, k, c1, s1);
+            FftTwiddleAvx2(sinTable, quarterShift, _mm256_add_epi32(k, k), c2, s2);
+            FftTwiddleAvx2(sinTable, quarterShift, _mm256_add_epi32(_mm256_add_epi32(k, k), k), c3, s3);
+            for(std::size_t group = 0; group < size; group += span) {
+                __m256i* xRe = (__m256i*) (re + group + j);
+                __m256i* xIm = (__m256i*) (im + group + j);
+                const std::size_t v = q / 8;
+                __m256i x0Re = _mm256_loadu_si256(xRe), x0Im = _mm256_loadu_si256(xIm);
+                __m256i x1Re = _mm256_loadu_si256(xRe + v), x1Im = _mm256_loadu_si256(xIm + v);
+                __m256i x2Re = _mm256_loadu_si256(xRe + 2*v), x2Im = _mm256_loadu_si256(xIm + 2*v);
+                __m256i x3Re = _mm256_loadu_si256(xRe + 3*v), x3Im = _mm256_loadu_si256(xIm + 3*v);
+                FftRadix4ButterflyAvx2(x0Re, x0Im, x1Re, x1Im, x2Re, x2Im, x3Re, x3Im, c1, s1, c2, s2, c3, s3);
+                _mm256_storeu_si256(xRe, x0Re);
+                _mm256_storeu_si256(xIm, x0Im);
+                _mm256_storeu_si256(xRe + v, x1Re);
+                _mm256_storeu_si256(xIm + v, x1Im);
+                _mm256_storeu_si256(xRe + 2*v, x2Re);
+                _mm256_storeu_si256(xIm + 2*v, x2Im);
+                _mm256_storeu_si256(xRe + 3*v, x3Re);
+                _mm256_storeu_si256(xIm + 3*v, x3Im);
+            }
+        }
+    }
+
+    /// \brief      Transposes the 4x4 matrices of int32s in each 128-bit lane of r0 to r3.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void FftTranspose4x4Avx2(__m256i& r0, __m256i& r1, __m256i& r2, __m256i& r3) {
+        const __m256i t0 = _mm256_unpacklo_epi32(r0, r1), t1 = _mm256_unpackhi_epi32(r0, r1);
+        const __m256i t2 = _mm256_unpacklo_epi32(r2, r3), t3 = _mm256_unpackhi_epi32(r2, r3);
+        r0 = _mm256_unpacklo_epi64(t0, t2);
+        r1 = _mm256_unpackhi_epi64(t0, t2);
+        r2 = _mm256_unpacklo_epi64(t1, t3);
+        r3 = _mm256_unpackhi_epi64(t1, t3);
+    }
+
+    /// \brief      The last radix-4 stage (q = 1, so no twiddle factors) of an int32 FFT of size (a multiple of 32),
+    ///             8 butterflies at a time.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void FftRadix4LastStageAvx2(int32_t* re, int32_t* im, std::size_t size) {
+        for(std::size_t i = 0; i < size; i += 32) {
+            __m256i* xRe = (__m256i*) (re + i);
+            __m256i* xIm = (__m256i*) (im + i);
+            __m256i x0Re = _mm256_loadu_si256(xRe), x0Im = _mm256_loadu_si256(xIm);
+            __m256i x1Re = _mm256_loadu_si256(xRe + 1), x1Im = _mm256_loadu_si256(xIm + 1);
+            __m256i x2Re = _mm256_loadu_si256(xRe + 2), x2Im = _mm256_loadu_si256(xIm + 2);
+            __m256i x3Re = _mm256_loadu_si256(xRe + 3), x3Im = _mm256_loadu_si256(xIm + 3);
+            // Puts element k of each butterfly in xk
+            FftTranspose4x4Avx2(x0Re, x1Re, x2Re, x3Re);
+            FftTranspose4x4Avx2(x0Im, x1Im, x2Im, x3Im);
+            const __m256i t0Re = _mm256_add_epi32(x0Re, x2Re), t0Im = _mm256_add_epi32(x0Im, x2Im);
+            const __m256i t1Re = _mm256_sub_epi32(x0Re, x2Re), t1Im = _mm256_sub_epi32(x0Im, x2Im);
+            const __m256i t2Re = _mm256_add_epi32(x1Re, x3Re), t2Im = _mm256_add_epi32(x1Im, x3Im);
+            const __m256i t3Re = _mm256_sub_epi32(x1Re, x3Re), t3Im = _mm256_sub_epi32(x1Im, x3Im);
+            x0Re = _mm256_add_epi32(t0Re, t2Re);
+            x0Im = _mm256_add_epi32(t0Im, t2Im);
+            x1Re = _mm256_sub_epi32(t0Re, t2Re);
+            x1Im = _mm256_sub_epi32(t0Im, t2Im);
+            x2Re = _mm256_add_epi32(t1Re, t3Im);
+            x2Im = _mm256_sub_epi32(t1Im, t3Re);
+            x3Re = _mm256_sub_epi32(t1Re, t3Im);
+            x3Im = _mm256_add_epi32(t1Im, t3Re);
+            FftTranspose4x4Avx2(x0Re, x1Re, x2Re, x3Re);
+            FftTranspose4x4Avx2(x0Im, x1Im, x2Im, x3Im);
+            _mm256_storeu_si256(xRe, x0Re);
+            _mm256_storeu_si256(xIm, x0Im);
+            _mm256_storeu_si256(xRe + 1, x1Re);
+            _mm256_storeu_si256(xIm + 1, x1Im);
+            _mm256_storeu_si256(xRe + 2, x2Re);
+            _mm256_storeu_si256(xIm + 2, x2Im);
+            _mm256_storeu_si256(xRe + 3, x3Re);
+            _mm256_storeu_si256(xIm + 3, x3Im);
+        }
+    }
+
+    /// \brief      The radix-2 first stage (see FftRadix2Stage()) of an int32 FFT of size (at least 16) points,
+    ///             8 butterflies at a time.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void FftRadix2StageAvx2(int32_t* re, int32_t* im, std::size_t size, const int32_t* sinTable,
+                                   std::size_t tableSize) {
+        const std::size_t half = size / 2;
+        const int quarterShift = Log2(tableSize / 4);
+        const __m256i stride = _mm256_set1_epi32((int32_t) (tableSize / size));
+        for(std::size_t j = 0; j < half; j += 8) {
+            const __m256i k = _mm256_mullo_epi32(_mm256_add_epi32(_mm256_set1_epi32((int32_t) j),
+                                                                  _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), stride);
+            __m256i c, s;
+            FftTwiddleAvx2(sinTable, quarterShift, k, c, s);
+            __m256i* x0Re = (__m256i*) (re + j);
+            __m256i* x0Im = (__m256i*) (im + j);
+            __m256i* x1Re = (__m256i*) (re + j + half);
+            __m256i* x1Im = (__m256i*) (im + j + half);
+            const __m256i aRe = _mm256_loadu_si256(x0Re), aIm = _mm256_loadu_si256(x0Im);
+            const __m256i bRe = _mm256_loadu_si256(x1Re), bIm = _mm256_loadu_si256(x1Im);
+            __m256i outRe, outIm;
+            FftTwiddleMultiplyAvx2(_mm256_sub_epi32(aRe, bRe), _mm256_sub_epi32(aIm, bIm), c, s, outRe, outIm);
+            _mm256_storeu_si256(x0Re, _mm256_add_epi32(aRe, bRe));
+            _mm256_storeu_si256(x0Im, _mm256_add_epi32(aIm, bIm));
+            _mm256_storeu_si256(x1Re, outRe);
+            _mm256_storeu_si256(x1Im, outIm);
+        }
+    }
+
+#endif // #if MN_MFIXEDPOINT_X86_SIMD
+
+    /// \brief      The radix-2 first stage of an FFT of size points, x[j] + x[j + size/2] and
+    ///             (x[j] - x[j + size/2])*W^j, which splits it into two size/2 point FFTs.
+    template<class BaseType, class OverflowType>
+    void FftRadix2Stage(BaseType* re, BaseType* im, std::size_t size, const BaseType* sinTable,
+                        std::size_t tableSize) {
+#if MN_MFIXEDPOINT_X86_SIMD
+        if(std::is_same<BaseType, int32_t>::value && std::is_same<OverflowType, int64_t>::value && size >= 16 &&
+           ActiveSimdIsa() >= SimdIsa::Avx2) {
+            FftRadix2StageAvx2(reinterpret_cast<int32_t*>(re), reinterpret_cast<int32_t*>(im), size,
+                               reinterpret_cast<const int32_t*>(sinTable), tableSize);
+            return;
+        }
+#endif
+        const std::size_t half = size / 2;
+        const std::size_t stride = tableSize / size;
+        for(std::size_t j = 0; j < half; j++) {
+            BaseType c, s;
+            FftTwiddle(sinTable, tableSize / 4, j*stride, c, s);
+            const BaseType aRe = re[j], aIm = im[j];
+            const BaseType bRe = re[j + half], bIm = im[j + half];
+            re[j] = (BaseType) (aRe + bRe);
+            im[j] = (BaseType) (aIm + bIm);
+            FftTwiddleMultiply<BaseType, OverflowType>((BaseType) (aRe - bRe), (BaseType) (aIm - bIm), c, s,
+                                                       re[j + half], im[j + half]);
+        }
+    }
+
+    /// \brief      In-place forward FFT of size (a power of 2) raw complex values, with the output in natural order.
+    /// \details    sinTable is the FftSinTable of a tableSize point FFT (tableSize >= size), so that a real FFT
+    ///             can share the table of the full size. Each stage first checks the headroom of all the values
+    ///             and shifts them if needed, in separate loops which the compiler can vectorize.
+    /// \returns    The total num. of bits the values were shifted right by (the exponent of the output).
+    template<class BaseType, class OverflowType, std::size_t size>
+    int FftRaw(BaseType* re, BaseType* im, const BaseType* sinTable, std::size_t tableSize) {
+        const std::size_t quarterSize = tableSize / 4;
+        int exponent = 0;
+
+        std::size_t span = size;
+        if(Log2(size) % 2 == 1) {
+            // (x[j] - x[j + size/2])*W^j can grow by up to 2*sqrt(2)
+            exponent += FftScale<BaseType, size>(re, im, 2);
+            FftRadix2Stage<BaseType, OverflowType>(re, im, size, sinTable, tableSize);
+            span = size / 2;
+        }
+        for(; span >= 4; span /= 4) {
+            const std::size_t q = span / 4;
+            if(q == 1) {
+                // All the twiddle factors are 1, so the values grow by at most 4x
+                exponent += FftScale<BaseType, size>(re, im, 2);
+#if MN_MFIXEDPOINT_X86_SIMD
+                if(std::is_same<BaseType, int32_t>::value && size >= 32 && ActiveSimdIsa() >= SimdIsa::Avx2) {
+                    FftRadix4LastStageAvx2(reinterpret_cast<int32_t*>(re), reinterpret_cast<int32_t*>(im), size);
+                    continue;
+                }
+#endif
+                for(std::size_t i = 0; i < size; i += 4) {
+                    const BaseType t0Re = (BaseType) (re[i] + re[i + 2]);
+                    const BaseType t0Im = (BaseType) (im[i] + im[i + 2]);
+                    const BaseType t1Re = (BaseType) (re[i] - re[i + 2]);
+                    const BaseType t1Im = (BaseType) (im[i] - im[i + 2]);
+                    const BaseType t2Re = (BaseType) (re[i + 1] + re[i + 3]);
+                    const BaseType t2Im = (BaseType) (im[i + 1] + im[i + 3]);
+                    const BaseType t3Re = (BaseType) (re[i + 1] - re[i + 3]);
+                    const BaseType t3Im = (BaseType) (im[i + 1] - im[i + 3]);
+                    re[i] = (BaseType) (t0Re + t2Re);
+                    im[i] = (BaseType) (t0Im + t2Im);
+                    re[i + 1] = (BaseType) (t0Re - t2Re);
+                    im[i + 1] = (BaseType) (t0Im - t2Im);
+                    re[i + 2] = (BaseType) (t1Re + t3Im);
+                    im[i + 2] = (BaseType) (t1Im - t3Re);
+                    re[i + 3] = (BaseType) (t1Re - t3Im);
+                    im[i + 3] = (BaseType) (t1Im + t3Re);
+                }
+            } else {
+                // (t1 + i*t3)*W^3j can grow by up to 4*sqrt(2)
+                exponent += FftScale<BaseType, size>(re, im, 3);
+                const std::size_t stride = tableSize / span;
+#if MN_MFIXEDPOINT_X86_SIMD
+                if(std::is_same<BaseType, int32_t>::value && std::is_same<OverflowType, int64_t>::value &&
+                   (q >= 8 || (q == 4 && size >= 2*span)) && ActiveSimdIsa() >= SimdIsa::Avx2) {
+                    FftRadix4StageAvx2(reinterpret_cast<int32_t*>(re), reinterpret_cast<int32_t*>(im), size, q,
+                                       reinterpret_cast<const int32_t*>(sinTable), tableSize);
+                    continue;
+                }
+#endif
+                if(q >= size / span) {
+                    for(std::size_t group = 0; group < size; group += span) {
+                        for(std::size_t j = 0; j < q; j++) {
+                            BaseType w[6];
+                            FftTwiddle(sinTable, quarterSize, j*stride, w[0], w[1]);
+                            FftTwiddle(sinTable, quarterSize, 2*j*stride, w[2], w[3]);
+                            FftTwiddle(sinTable, quarterSize, 3*j*stride, w[4], w[5]);
+                            FftRadix4Butterfly<BaseType, OverflowType>(re, im, group + j, q, w);
+                        }
+                    }
+                } else {
+                    // Many small groups, so look each twiddle factor up once
+                    for(std::size_t j = 0; j < q; j++) {
+                        BaseType w[6];
+                        FftTwiddle(sinTable, quarterSize, j*stride, w[0], w[1]);
+                        FftTwiddle(sinTable, quarterSize, 2*j*stride, w[2], w[3]);
+                        FftTwiddle(sinTable, quarterSize, 3*j*stride, w[4], w[5]);
+                        for(std::size_t group = 0; group < size; group += span)
+                            FftRadix4Butterfly<BaseType, OverflowType>(re, im, group + j, q, w);
+                    }
+                }
+            }
+        }
+
+        // Bit-reversal permutation
+        for(std::size_t i = 1, j = 0; i < size; i++) {
+            std::size_t bit = size >> 1;
+            for(; j & bit; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+            if(i < j) {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+        return exponent;
+    }
+
+    /// \brief      Turns the size/2 point FFT z of the even (real) and odd (imaginary) samples of a real signal
+    ///             into bins 0 to size/2 of the signal's size point FFT. re and im must have size/2 + 1 elements.
+    /// \returns    The num. of bits the values were shifted right by.
+    template<class BaseType, class OverflowType, std::size_t size>
+    int RealFftSplit(BaseType* re, BaseType* im, const BaseType* sinTable) {
+        const std::size_t half = size / 2;
+        const std::size_t quarter = size / 4;
+        const int twiddleFracBits = (int) sizeof(BaseType)*8 - 2;
+        // 1.0 in the twiddle factor format, which is also half an LSB of the output (for rounding)
+        const OverflowType one = (OverflowType) 1 << twiddleFracBits;
+
+        // The outputs are at most (1 + sqrt(2)) times larger than the inputs
+        const int shift = FftScale<BaseType, size / 2>(re, im, 2);
+
+        const BaseType z0Re = re[0], z0Im = im[0];
+        re[0] = (BaseType) (z0Re + z0Im);
+        re[half] = (BaseType) (z0Re - z0Im);
+        im[0] = im[half] = 0;
+        if(quarter > 0) {
+            // X[size/4] = conj(z[size/4])
+            im[quarter] = (BaseType) -im[quarter];
+        }
+
+        // X[k] = (E + W^k * -i*O)/2 and X[half - k] = (conj(E) + W^(half - k) * -i*conj(O))/2, where
+        // E = z[k] + conj(z[half - k]) and O = z[k] - conj(z[half - k])
+        for(std::size_t k = 1; k < quarter; k++) {
+            const std::size_t m = half - k;
+            BaseType c, s;
+            FftTwiddle(sinTable, quarter, k, c, s);
+            const OverflowType eRe = (OverflowType) re[k] + re[m];
+            const OverflowType eIm = (OverflowType) im[k] - im[m];
+            const OverflowType oRe = (OverflowType) re[k] - re[m];
+            const OverflowType oIm = (OverflowType) im[k] + im[m];
+            const OverflowType p = oIm * c - oRe * s;
+            const OverflowType q = oRe * c + oIm * s;
+            re[k] = (BaseType) ((eRe * one + p + one) >> (twiddleFracBits + 1));
+            im[k] = (BaseType) ((eIm * one - q + one) >> (twiddleFracBits + 1));
+            re[m] = (BaseType) ((eRe * one - p + one) >> (twiddleFracBits + 1));
+            im[m] = (BaseType) (((OverflowType) 0 - eIm * one - q + one) >> (twiddleFracBits + 1));
+        }
+        return shift;
+    }
+
+    /// \brief      Converts a pointer to an array of FpF numbers to a pointer to their raw values.
+    template<class BaseType, class OverflowType, uint8_t numFracBits>
+    BaseType* FftRawPointer(FpF<BaseType, OverflowType, numFracBits>* values) {
+        static_assert(sizeof(FpF<BaseType, OverflowType, numFracBits>) == sizeof(BaseType),
+                      "FpF arrays must have the same memory layout as arrays of BaseType.");
+        return reinterpret_cast<BaseType*>(values);
+    }
+
+} // namespace detail
+
+//===============================================================================================//
+//============================================ FpF ==============================================//
+//===============================================================================================//
+
+/// \brief      In-place forward FFT of size complex numbers, X[k] = sum(x[n] * e^(-2pi*i*n*k/size)), with the
+///             output in natural order.
+/// \details    size must be a power of 2. To avoid overflowing, the values are shifted right when needed, so
+///             the true result is the output multiplied by 2^exponent.
+/// \returns    exponent.
+template<std::size_t size, class BaseType, class OverflowType, uint8_t numFracBits>
+int Fft(FpF<BaseType, OverflowType, numFracBits>* re, FpF<BaseType, OverflowType, numFracBits>* im) {
+    static_assert(size > 0 && (size & (size - 1)) == 0, "The FFT size must be a power of 2.");
+    const std::size_t tableSize = detail::FftTableSize(size);
+    return detail::FftRaw<BaseType, OverflowType, size>(detail::FftRawPointer(re), detail::FftRawPointer(im),
+                                                        detail::FftSinTable<BaseType, tableSize>::values, tableSize);
+}
+
+/// \brief      In-place inverse FFT, x[n] = sum(X[k] * e^(2pi*i*n*k/size))/size, with the output in natural order.
+/// \details    The true result is the output multiplied by 2^exponent (exponent includes the division by size).
+/// \returns    exponent.
+template<std::size_t size, class BaseType, class OverflowType, uint8_t numFracBits>
+int InverseFft(FpF<BaseType, OverflowType, numFracBits>* re, FpF<BaseType, OverflowType, numFracBits>* im) {
+    static_assert(size > 0 && (size & (size - 1)) == 0, "The FFT size must be a power of 2.");
+    const std::size_t tableSize = detail::FftTableSize(size);
+    // Swapping the real and imaginary parts before and after a forward FFT gives the inverse
+    return detail::FftRaw<BaseType, OverflowType, size>(detail::FftRawPointer(im), detail::FftRawPointer(re),
+                                                        detail::FftSinTable<BaseType, tableSize>::values, tableSize)
+           - detail::Log2(size);
+}
+
+/// \brief      FFT of size real numbers, calculated with one size/2 point complex FFT. Writes bins 0 to size/2
+///             (the rest are their complex conjugates) to re and im, which must have size/2 + 1 elements.
+/// \details    The true result is the output multiplied by 2^exponent.
+/// \returns    exponent.
+template<std::size_t size, class BaseType, class OverflowType, uint8_t numFracBits>
+int RealFft(const FpF<BaseType, OverflowType, numFracBits>* in, FpF<BaseType, OverflowType, numFracBits>* re,
+            FpF<BaseType, OverflowType, numFracBits>* im) {
+    static_assert(size >= 4 && (size & (size - 1)) == 0, "The real FFT size must be a power of 2 (at least 4).");
+    BaseType* rawRe = detail::FftRawPointer(re);
+    BaseType* rawIm = detail::FftRawPointer(im);
+    for(std::size_t n = 0; n < size / 2; n++) {
+        rawRe[n] = in[2*n].GetRawVal();
+        rawIm[n] = in[2*n + 1].GetRawVal();
+    }
+    const BaseType* sinTable = detail::FftSinTable<BaseType, size>::values;
+    const int exponent = detail::FftRaw<BaseType, OverflowType, size / 2>(rawRe, rawIm, sinTable, size);
+    return exponent + detail::RealFftSplit<BaseType, OverflowType, size>(rawRe, rawIm, sinTable);
+}
+
+//===============================================================================================//
+//========================================== BlockFp ============================================//
+//===============================================================================================//
+
+/// \brief      In-place forward FFT of the complex numbers re[n] + i*im[n]. Both blocks are aligned to the larger
+///             exponent, and normalised afterwards.
+template<class BaseType, class OverflowType, std::size_t BlockSize>
+void Fft(BlockFp<BaseType, OverflowType, BlockSize>& re, BlockFp<BaseType, OverflowType, BlockSize>& im) {
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "The FFT size must be a power of 2.");
+    typedef BlockFp<BaseType, OverflowType, BlockSize> BlockType;
+    const int exponent = re.GetExponent() > im.GetExponent() ? re.GetExponent() : im.GetExponent();
+    std::vector<BaseType> rawRe(BlockSize), rawIm(BlockSize);
+    for(std::size_t i = 0; i < BlockSize; i++) {
+        rawRe[i] = detail::ShiftRaw(re.GetMantissa(i), re.GetExponent() - exponent);
+        rawIm[i] = detail::ShiftRaw(im.GetMantissa(i), im.GetExponent() - exponent);
+    }
+    const std::size_t tableSize = detail::FftTableSize(BlockSize);
+    const BaseType* sinTable = detail::FftSinTable<BaseType, tableSize>::values;
+    const int shift = detail::FftRaw<BaseType, OverflowType, BlockSize>(rawRe.data(), rawIm.data(), sinTable,
+                                                                        tableSize);
+    re = BlockType::FromRaw(rawRe.data(), exponent + shift);
+    im = BlockType::FromRaw(rawIm.data(), exponent + shift);
+    re.Normalise();
+    im.Normalise();
+}
+
+/// \brief      In-place inverse FFT (including the division by BlockSize) of the complex numbers re[n] + i*im[n].
+template<class BaseType, class OverflowType, std::size_t BlockSize>
+void InverseFft(BlockFp<BaseType, OverflowType, BlockSize>& re, BlockFp<BaseType, OverflowType, BlockSize>& im) {
+    Fft(im, re);
+    typedef BlockFp<BaseType, OverflowType, BlockSize> BlockType;
+    re = BlockType::FromRaw(re.GetMantissas(), re.GetExponent() - detail::Log2(BlockSize));
+    im = BlockType::FromRaw(im.GetMantissas(), im.GetExponent() - detail::Log2(BlockSize));
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FFT_H
+
+// EOF
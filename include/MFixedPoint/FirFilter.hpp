@@ -0,0 +1,172 @@
+///
+/// \file 				FirFilter.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				A finite impulse response (FIR) filter for FpF numbers.
+/// \details
+///		The delay line is a mirrored circular buffer (every sample is written twice, bufferLength apart), so
+///		the last numTaps samples are always contiguous in memory and each output is one dot product with no
+///		wrap-around. The products are accumulated in OverflowType and shifted once per output. The FpF16 and
+///		FpF32 filters use the SSE4.1/AVX2/AVX-512 dot product kernels from FpFArray.hpp.
+///		The buffer holds blockSize - 1 samples more than the filter needs, so that a block of samples can be
+///		written before any of its outputs are calculated. This stops the (vector) loads of the delay line
+///		waiting for the sample that was just stored.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FIR_FILTER_H
+#define MN_MFIXEDPOINT_FIR_FILTER_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFArray.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      A FIR filter, y[n] = sum(h[k] * x[n - k]) for k = 0 to numTaps - 1.
+/// \details    FpFType must be an FpF type (e.g. FpF32<16>).
+template<class FpFType, std::size_t numTaps>
+class FirFilter;
+
+template<class BaseType, class OverflowType, uint8_t numFracBits, std::size_t numTaps>
+class FirFilter<FpF<BaseType, OverflowType, numFracBits>, numTaps> {
+
+    static_assert(numTaps > 0, "A FIR filter must have at least one tap.");
+
+public:
+
+    typedef FpF<BaseType, OverflowType, numFracBits> FpFType;
+
+    /// \brief      The max. num. of samples Process(const FpFType*, FpFType*, std::size_t) writes to the delay line
+    ///             before calculating their outputs.
+    static constexpr std::size_t blockSize = 32;
+
+    //===============================================================================================//
+    //================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+    //===============================================================================================//
+
+    /// \brief      Creates a filter with all coefficients (and the delay line) set to 0.
+    FirFilter() :
+            position_(0) {
+        for(std::size_t i = 0; i < numTaps; i++)
+            coefficients_[i] = 0;
+        Reset();
+    }
+
+    /// \brief      Creates a filter with the numTaps coefficients h[0], h[1], ... (h[0] multiplies the newest
+    ///             sample).
+    explicit FirFilter(const FpFType* coefficients) :
+            position_(0) {
+        SetCoefficients(coefficients);
+        Reset();
+    }
+
+    //===============================================================================================//
+    //========================================= GETTERS/SETTERS =====================================//
+    //===============================================================================================//
+
+    /// \brief      Sets the numTaps coefficients h[0], h[1], ... (h[0] multiplies the newest sample).
+    /// \details    Does not clear the delay line.
+    void SetCoefficients(const FpFType* coefficients) {
+        // Stored in reverse, so they line up with the delay line (which goes from oldest to newest)
+        for(std::size_t i = 0; i < numTaps; i++)
+            coefficients_[numTaps - 1 - i] = coefficients[i].GetRawVal();
+    }
+
+    /// \brief      Returns coefficient h[i].
+    FpFType GetCoefficient(std::size_t i) const {
+        return FpFType::FromRaw(coefficients_[numTaps - 1 - i]);
+    }
+
+    /// \brief      Sets every sample in the delay line to 0.
+    void Reset() {
+        for(std::size_t i = 0; i < 2*bufferLength; i++)
+            delayLine_[i] = 0;
+        position_ = 0;
+    }
+
+    //===============================================================================================//
+    //========================================== PROCESSING =========================================//
+    //===============================================================================================//
+
+    /// \brief      Adds a sample to the delay line and returns the next output.
+    /// \details    Processing blocks of samples with Process(const FpFType*, FpFType*, std::size_t) is faster.
+    FpFType Process(FpFType sample) {
+        const std::size_t newest = position_;
+        Write(sample);
+        return Output(newest);
+    }
+
+    /// \brief      Processes count samples from in, writing the outputs to out.
+    /// \details    out may be the same array as in.
+    void Process(const FpFType* in, FpFType* out, std::size_t count) {
+        while(count > 0) {
+            const std::size_t numSamples = count < blockSize ? count : blockSize;
+            const std::size_t first = position_;
+            for(std::size_t i = 0; i < numSamples; i++)
+                Write(in[i]);
+            for(std::size_t i = 0; i < numSamples; i++)
+                out[i] = Output(first + i < bufferLength ? first + i : first + i - bufferLength);
+            in += numSamples;
+            out += numSamples;
+            count -= numSamples;
+        }
+    }
+
+private:
+
+    /// \brief      The num. of samples in the circular buffer.
+    static constexpr std::size_t bufferLength = numTaps + blockSize - 1;
+
+    /// \brief      Writes a sample to the delay line (twice, so it is mirrored).
+    void Write(FpFType sample) {
+        delayLine_[position_] = sample.GetRawVal();
+        delayLine_[position_ + bufferLength] = sample.GetRawVal();
+        position_ = position_ + 1 == bufferLength ? 0 : position_ + 1;
+    }
+
+    /// \brief      Calculates the output for the sample at position newest in the delay line.
+    FpFType Output(std::size_t newest) const {
+        // The last numTaps samples (oldest first) end at the mirrored copy of the newest sample
+        const OverflowType sum = detail::DotProductRawDispatch<BaseType, OverflowType>(
+                delayLine_ + newest + bufferLength - (numTaps - 1), coefficients_, numTaps);
+        return FpFType::FromRaw((BaseType) (sum >> numFracBits));
+    }
+
+    /// \brief      The raw coefficients, in reverse order (h[numTaps - 1] first).
+    alignas(64) BaseType coefficients_[numTaps];
+
+    /// \brief      The mirrored circular buffer of raw samples, delayLine_[i] == delayLine_[i + bufferLength].
+    alignas(64) BaseType delayLine_[2*bufferLength];
+
+    /// \brief      Where the next sample is written to.
+    std::size_t position_;
+
+};
+
+template<class BaseType, class OverflowType, uint8_t numFracBits, std::size_t numTaps>
+constexpr std::size_t FirFilter<FpF<BaseType, OverflowType, numFracBits>, numTaps>::blockSize;
+
+template<class BaseType, class OverflowType, uint8_t numFracBits, std::size_t numTaps>
+constexpr std::size_t FirFilter<FpF<BaseType, OverflowType, numFracBits>, numTaps>::bufferLength;
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FIR_FILTER_H
+
+// EOF
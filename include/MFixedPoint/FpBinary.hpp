@@ -0,0 +1,623 @@
+///
+/// \file 				FpBinary.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				A versioned binary file format for arrays of FpF and FpS numbers.
+/// \details
+///		A file is a 32 byte header, then (for FpS) one num. of fractional bits per block, then the raw values,
+///		starting at a multiple of 64 bytes. The header fields are always little-endian:
+///
+///		offset  size  field
+///		0       4     magic, "MFPB"
+///		4       2     version (fpBinaryVersion)
+///		6       1     kind, 0 = FpF, 1 = FpS
+///		7       1     endianness of the raw values, 0 = little, 1 = big
+///		8       1     sizeof(BaseType)
+///		9       1     num. of fractional bits (FpF, 0 for FpS)
+///		10      2     reserved, 0
+///		12      4     num. of values per block (FpS, 0 for FpF)
+///		16      8     num. of values
+///		24      8     offset of the raw values from the start of the file
+///
+///		The raw values are written in the native byte order, so a file written on the same kind of machine can
+///		be used in place (e.g. memory-mapped with MappedFile) through FpFSpan/FpSBlockSpan without copying.
+///		ReadFpBinary() copies (and byte swaps if necessary) the values instead.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FP_BINARY_H
+#define MN_MFIXEDPOINT_FP_BINARY_H
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <stdint.h>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define MN_MFIXEDPOINT_HAS_MMAP 1
+#else
+    #define MN_MFIXEDPOINT_HAS_MMAP 0
+#endif
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpS.hpp"
+#include "MFixedPoint/FpSVector.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      The version written to new files. Files with a higher version are rejected.
+static constexpr uint16_t fpBinaryVersion = 1;
+
+/// \brief      The size of the header, in bytes.
+static constexpr std::size_t fpBinaryHeaderSize = 32;
+
+/// \brief      The raw values start at a multiple of this many bytes (so they are aligned for SIMD loads when the
+///             file is memory-mapped).
+static constexpr std::size_t fpBinaryAlignment = 64;
+
+/// \brief      The num. of FpS values which share one num. of fractional bits if no block size is given.
+static constexpr std::size_t fpBinaryDefaultBlockSize = 256;
+
+/// \brief      The errors that reading (or saving) a binary file can give.
+enum class FpBinaryError {
+    None,
+    IoError,            ///< The file could not be opened, read or written.
+    Truncated,          ///< The data is smaller than the header, block table or raw values need.
+    BadMagic,           ///< The data is not in this format.
+    UnsupportedVersion, ///< The data was written by a newer version of this format.
+    Corrupt,            ///< The header or block table holds impossible values (e.g. more fractional bits than BaseType
+                        ///< has bits), so the values can't be used.
+    InvalidBlockSize,   ///< The block size given to SaveFpBinary() is 0 or does not fit in the header.
+    TypeMismatch,       ///< The data holds a different kind, BaseType or num. of fractional bits.
+    ForeignEndianness,  ///< The raw values are not in the native byte order, so can't be used in place.
+    Misaligned,         ///< The raw values are not aligned for BaseType, so can't be used in place.
+};
+
+/// \brief      A read-only, non-owning view of an array of FpF numbers (e.g. in a memory-mapped file).
+template<class FpFType>
+class FpFSpan {
+
+public:
+
+    FpFSpan() : data_(nullptr), size_(0) {}
+
+    FpFSpan(const FpFType* data, std::size_t size) : data_(data), size_(size) {}
+
+    const FpFType* data() const { return data_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const FpFType* begin() const { return data_; }
+    const FpFType* end() const { return data_ + size_; }
+    const FpFType& operator [] (std::size_t i) const { return data_[i]; }
+
+private:
+
+    const FpFType* data_;
+    std::size_t size_;
+};
+
+/// \brief      A read-only, non-owning view of an array of FpS numbers stored as raw values, where each block of
+///             GetBlockSize() values shares one num. of fractional bits.
+template<class BaseType, class OverflowType>
+class FpSBlockSpan {
+
+public:
+
+    typedef FpS<BaseType, OverflowType> ValueType;
+
+    FpSBlockSpan() : rawVals_(nullptr), blockNumFracBits_(nullptr), size_(0), blockSize_(1) {}
+
+    FpSBlockSpan(const BaseType* rawVals, const uint8_t* blockNumFracBits, std::size_t size, std::size_t blockSize) :
+            rawVals_(rawVals), blockNumFracBits_(blockNumFracBits), size_(size), blockSize_(blockSize) {}
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    ValueType operator [] (std::size_t i) const {
+        return ValueType::FromRaw(rawVals_[i], blockNumFracBits_[i / blockSize_]);
+    }
+
+    /// \brief      The raw values, so whole blocks can be passed to the array functions.
+    const BaseType* data() const { return rawVals_; }
+
+    std::size_t GetBlockSize() const { return blockSize_; }
+
+    std::size_t GetNumBlocks() const { return (size_ + blockSize_ - 1) / blockSize_; }
+
+    /// \brief      Returns the num. of fractional bits of the values in block.
+    uint8_t GetNumFracBits(std::size_t block) const { return blockNumFracBits_[block]; }
+
+private:
+
+    const BaseType* rawVals_;
+    const uint8_t* blockNumFracBits_;
+    std::size_t size_;
+    std::size_t blockSize_;
+};
+
+namespace detail {
+
+    enum class FpBinaryKind : uint8_t {
+        FpF = 0,
+        FpS = 1,
+    };
+
+    inline bool IsLittleEndian() {
+        const uint16_t one = 1;
+        uint8_t firstByte;
+        std::memcpy(&firstByte, &one, 1);
+        return firstByte == 1;
+    }
+
+    inline void StoreLittleEndian(uint8_t* p, uint64_t value, std::size_t numBytes) {
+        for(std::size_t i = 0; i < numBytes; i++)
+            p[i] = (uint8_t) (value >> (8 * i));
+    }
+
+    inline uint64_t LoadLittleEndian(const uint8_t* p, std::size_t numBytes) {
+        uint64_t value = 0;
+        for(std::size_t i = 0; i < numBytes; i++)
+            value |= (uint64_t) p[i] << (8 * i);
+        return value;
+    }
+
+    /// \brief      The header fields, see the file description for the layout.
+    struct FpBinaryHeader {
+        FpBinaryKind kind;
+        bool bigEndian;
+        uint8_t baseTypeSize;
+        uint8_t numFracBits;
+        uint32_t blockSize;
+        uint64_t count;
+        uint64_t payloadOffset;
+    };
+
+    inline std::size_t NumBlocks(std::size_t count, std::size_t blockSize) {
+        return blockSize == 0 ? 0 : (count + blockSize - 1) / blockSize;
+    }
+
+    /// \brief      Offset of the raw values, after the header and numBlocks fractional bits.
+    inline std::size_t PayloadOffset(std::size_t numBlocks) {
+        return (fpBinaryHeaderSize + numBlocks + fpBinaryAlignment - 1) / fpBinaryAlignment * fpBinaryAlignment;
+    }
+
+    inline void StoreHeader(uint8_t* p, const FpBinaryHeader& header) {
+        std::memcpy(p, "MFPB", 4);
+        StoreLittleEndian(p + 4, fpBinaryVersion, 2);
+        p[6] = (uint8_t) header.kind;
+        p[7] = header.bigEndian;
+        p[8] = header.baseTypeSize;
+        p[9] = header.numFracBits;
+        StoreLittleEndian(p + 10, 0, 2);
+        StoreLittleEndian(p + 12, header.blockSize, 4);
+        StoreLittleEndian(p + 16, header.count, 8);
+        StoreLittleEndian(p + 24, header.payloadOffset, 8);
+    }
+
+    /// \brief      Parses and checks the header (and that the block table and raw values fit in size bytes).
+    inline FpBinaryError LoadHeader(const uint8_t* p, std::size_t size, FpBinaryHeader& header) {
+        if(size < fpBinaryHeaderSize)
+            return FpBinaryError::Truncated;
+        if(std::memcmp(p, "MFPB", 4) != 0)
+            return FpBinaryError::BadMagic;
+        if(LoadLittleEndian(p + 4, 2) > fpBinaryVersion)
+            return FpBinaryError::UnsupportedVersion;
+        header.kind = (FpBinaryKind) p[6];
+        header.bigEndian = p[7] != 0;
+        header.baseTypeSize = p[8];
+        header.numFracBits = p[9];
+        header.blockSize = (uint32_t) LoadLittleEndian(p + 12, 4);
+        header.count = LoadLittleEndian(p + 16, 8);
+        header.payloadOffset = LoadLittleEndian(p + 24, 8);
+        if(header.baseTypeSize == 0 || header.numFracBits >= 8 * header.baseTypeSize ||
+           (header.kind == FpBinaryKind::FpS && header.blockSize == 0))
+            return FpBinaryError::Corrupt;
+        // Compare with divisions, so corrupt counts and offsets can't overflow
+        const uint64_t numBlocks = header.kind == FpBinaryKind::FpS ?
+                                   header.count / header.blockSize + (header.count % header.blockSize != 0) : 0;
+        if(header.payloadOffset > size || numBlocks > size - fpBinaryHeaderSize ||
+           header.payloadOffset < fpBinaryHeaderSize + numBlocks ||
+           header.count > (size - header.payloadOffset) / header.baseTypeSize)
+            return FpBinaryError::Truncated;
+        // A block with as many fractional bits as BaseType has bits would make shifts by it undefined
+        for(uint64_t block = 0; block < numBlocks; block++) {
+            if(p[fpBinaryHeaderSize + block] >= 8 * header.baseTypeSize)
+                return FpBinaryError::Corrupt;
+        }
+        return FpBinaryError::None;
+    }
+
+    /// \brief      Checks that the header describes values of kind with BaseType (and numFracBits for FpF).
+    template<class BaseType>
+    FpBinaryError CheckType(const FpBinaryHeader& header, FpBinaryKind kind, uint8_t numFracBits) {
+        if(header.kind != kind || header.baseTypeSize != sizeof(BaseType) || header.numFracBits != numFracBits)
+            return FpBinaryError::TypeMismatch;
+        return FpBinaryError::None;
+    }
+
+    /// \brief      Checks that the raw values of a checked header can be used in place.
+    template<class BaseType>
+    FpBinaryError CheckInPlace(const uint8_t* p, const FpBinaryHeader& header) {
+        if(header.bigEndian == IsLittleEndian())
+            return FpBinaryError::ForeignEndianness;
+        if((uintptr_t) (p + header.payloadOffset) % alignof(BaseType) != 0)
+            return FpBinaryError::Misaligned;
+        return FpBinaryError::None;
+    }
+
+    /// \brief      Loads a raw value which may not be aligned, reversing its bytes if swap is true.
+    template<class BaseType>
+    BaseType LoadRaw(const uint8_t* p, bool swap) {
+        uint8_t bytes[sizeof(BaseType)];
+        for(std::size_t i = 0; i < sizeof(BaseType); i++)
+            bytes[i] = p[swap ? sizeof(BaseType) - 1 - i : i];
+        BaseType rawVal;
+        std::memcpy(&rawVal, bytes, sizeof(BaseType));
+        return rawVal;
+    }
+
+    /// \brief      Writes to memory.
+    struct BufferSink {
+        uint8_t* p;
+        void Write(const void* data, std::size_t numBytes) {
+            std::memcpy(p, data, numBytes);
+            p += numBytes;
+        }
+    };
+
+    /// \brief      Writes to a file, remembering if any write failed.
+    struct FileSink {
+        std::FILE* file;
+        bool ok;
+        void Write(const void* data, std::size_t numBytes) {
+            ok &= std::fwrite(data, 1, numBytes, file) == numBytes;
+        }
+    };
+
+    /// \brief      Writes the header and zero padding up to the raw values.
+    template<class Sink>
+    void WriteHeader(Sink& sink, const FpBinaryHeader& header, const uint8_t* blockNumFracBits, std::size_t numBlocks) {
+        uint8_t bytes[fpBinaryHeaderSize];
+        StoreHeader(bytes, header);
+        sink.Write(bytes, fpBinaryHeaderSize);
+        if(numBlocks > 0)
+            sink.Write(blockNumFracBits, numBlocks);
+        const uint8_t zeros[fpBinaryAlignment] = {};
+        sink.Write(zeros, header.payloadOffset - fpBinaryHeaderSize - numBlocks);
+    }
+
+    template<class BaseType, class Sink>
+    void WriteFpF(Sink& sink, const BaseType* rawVals, std::size_t count, uint8_t numFracBits) {
+        const FpBinaryHeader header = { FpBinaryKind::FpF, !IsLittleEndian(), sizeof(BaseType), numFracBits, 0,
+                                        count, PayloadOffset(0) };
+        WriteHeader(sink, header, nullptr, 0);
+        if(count > 0)
+            sink.Write(rawVals, count * sizeof(BaseType));
+    }
+
+    /// \brief      The num. of fractional bits of each block, which is the lowest of any value in the block (like
+    ///             the FpS operators).
+    template<class Values>
+    std::vector<uint8_t> BlockNumFracBits(const Values& values, std::size_t count, std::size_t blockSize) {
+        std::vector<uint8_t> blockNumFracBits(NumBlocks(count, blockSize), 0);
+        for(std::size_t block = 0; block < blockNumFracBits.size(); block++) {
+            uint8_t numFracBits = values[block * blockSize].GetNumFracBits();
+            for(std::size_t i = block * blockSize + 1; i < std::min(count, (block + 1) * blockSize); i++)
+                numFracBits = std::min(numFracBits, values[i].GetNumFracBits());
+            blockNumFracBits[block] = numFracBits;
+        }
+        return blockNumFracBits;
+    }
+
+    /// \brief      Writes values (anything whose elements have GetRawVal() and GetNumFracBits()) one block at a time,
+    ///             rescaling values with more fractional bits than their block (rounding towards negative infinity).
+    template<class BaseType, class Values, class Sink>
+    void WriteFpS(Sink& sink, const Values& values, std::size_t count, std::size_t blockSize) {
+        const std::vector<uint8_t> blockNumFracBits = BlockNumFracBits(values, count, blockSize);
+        const FpBinaryHeader header = { FpBinaryKind::FpS, !IsLittleEndian(), sizeof(BaseType), 0,
+                                        (uint32_t) blockSize, count, PayloadOffset(blockNumFracBits.size()) };
+        WriteHeader(sink, header, blockNumFracBits.data(), blockNumFracBits.size());
+        std::vector<BaseType> rawVals(std::min(count, blockSize));
+        for(std::size_t block = 0; block < blockNumFracBits.size(); block++) {
+            const std::size_t first = block * blockSize, blockCount = std::min(blockSize, count - first);
+            for(std::size_t i = 0; i < blockCount; i++)
+                rawVals[i] = (BaseType) (values[first + i].GetRawVal() >>
+                                         (values[first + i].GetNumFracBits() - blockNumFracBits[block]));
+            sink.Write(rawVals.data(), blockCount * sizeof(BaseType));
+        }
+    }
+
+    /// \brief      Returns true if blockSize can be stored in the header (and so read back).
+    inline bool IsValidBlockSize(std::size_t blockSize) {
+        return blockSize > 0 && (uint64_t) blockSize <= UINT32_MAX;
+    }
+
+    /// \brief      Writes to buffer, or returns the size needed without writing anything if it is too small.
+    template<class BaseType, class Values>
+    std::size_t WriteFpSBinary(void* buffer, std::size_t bufferSize, const Values& values, std::size_t count,
+                               std::size_t blockSize) {
+        if(!IsValidBlockSize(blockSize))
+            return 0;
+        const std::size_t size = PayloadOffset(NumBlocks(count, blockSize)) + count * sizeof(BaseType);
+        if(size <= bufferSize) {
+            BufferSink sink = { (uint8_t*) buffer };
+            WriteFpS<BaseType>(sink, values, count, blockSize);
+        }
+        return size;
+    }
+
+    template<class BaseType, class Values>
+    FpBinaryError SaveFpSBinary(const char* path, const Values& values, std::size_t count, std::size_t blockSize) {
+        if(!IsValidBlockSize(blockSize))
+            return FpBinaryError::InvalidBlockSize;
+        FileSink sink = { std::fopen(path, "wb"), true };
+        if(sink.file == nullptr)
+            return FpBinaryError::IoError;
+        WriteFpS<BaseType>(sink, values, count, blockSize);
+        sink.ok &= std::fclose(sink.file) == 0;
+        return sink.ok ? FpBinaryError::None : FpBinaryError::IoError;
+    }
+
+} // namespace detail
+
+//===============================================================================================//
+//============================================ WRITING ==========================================//
+//===============================================================================================//
+
+/// \brief      Writes count FpF numbers (header and raw values) to buffer.
+/// \returns    The size of the file in bytes. If this is bigger than bufferSize, nothing was written (so this can
+///             be called with a null buffer to find the size needed).
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+std::size_t WriteFpBinary(void* buffer, std::size_t bufferSize, const FpF<BaseType, OverflowType, numFracBits>* values,
+                          std::size_t count) {
+    static_assert(sizeof(FpF<BaseType, OverflowType, numFracBits>) == sizeof(BaseType),
+                  "FpF arrays must have the same memory layout as arrays of BaseType.");
+    const std::size_t size = detail::PayloadOffset(0) + count * sizeof(BaseType);
+    if(size <= bufferSize) {
+        detail::BufferSink sink = { (uint8_t*) buffer };
+        detail::WriteFpF(sink, reinterpret_cast<const BaseType*>(values), count, numFracBits);
+    }
+    return size;
+}
+
+/// \brief      Writes count FpS numbers to buffer, in blocks of blockSize values which share the lowest num. of
+///             fractional bits of any value in the block (values with more are rounded towards negative infinity).
+/// \returns    The size of the file in bytes, see WriteFpBinary() for FpF, or 0 (and nothing is written) if
+///             blockSize is 0 or more than UINT32_MAX.
+template<class BaseType, class OverflowType>
+std::size_t WriteFpBinary(void* buffer, std::size_t bufferSize, const FpS<BaseType, OverflowType>* values,
+                          std::size_t count, std::size_t blockSize = fpBinaryDefaultBlockSize) {
+    return detail::WriteFpSBinary<BaseType>(buffer, bufferSize, values, count, blockSize);
+}
+
+/// \brief      Writes a FpSVector to buffer (every block has the vector's num. of fractional bits).
+template<class BaseType, class OverflowType>
+std::size_t WriteFpBinary(void* buffer, std::size_t bufferSize, const FpSVector<BaseType, OverflowType>& values,
+                          std::size_t blockSize = fpBinaryDefaultBlockSize) {
+    return detail::WriteFpSBinary<BaseType>(buffer, bufferSize, values, values.size(), blockSize);
+}
+
+/// \brief      Writes count FpF numbers to the file at path (replacing it). The raw values are written straight from
+///             values, without a copy.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpBinaryError SaveFpBinary(const char* path, const FpF<BaseType, OverflowType, numFracBits>* values,
+                           std::size_t count) {
+    detail::FileSink sink = { std::fopen(path, "wb"), true };
+    if(sink.file == nullptr)
+        return FpBinaryError::IoError;
+    detail::WriteFpF(sink, reinterpret_cast<const BaseType*>(values), count, numFracBits);
+    sink.ok &= std::fclose(sink.file) == 0;
+    return sink.ok ? FpBinaryError::None : FpBinaryError::IoError;
+}
+
+/// \brief      Writes count FpS numbers to the file at path (replacing it), see WriteFpBinary() for FpS.
+template<class BaseType, class OverflowType>
+FpBinaryError SaveFpBinary(const char* path, const FpS<BaseType, OverflowType>* values, std::size_t count,
+                           std::size_t blockSize = fpBinaryDefaultBlockSize) {
+    return detail::SaveFpSBinary<BaseType>(path, values, count, blockSize);
+}
+
+/// \brief      Writes a FpSVector to the file at path (replacing it).
+template<class BaseType, class OverflowType>
+FpBinaryError SaveFpBinary(const char* path, const FpSVector<BaseType, OverflowType>& values,
+                           std::size_t blockSize = fpBinaryDefaultBlockSize) {
+    return detail::SaveFpSBinary<BaseType>(path, values, values.size(), blockSize);
+}
+
+//===============================================================================================//
+//============================================ READING ==========================================//
+//===============================================================================================//
+
+/// \brief      Points span at the FpF numbers in data (size bytes), without copying them.
+/// \details    The numbers must have the same BaseType and num. of fractional bits as the span, be in the native
+///             byte order and be aligned (they are if data is aligned to fpBinaryAlignment, e.g. a MappedFile).
+///             span is only changed if this returns FpBinaryError::None, and is only valid while data is.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpBinaryError ViewFpBinary(const void* data, std::size_t size, FpFSpan<FpF<BaseType, OverflowType, numFracBits>>& span) {
+    typedef FpF<BaseType, OverflowType, numFracBits> FpFType;
+    static_assert(sizeof(FpFType) == sizeof(BaseType), "FpF arrays must have the same memory layout as arrays of BaseType.");
+    const uint8_t* const p = (const uint8_t*) data;
+    detail::FpBinaryHeader header;
+    FpBinaryError error = detail::LoadHeader(p, size, header);
+    if(error == FpBinaryError::None)
+        error = detail::CheckType<BaseType>(header, detail::FpBinaryKind::FpF, numFracBits);
+    if(error == FpBinaryError::None)
+        error = detail::CheckInPlace<BaseType>(p, header);
+    if(error == FpBinaryError::None)
+        span = FpFSpan<FpFType>(reinterpret_cast<const FpFType*>(p + header.payloadOffset), (std::size_t) header.count);
+    return error;
+}
+
+/// \brief      Points span at the FpS numbers (and their per-block num. of fractional bits) in data, without
+///             copying them. See ViewFpBinary() for FpF.
+template<class BaseType, class OverflowType>
+FpBinaryError ViewFpBinary(const void* data, std::size_t size, FpSBlockSpan<BaseType, OverflowType>& span) {
+    const uint8_t* const p = (const uint8_t*) data;
+    detail::FpBinaryHeader header;
+    FpBinaryError error = detail::LoadHeader(p, size, header);
+    if(error == FpBinaryError::None)
+        error = detail::CheckType<BaseType>(header, detail::FpBinaryKind::FpS, 0);
+    if(error == FpBinaryError::None)
+        error = detail::CheckInPlace<BaseType>(p, header);
+    if(error == FpBinaryError::None)
+        span = FpSBlockSpan<BaseType, OverflowType>(reinterpret_cast<const BaseType*>(p + header.payloadOffset),
+                                                    p + fpBinaryHeaderSize, (std::size_t) header.count,
+                                                    header.blockSize);
+    return error;
+}
+
+/// \brief      Copies the FpF numbers in data (size bytes) into values, byte swapping them if they are not in the
+///             native byte order. data does not need to be aligned. values is only changed on success.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpBinaryError ReadFpBinary(const void* data, std::size_t size,
+                           std::vector<FpF<BaseType, OverflowType, numFracBits>>& values) {
+    typedef FpF<BaseType, OverflowType, numFracBits> FpFType;
+    static_assert(sizeof(FpFType) == sizeof(BaseType), "FpF arrays must have the same memory layout as arrays of BaseType.");
+    const uint8_t* const p = (const uint8_t*) data;
+    detail::FpBinaryHeader header;
+    FpBinaryError error = detail::LoadHeader(p, size, header);
+    if(error == FpBinaryError::None)
+        error = detail::CheckType<BaseType>(header, detail::FpBinaryKind::FpF, numFracBits);
+    if(error != FpBinaryError::None)
+        return error;
+    const bool swap = header.bigEndian == detail::IsLittleEndian();
+    const uint8_t* const rawVals = p + header.payloadOffset;
+    values.resize((std::size_t) header.count);
+    if(!swap && !values.empty())
+        std::memcpy(values.data(), rawVals, values.size() * sizeof(BaseType));
+    else {
+        for(std::size_t i = 0; i < values.size(); i++)
+            values[i] = FpFType::FromRaw(detail::LoadRaw<BaseType>(rawVals + i * sizeof(BaseType), swap));
+    }
+    return FpBinaryError::None;
+}
+
+/// \brief      Copies the FpS numbers in data into values (each with the num. of fractional bits of its block). See
+///             ReadFpBinary() for FpF.
+template<class BaseType, class OverflowType>
+FpBinaryError ReadFpBinary(const void* data, std::size_t size, std::vector<FpS<BaseType, OverflowType>>& values) {
+    const uint8_t* const p = (const uint8_t*) data;
+    detail::FpBinaryHeader header;
+    FpBinaryError error = detail::LoadHeader(p, size, header);
+    if(error == FpBinaryError::None)
+        error = detail::CheckType<BaseType>(header, detail::FpBinaryKind::FpS, 0);
+    if(error != FpBinaryError::None)
+        return error;
+    const bool swap = header.bigEndian == detail::IsLittleEndian();
+    const uint8_t* const rawVals = p + header.payloadOffset;
+    values.clear();
+    values.reserve((std::size_t) header.count);
+    for(std::size_t i = 0; i < header.count; i++)
+        values.push_back(FpS<BaseType, OverflowType>::FromRaw(
+                detail::LoadRaw<BaseType>(rawVals + i * sizeof(BaseType), swap),
+                p[fpBinaryHeaderSize + i / header.blockSize]));
+    return FpBinaryError::None;
+}
+
+/// \brief      A read-only file mapped into memory (with mmap() on POSIX systems, otherwise read into an aligned
+///             buffer), to be passed to ViewFpBinary() or ReadFpBinary(). Spans pointing into it are only valid
+///             until it is closed or destroyed.
+class MappedFile {
+
+public:
+
+    MappedFile() : data_(nullptr), size_(0) {}
+
+    ~MappedFile() {
+        Close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// \brief      Maps the file at path, closing any file already mapped.
+    FpBinaryError Open(const char* path) {
+        Close();
+#if MN_MFIXEDPOINT_HAS_MMAP
+        const int fd = ::open(path, O_RDONLY);
+        if(fd < 0)
+            return FpBinaryError::IoError;
+        struct stat fileStat;
+        FpBinaryError error = FpBinaryError::None;
+        if(::fstat(fd, &fileStat) != 0)
+            error = FpBinaryError::IoError;
+        else if(fileStat.st_size > 0) {
+            void* const data = ::mmap(nullptr, (std::size_t) fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(data == MAP_FAILED)
+                error = FpBinaryError::IoError;
+            else {
+                data_ = data;
+                size_ = (std::size_t) fileStat.st_size;
+            }
+        }
+        ::close(fd);
+        return error;
+#else
+        std::FILE* const file = std::fopen(path, "rb");
+        if(file == nullptr)
+            return FpBinaryError::IoError;
+        bool ok = std::fseek(file, 0, SEEK_END) == 0;
+        const long size = ok ? std::ftell(file) : -1;
+        ok &= size >= 0 && std::fseek(file, 0, SEEK_SET) == 0;
+        if(ok) {
+            buffer_.resize(((std::size_t) size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+            ok = std::fread(buffer_.data(), 1, (std::size_t) size, file) == (std::size_t) size;
+        }
+        std::fclose(file);
+        if(!ok) {
+            buffer_.clear();
+            return FpBinaryError::IoError;
+        }
+        data_ = buffer_.data();
+        size_ = (std::size_t) size;
+        return FpBinaryError::None;
+#endif
+    }
+
+    void Close() {
+#if MN_MFIXEDPOINT_HAS_MMAP
+        if(data_ != nullptr)
+            ::munmap(data_, size_);
+#else
+        buffer_.clear();
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const void* data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+
+    void* data_;
+    std::size_t size_;
+#if !MN_MFIXEDPOINT_HAS_MMAP
+    std::vector<uint64_t> buffer_;
+#endif
+};
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FP_BINARY_H
+
+// EOF
@@ -0,0 +1,282 @@
+///
+/// \file 				FpChars.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				Allocation-free formatting and parsing of fixed-point numbers as decimal strings.
+/// \details
+///		The digits are calculated directly from the raw integer value: the integer part with a 2 digits at a
+///		time lookup table, and the fractional part by repeatedly multiplying it by 10 (a fraction with n bits
+///		has exactly n decimal places, so the expansion is exact). Nothing goes through a double and nothing
+///		is allocated. Used by FpF::ToChars() and FpS::ToChars().
+///		Parsing (FpF::FromChars() and FpS::FromChars()) works the other way around, building the raw value
+///		from the digits with exact rounding to the nearest representable number.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FP_CHARS_H
+#define MN_MFIXEDPOINT_FP_CHARS_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+#include <system_error>
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      The result of ToChars(), like C++17's std::to_chars_result. On success ptr is one past the last
+///             character written and ec is std::errc(). If the buffer is too small, ptr is last and ec is
+///             std::errc::value_too_large.
+struct ToCharsResult {
+    char* ptr;
+    std::errc ec;
+};
+
+/// \brief      The result of FromChars(), like C++17's std::from_chars_result. On success ptr is one past the last
+///             character of the number and ec is std::errc(). If there is no number, ptr is first and ec is
+///             std::errc::invalid_argument. If the number is out of range, ptr is one past it and ec is
+///             std::errc::result_out_of_range. The value is only written on success.
+struct FromCharsResult {
+    const char* ptr;
+    std::errc ec;
+};
+
+/// \brief      Pass as numDigits to ToChars() to write the exact decimal expansion of the number, without
+///             trailing zeros (and without a decimal point if it is an integer).
+constexpr int exactDigits = -1;
+
+namespace detail {
+
+    /// \brief      Returns the next decimal digit of a fraction with numFracBits bits, and removes it from the
+    ///             fraction. Fractions with up to 60 bits are multiplied by 10 directly, longer ones (with the
+    ///             binary point above bit 63) in two 32-bit halves so they don't need a 128-bit multiply.
+    template<class NumFracBits>
+    unsigned NextFracDigit(uint64_t& frac, NumFracBits numFracBits) {
+        if(numFracBits <= 60) {
+            frac *= 10;
+            const unsigned digit = (unsigned) (frac >> numFracBits);
+            frac &= ((uint64_t) 1 << numFracBits) - 1;
+            return digit;
+        }
+        const uint64_t lo = (frac & 0xFFFFFFFFu) * 10;
+        const uint64_t hi = (frac >> 32) * 10 + (lo >> 32);
+        frac = (hi << 32) | (lo & 0xFFFFFFFFu);
+        return (unsigned) (hi >> 32);
+    }
+
+    /// \brief      Writes the decimal digits of value, ending just before end, 2 at a time.
+    /// \returns    A pointer to the first digit.
+    inline char* WriteIntDigits(uint64_t value, char* end) {
+        static const char digitPairs[] =
+                "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                "8081828384858687888990919293949596979899";
+        while(value >= 100) {
+            const unsigned pair = (unsigned) (value % 100) * 2;
+            value /= 100;
+            *--end = digitPairs[pair + 1];
+            *--end = digitPairs[pair];
+        }
+        if(value >= 10) {
+            *--end = digitPairs[value * 2 + 1];
+            *--end = digitPairs[value * 2];
+        } else {
+            *--end = (char) ('0' + value);
+        }
+        return end;
+    }
+
+    /// \brief      Writes rawVal / 2^numFracBits in decimal, with numDigits decimal places (rounded to nearest,
+    ///             ties to even, so the output is the same as printf("%.*f")), or exactDigits.
+    /// \details    NumFracBits is unsigned for FpS, and a std::integral_constant for FpF so that each FpF type
+    ///             gets a version with the shifts and masks calculated at compile time (which is around 30%
+    ///             faster).
+    template<class NumFracBits>
+    ToCharsResult RawToChars(char* first, char* last, int64_t rawVal, NumFracBits numFracBits, int numDigits) {
+        const bool negative = rawVal < 0;
+        const uint64_t magnitude = negative ? 0 - (uint64_t) rawVal : (uint64_t) rawVal;
+        uint64_t intPart = numFracBits >= 64 ? 0 : magnitude >> numFracBits;
+        uint64_t frac = numFracBits == 0 ? 0 : (numFracBits <= 60 ? magnitude & (((uint64_t) 1 << numFracBits) - 1) :
+                                                                    magnitude << (64 - numFracBits));
+
+        // Every digit after numFracBits decimal places is 0, so at most numFracBits (<= 64) are calculated
+        char fracDigits[64];
+        const unsigned maxFracDigits = numDigits >= 0 && (unsigned) numDigits < (unsigned) numFracBits ?
+                                       (unsigned) numDigits : numFracBits;
+        unsigned numFracDigits = 0;
+        while(numFracDigits < maxFracDigits && (numDigits >= 0 || frac != 0))
+            fracDigits[numFracDigits++] = (char) ('0' + NextFracDigit(frac, numFracBits));
+
+        // Round what is left of the fraction, carrying into the integer part if all the digits are 9s
+        const uint64_t half = numFracBits <= 60 ? ((uint64_t) 1 << numFracBits) >> 1 : (uint64_t) 1 << 63;
+        const bool lastDigitOdd = numFracDigits > 0 ? (fracDigits[numFracDigits - 1] & 1) : (intPart & 1);
+        if(numDigits >= 0 && frac != 0 && (frac > half || (frac == half && lastDigitOdd))) {
+            unsigned i = numFracDigits;
+            for(; i > 0 && fracDigits[i - 1] == '9'; i--)
+                fracDigits[i - 1] = '0';
+            if(i > 0)
+                fracDigits[i - 1]++;
+            else
+                intPart++;
+        }
+
+        char intDigits[20];
+        const char* intStart = WriteIntDigits(intPart, intDigits + sizeof(intDigits));
+        const std::size_t numIntDigits = (std::size_t) (intDigits + sizeof(intDigits) - intStart);
+        const std::size_t numOutFracDigits = numDigits >= 0 ? (std::size_t) numDigits : numFracDigits;
+        const std::size_t length = negative + numIntDigits + (numOutFracDigits > 0 ? 1 + numOutFracDigits : 0);
+        if((std::size_t) (last - first) < length)
+            return ToCharsResult{ last, std::errc::value_too_large };
+
+        // Copied with loops rather than memcpy(), which isn't inlined for these short variable lengths
+        char* out = first;
+        if(negative)
+            *out++ = '-';
+        for(std::size_t i = 0; i < numIntDigits; i++)
+            *out++ = intStart[i];
+        if(numOutFracDigits > 0) {
+            *out++ = '.';
+            for(std::size_t i = 0; i < numFracDigits; i++)
+                *out++ = fracDigits[i];
+            for(std::size_t i = numFracDigits; i < numOutFracDigits; i++)
+                *out++ = '0';
+        }
+        return ToCharsResult{ out, std::errc() };
+    }
+
+    /// \brief      Multiplies a decimal fraction (numLimbs base 10^9 digits, most significant first) by 2^shift.
+    /// \returns    The integer part of the product (the next shift bits of the binary fraction), which is
+    ///             removed from the fraction.
+    inline uint64_t ShiftOutFracBits(uint32_t* limbs, unsigned numLimbs, unsigned shift) {
+        uint64_t carry = 0;
+        for(unsigned i = numLimbs; i > 0; i--) {
+            const uint64_t value = ((uint64_t) limbs[i - 1] << shift) + carry;
+            limbs[i - 1] = (uint32_t) (value % 1000000000u);
+            carry = value / 1000000000u;
+        }
+        return carry;
+    }
+
+    /// \brief      Combines the integer part and the (already rounded) fractional bits of a parsed number into
+    ///             a raw value with numBits bits.
+    /// \returns    false if the number is out of range.
+    template<class NumFracBits>
+    bool MakeParsedRaw(bool negative, uint64_t intPart, uint64_t fracBits, NumFracBits numFracBits,
+                       unsigned numBits, int64_t& rawVal) {
+        const uint64_t maxMagnitude = ((uint64_t) 1 << (numBits - 1)) - (negative ? 0 : 1);
+        if(intPart > (maxMagnitude >> numFracBits) || fracBits > maxMagnitude - (intPart << numFracBits))
+            return false;
+        const uint64_t magnitude = (intPart << numFracBits) + fracBits;
+        rawVal = (int64_t) (negative ? 0 - magnitude : magnitude);
+        return true;
+    }
+
+    /// \brief      Parses a decimal number ([-]digits[.digits], at least one digit, like std::from_chars() with
+    ///             std::chars_format::fixed) into a raw value with numBits bits and numFracBits fractional bits,
+    ///             rounding to nearest (ties to even).
+    /// \details    A number between two representable values is only rounded correctly if every digit is
+    ///             considered, so the fractional digits are converted to binary exactly, 9 at a time in base
+    ///             10^9. Only the first 72 are needed (the midpoint between two numbers with numFracBits <= 64
+    ///             fractional bits has at most 65 decimal places), any after that only decide ties.
+    template<class NumFracBits>
+    FromCharsResult CharsToRaw(const char* first, const char* last, NumFracBits numFracBits, unsigned numBits,
+                               int64_t& rawVal) {
+        const char* p = first;
+        const bool negative = p != last && *p == '-';
+        if(negative)
+            p++;
+
+        // The integer part saturates, anything this big is out of range anyway
+        const char* const intStart = p;
+        uint64_t intPart = 0;
+        for(; p != last && (unsigned) (*p - '0') <= 9; p++)
+            intPart = intPart <= 1844674407370955160u ? intPart * 10 + (unsigned) (*p - '0') : (uint64_t) -1;
+        unsigned numDigits = (unsigned) (p - intStart);
+
+        // The fraction, in base 10^9 (the last limb is padded with zeros)
+        uint32_t limbs[8];
+        unsigned numLimbs = 0, numLimbDigits = 0;
+        bool sticky = false;
+        if(p != last && *p == '.') {
+            const char* const fracStart = ++p;
+            for(; p != last && (unsigned) (*p - '0') <= 9; p++) {
+                const unsigned digit = (unsigned) (*p - '0');
+                if(numLimbs == 8 && numLimbDigits == 9) {
+                    sticky |= digit != 0;
+                    continue;
+                }
+                if(numLimbDigits == 9 || numLimbs == 0) {
+                    limbs[numLimbs++] = 0;
+                    numLimbDigits = 0;
+                }
+                limbs[numLimbs - 1] = limbs[numLimbs - 1] * 10 + digit;
+                numLimbDigits++;
+            }
+            numDigits += (unsigned) (p - fracStart);
+        }
+        if(numDigits == 0)
+            return FromCharsResult{ first, std::errc::invalid_argument };
+        for(; numLimbDigits > 0 && numLimbDigits < 9; numLimbDigits++)
+            limbs[numLimbs - 1] *= 10;
+        // Zero limbs at the end stay zero, and don't need to be multiplied
+        while(numLimbs > 0 && limbs[numLimbs - 1] == 0)
+            numLimbs--;
+
+        // Up to 32 fractional bits at a time, then the rounding bit, and whether anything is left after that
+        uint64_t fracBits = 0;
+        if(numLimbs > 0) {
+            for(unsigned remaining = numFracBits; remaining > 0;) {
+                const unsigned shift = remaining < 32 ? remaining : 32;
+                fracBits = (fracBits << shift) | ShiftOutFracBits(limbs, numLimbs, shift);
+                remaining -= shift;
+            }
+            const bool roundBit = ShiftOutFracBits(limbs, numLimbs, 1) != 0;
+            for(unsigned i = 0; i < numLimbs; i++)
+                sticky |= limbs[i] != 0;
+            const bool odd = numFracBits > 0 ? (fracBits & 1) : (intPart & 1);
+            if(roundBit && (sticky || odd))
+                fracBits++;
+        }
+
+        if(!MakeParsedRaw(negative, intPart, fracBits, numFracBits, numBits, rawVal))
+            return FromCharsResult{ p, std::errc::result_out_of_range };
+        return FromCharsResult{ p, std::errc() };
+    }
+
+} // namespace detail
+
+/// \brief      Writes count numbers (anything with a ToChars() method, e.g. FpF or FpS) to [first, last),
+///             separated by separator (which isn't written after the last number).
+/// \returns    On success, ptr is one past the last character written. If the buffer is too small, ptr is one
+///             past the separator after the last number which fitted (or first if none did) and ec is
+///             std::errc::value_too_large, so the numbers which fitted can be used and the rest written later.
+template<class FpType>
+ToCharsResult ArrayToChars(const FpType* values, std::size_t count, char* first, char* last, char separator = ',',
+                           int numDigits = exactDigits) {
+    char* out = first;
+    for(std::size_t i = 0; i < count; i++) {
+        const ToCharsResult result = values[i].ToChars(out, last, numDigits);
+        if(result.ec != std::errc() || (i + 1 < count && result.ptr == last))
+            return ToCharsResult{ out, std::errc::value_too_large };
+        out = result.ptr;
+        if(i + 1 < count)
+            *out++ = separator;
+    }
+    return ToCharsResult{ out, std::errc() };
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FP_CHARS_H
+
+// EOF
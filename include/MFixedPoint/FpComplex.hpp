@@ -0,0 +1,426 @@
+///
+/// \file 				FpComplex.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				A complex number made of two FpF numbers.
+/// \details
+///		A complex multiply accumulates the two products of each component in OverflowType and shifts once,
+///		instead of the four separate multiply-shifts (and roundings) of doing it with FpF's '*' operator.
+///		FpComplex has the same memory layout as two BaseType values (real then imaginary), so arrays of them
+///		are interleaved I/Q samples. The array functions use AVX2 kernels for FpF16 and FpF32, selected like
+///		the ones in FpFArray.hpp.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FP_COMPLEX_H
+#define MN_MFIXEDPOINT_FP_COMPLEX_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFArray.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      A complex number re + i*im, where re and im are FpFType numbers.
+/// \details    FpFType must be an FpF type (e.g. FpF16<15>).
+template<class FpFType>
+class FpComplex;
+
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+class FpComplex<FpF<BaseType, OverflowType, numFracBits>> {
+
+public:
+
+    typedef FpF<BaseType, OverflowType, numFracBits> FpFType;
+
+    //===============================================================================================//
+    //================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+    //===============================================================================================//
+
+    FpComplex() = default;
+
+    constexpr FpComplex(FpFType re, FpFType im = FpFType::FromRaw(0)) :
+            re_(re),
+            im_(im) {}
+
+    //===============================================================================================//
+    //========================================= GETTERS/SETTERS =====================================//
+    //===============================================================================================//
+
+    constexpr FpFType GetReal() const {
+        return re_;
+    }
+
+    constexpr FpFType GetImag() const {
+        return im_;
+    }
+
+    void SetReal(FpFType re) {
+        re_ = re;
+    }
+
+    void SetImag(FpFType im) {
+        im_ = im;
+    }
+
+    //===============================================================================================//
+    //================================= COMPOUND ARITHMETIC OVERLOADS ===============================//
+    //===============================================================================================//
+
+    FpComplex& operator += (const FpComplex& r) {
+        re_ += r.re_;
+        im_ += r.im_;
+        return *this;
+    }
+
+    FpComplex& operator -= (const FpComplex& r) {
+        re_ -= r.re_;
+        im_ -= r.im_;
+        return *this;
+    }
+
+    FpComplex& operator *= (const FpComplex& r) {
+        *this = *this * r;
+        return *this;
+    }
+
+    //===============================================================================================//
+    //==================================== ARITHMETIC OVERLOADS =====================================//
+    //===============================================================================================//
+
+    constexpr FpComplex operator - () const {
+        return FpComplex(-re_, -im_);
+    }
+
+    constexpr FpComplex operator + (const FpComplex& r) const {
+        return FpComplex(re_ + r.re_, im_ + r.im_);
+    }
+
+    constexpr FpComplex operator - (const FpComplex& r) const {
+        return FpComplex(re_ - r.re_, im_ - r.im_);
+    }
+
+    /// \brief      (a + bi)(c + di) = (ac - bd) + (ad + bc)i.
+    /// \details    The two products of each component are added in OverflowType and shifted once, so the
+    ///             result is only truncated once per component.
+    constexpr FpComplex operator * (const FpComplex& r) const {
+        return FpComplex(FpFType::FromRaw((BaseType) (((OverflowType) re_.GetRawVal() * r.re_.GetRawVal() -
+                                                       (OverflowType) im_.GetRawVal() * r.im_.GetRawVal())
+                                                      >> numFracBits)),
+                         FpFType::FromRaw((BaseType) (((OverflowType) re_.GetRawVal() * r.im_.GetRawVal() +
+                                                       (OverflowType) im_.GetRawVal() * r.re_.GetRawVal())
+                                                      >> numFracBits)));
+    }
+
+    /// \brief      Multiplies both components by a real number.
+    constexpr FpComplex operator * (FpFType r) const {
+        return FpComplex(re_ * r, im_ * r);
+    }
+
+    //===============================================================================================//
+    //==================================== COMPARISON OVERLOADS =====================================//
+    //===============================================================================================//
+
+    constexpr bool operator == (const FpComplex& r) const {
+        return re_ == r.re_ && im_ == r.im_;
+    }
+
+    constexpr bool operator != (const FpComplex& r) const {
+        return !(*this == r);
+    }
+
+    //===============================================================================================//
+    //=========================================== METHODS ===========================================//
+    //===============================================================================================//
+
+    /// \brief      Returns the complex conjugate, re - i*im.
+    constexpr FpComplex Conj() const {
+        return FpComplex(re_, -im_);
+    }
+
+    /// \brief      Returns re^2 + im^2, added in OverflowType and shifted once.
+    constexpr FpFType MagnitudeSquared() const {
+        return FpFType::FromRaw((BaseType) (((OverflowType) re_.GetRawVal() * re_.GetRawVal() +
+                                             (OverflowType) im_.GetRawVal() * im_.GetRawVal()) >> numFracBits));
+    }
+
+private:
+
+    FpFType re_;
+    FpFType im_;
+
+};
+
+/// \brief      (a + bi)(c + di) with three multiplies instead of four (Gauss's trick): k1 = c(a + b),
+///             k2 = a(d - c), k3 = b(c + d), giving (k1 - k3) + (k1 + k2)i.
+/// \details    Gives identical results to the '*' operator, as long as the sums a + b, d - c and c + d fit in
+///             BaseType (e.g. when every component is less than half the max. value). Only worth it when an
+///             OverflowType multiply is much slower than an addition (e.g. FpF64, which multiplies in Int128).
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpComplex<FpF<BaseType, OverflowType, numFracBits>> MultiplyGauss(FpComplex<FpF<BaseType, OverflowType, numFracBits>> x,
+                                                                  FpComplex<FpF<BaseType, OverflowType, numFracBits>> y) {
+    typedef FpF<BaseType, OverflowType, numFracBits> FpFType;
+    const BaseType a = x.GetReal().GetRawVal(), b = x.GetImag().GetRawVal();
+    const BaseType c = y.GetReal().GetRawVal(), d = y.GetImag().GetRawVal();
+    const OverflowType k1 = (OverflowType) c * (BaseType) (a + b);
+    const OverflowType k2 = (OverflowType) a * (BaseType) (d - c);
+    const OverflowType k3 = (OverflowType) b * (BaseType) (c + d);
+    return FpComplex<FpFType>(FpFType::FromRaw((BaseType) ((k1 - k3) >> numFracBits)),
+                              FpFType::FromRaw((BaseType) ((k1 + k2) >> numFracBits)));
+}
+
+namespace detail {
+
+    /// \brief      The operations supported by the complex array kernels.
+    enum class ComplexArrayOp {
+        Multiply,
+        MultiplyConj,
+    };
+
+    /// \brief      Portable complex array operations on interleaved raw values (re, im, re, im, ...).
+    template<class BaseType, class OverflowType>
+    void ComplexArrayOpScalar(ComplexArrayOp op, const BaseType* a, const BaseType* b, BaseType* out,
+                              std::size_t count, uint8_t numFracBits) {
+        for(std::size_t i = 0; i < 2*count; i += 2) {
+            const OverflowType aRe = a[i], aIm = a[i + 1];
+            const OverflowType bRe = b[i], bIm = b[i + 1];
+            if(op == ComplexArrayOp::Multiply) {
+                out[i] = (BaseType) ((aRe * bRe - aIm * bIm) >> numFracBits);
+                out[i + 1] = (BaseType) ((aRe * bIm + aIm * bRe) >> numFracBits);
+            } else {
+                out[i] = (BaseType) ((aRe * bRe + aIm * bIm) >> numFracBits);
+                out[i + 1] = (BaseType) ((aIm * bRe - aRe * bIm) >> numFracBits);
+            }
+        }
+    }
+
+    /// \brief      Portable re^2 + im^2 of interleaved raw values.
+    template<class BaseType, class OverflowType>
+    void MagnitudeSquaredScalar(const BaseType* a, BaseType* out, std::size_t count, uint8_t numFracBits) {
+        for(std::size_t i = 0; i < count; i++) {
+            const OverflowType re = a[2*i], im = a[2*i + 1];
+            out[i] = (BaseType) ((re * re + im * im) >> numFracBits);
+        }
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+
+    /// \brief      8 complex FpF16 multiplies (or multiplies by the conjugate of b) at once.
+    /// \details    _mm256_madd_epi16() adds the 32-bit products of each pair of int16s, so each component takes
+    ///             one or two madds with the other operand's components masked or swapped. Nothing is negated
+    ///             (which would overflow for -32768).
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void ComplexArrayOpAvx2(ComplexArrayOp op, const int16_t* a, const int16_t* b, int16_t* out,
+                                   std::size_t count, uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m128i shiftUp = _mm_cvtsi32_si128(16 - numFracBits);
+        const __m256i reMask = _mm256_set1_epi32(0x0000FFFF);
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256i x = _mm256_loadu_si256((const __m256i*) (a + 2*i));
+            const __m256i y = _mm256_loadu_si256((const __m256i*) (b + 2*i));
+            // (im, re) in each pair
+            const __m256i ySwapped = _mm256_or_si256(_mm256_slli_epi32(y, 16), _mm256_srli_epi32(y, 16));
+            __m256i re, im;
+            if(op == ComplexArrayOp::Multiply) {
+                re = _mm256_sub_epi32(_mm256_madd_epi16(x, _mm256_and_si256(y, reMask)),
+                                      _mm256_madd_epi16(x, _mm256_andnot_si256(reMask, y)));
+                im = _mm256_madd_epi16(x, ySwapped);
+            } else {
+                re = _mm256_madd_epi16(x, y);
+                im = _mm256_sub_epi32(_mm256_madd_epi16(x, _mm256_andnot_si256(reMask, ySwapped)),
+                                      _mm256_madd_epi16(x, _mm256_and_si256(ySwapped, reMask)));
+            }
+            _mm256_storeu_si256((__m256i*) (out + 2*i), _mm256_blend_epi16(_mm256_sra_epi32(re, shiftDown),
+                                                                          _mm256_sll_epi32(im, shiftUp), 0xAA));
+        }
+        ComplexArrayOpScalar<int16_t, int32_t>(op, a + 2*i, b + 2*i, out + 2*i, count - i, numFracBits);
+    }
+
+    /// \brief      4 complex FpF32 multiplies (or multiplies by the conjugate of b) at once.
+    /// \details    The products are calculated in 64-bit lanes with _mm256_mul_epi32(), which uses the even (real)
+    ///             int32s, or the odd (imaginary) ones after shifting them down.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void ComplexArrayOpAvx2(ComplexArrayOp op, const int32_t* a, const int32_t* b, int32_t* out,
+                                   std::size_t count, uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m128i shiftUp = _mm_cvtsi32_si128(32 - numFracBits);
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m256i x = _mm256_loadu_si256((const __m256i*) (a + 2*i));
+            const __m256i y = _mm256_loadu_si256((const __m256i*) (b + 2*i));
+            const __m256i xIm = _mm256_srli_epi64(x, 32);
+            const __m256i yIm = _mm256_srli_epi64(y, 32);
+            __m256i re, im;
+            if(op == ComplexArrayOp::Multiply) {
+                re = _mm256_sub_epi64(_mm256_mul_epi32(x, y), _mm256_mul_epi32(xIm, yIm));
+                im = _mm256_add_epi64(_mm256_mul_epi32(x, yIm), _mm256_mul_epi32(xIm, y));
+            } else {
+                re = _mm256_add_epi64(_mm256_mul_epi32(x, y), _mm256_mul_epi32(xIm, yIm));
+                im = _mm256_sub_epi64(_mm256_mul_epi32(xIm, y), _mm256_mul_epi32(x, yIm));
+            }
+            // The low 32 bits of each shifted product are the same with a logical shift
+            _mm256_storeu_si256((__m256i*) (out + 2*i), _mm256_blend_epi32(_mm256_srl_epi64(re, shiftDown),
+                                                                          _mm256_sll_epi64(im, shiftUp), 0xAA));
+        }
+        ComplexArrayOpScalar<int32_t, int64_t>(op, a + 2*i, b + 2*i, out + 2*i, count - i, numFracBits);
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void MagnitudeSquaredAvx2(const int16_t* a, int16_t* out, std::size_t count, uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m256i lowMask = _mm256_set1_epi32(0x0000FFFF);
+        std::size_t i = 0;
+        for(; i + 16 <= count; i += 16) {
+            const __m256i x0 = _mm256_loadu_si256((const __m256i*) (a + 2*i));
+            const __m256i x1 = _mm256_loadu_si256((const __m256i*) (a + 2*i + 16));
+            // Only the low 16 bits are kept, and packing values from 0 to 65535 doesn't saturate
+            const __m256i y0 = _mm256_and_si256(_mm256_sra_epi32(_mm256_madd_epi16(x0, x0), shiftDown), lowMask);
+            const __m256i y1 = _mm256_and_si256(_mm256_sra_epi32(_mm256_madd_epi16(x1, x1), shiftDown), lowMask);
+            _mm256_storeu_si256((__m256i*) (out + i), _mm256_permute4x64_epi64(_mm256_packus_epi32(y0, y1), 0xD8));
+        }
+        MagnitudeSquaredScalar<int16_t, int32_t>(a + 2*i, out + i, count - i, numFracBits);
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void MagnitudeSquaredAvx2(const int32_t* a, int32_t* out, std::size_t count, uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m256i evenLanes = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m256i x = _mm256_loadu_si256((const __m256i*) (a + 2*i));
+            const __m256i xIm = _mm256_srli_epi64(x, 32);
+            const __m256i sum = _mm256_add_epi64(_mm256_mul_epi32(x, x), _mm256_mul_epi32(xIm, xIm));
+            const __m256i y = _mm256_permutevar8x32_epi32(_mm256_srl_epi64(sum, shiftDown), evenLanes);
+            _mm_storeu_si128((__m128i*) (out + i), _mm256_castsi256_si128(y));
+        }
+        MagnitudeSquaredScalar<int32_t, int64_t>(a + 2*i, out + i, count - i, numFracBits);
+    }
+
+#endif // #if MN_MFIXEDPOINT_X86_SIMD
+
+    /// \brief      Runs a complex array operation with the portable scalar loop.
+    template<class BaseType, class OverflowType>
+    void ComplexArrayOpDispatch(ComplexArrayOp op, const BaseType* a, const BaseType* b, BaseType* out,
+                                std::size_t count, uint8_t numFracBits) {
+        ComplexArrayOpScalar<BaseType, OverflowType>(op, a, b, out, count, numFracBits);
+    }
+
+    /// \brief      Calculates re^2 + im^2 of interleaved raw values with the portable scalar loop.
+    template<class BaseType, class OverflowType>
+    void MagnitudeSquaredDispatch(const BaseType* a, BaseType* out, std::size_t count, uint8_t numFracBits) {
+        MagnitudeSquaredScalar<BaseType, OverflowType>(a, out, count, numFracBits);
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+    /// \brief      Runs a FpF32 complex array operation with AVX2, if available.
+    template<>
+    inline void ComplexArrayOpDispatch<int32_t, int64_t>(ComplexArrayOp op, const int32_t* a, const int32_t* b,
+                                                         int32_t* out, std::size_t count, uint8_t numFracBits) {
+        if(ActiveSimdIsa() >= SimdIsa::Avx2)
+            ComplexArrayOpAvx2(op, a, b, out, count, numFracBits);
+        else
+            ComplexArrayOpScalar<int32_t, int64_t>(op, a, b, out, count, numFracBits);
+    }
+
+    /// \brief      Runs a FpF16 complex array operation with AVX2, if available.
+    template<>
+    inline void ComplexArrayOpDispatch<int16_t, int32_t>(ComplexArrayOp op, const int16_t* a, const int16_t* b,
+                                                         int16_t* out, std::size_t count, uint8_t numFracBits) {
+        if(ActiveSimdIsa() >= SimdIsa::Avx2)
+            ComplexArrayOpAvx2(op, a, b, out, count, numFracBits);
+        else
+            ComplexArrayOpScalar<int16_t, int32_t>(op, a, b, out, count, numFracBits);
+    }
+
+    /// \brief      Calculates re^2 + im^2 of interleaved raw FpF32 values with AVX2, if available.
+    template<>
+    inline void MagnitudeSquaredDispatch<int32_t, int64_t>(const int32_t* a, int32_t* out, std::size_t count,
+                                                           uint8_t numFracBits) {
+        if(ActiveSimdIsa() >= SimdIsa::Avx2)
+            MagnitudeSquaredAvx2(a, out, count, numFracBits);
+        else
+            MagnitudeSquaredScalar<int32_t, int64_t>(a, out, count, numFracBits);
+    }
+
+    /// \brief      Calculates re^2 + im^2 of interleaved raw FpF16 values with AVX2, if available.
+    template<>
+    inline void MagnitudeSquaredDispatch<int16_t, int32_t>(const int16_t* a, int16_t* out, std::size_t count,
+                                                           uint8_t numFracBits) {
+        if(ActiveSimdIsa() >= SimdIsa::Avx2)
+            MagnitudeSquaredAvx2(a, out, count, numFracBits);
+        else
+            MagnitudeSquaredScalar<int16_t, int32_t>(a, out, count, numFracBits);
+    }
+#endif
+
+    /// \brief      Converts a pointer to an array of FpComplex numbers to a pointer to their interleaved raw values.
+    template<class BaseType, class OverflowType, uint8_t numFracBits>
+    const BaseType* ComplexRawPointer(const FpComplex<FpF<BaseType, OverflowType, numFracBits>>* values) {
+        static_assert(sizeof(FpComplex<FpF<BaseType, OverflowType, numFracBits>>) == 2*sizeof(BaseType),
+                      "FpComplex arrays must have the same memory layout as interleaved arrays of BaseType.");
+        return reinterpret_cast<const BaseType*>(values);
+    }
+
+    template<class BaseType, class OverflowType, uint8_t numFracBits>
+    BaseType* ComplexRawPointer(FpComplex<FpF<BaseType, OverflowType, numFracBits>>* values) {
+        static_assert(sizeof(FpComplex<FpF<BaseType, OverflowType, numFracBits>>) == 2*sizeof(BaseType),
+                      "FpComplex arrays must have the same memory layout as interleaved arrays of BaseType.");
+        return reinterpret_cast<BaseType*>(values);
+    }
+
+} // namespace detail
+
+/// \brief      out[i] = a[i] * b[i], for i = 0 to count - 1.
+/// \details    Gives identical results to the FpComplex '*' operator. out may be the same array as a or b.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayComplexMultiply(const FpComplex<FpF<BaseType, OverflowType, numFracBits>>* a,
+                          const FpComplex<FpF<BaseType, OverflowType, numFracBits>>* b,
+                          FpComplex<FpF<BaseType, OverflowType, numFracBits>>* out, std::size_t count) {
+    detail::ComplexArrayOpDispatch<BaseType, OverflowType>(detail::ComplexArrayOp::Multiply,
+                                                           detail::ComplexRawPointer(a), detail::ComplexRawPointer(b),
+                                                           detail::ComplexRawPointer(out), count, numFracBits);
+}
+
+/// \brief      out[i] = a[i] * conj(b[i]), for i = 0 to count - 1 (e.g. to correlate or mix down I/Q samples).
+/// \details    Gives identical results to a[i] * b[i].Conj() (but unlike Conj(), never overflows when an
+///             imaginary component is the min. value). out may be the same array as a or b.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayComplexMultiplyConj(const FpComplex<FpF<BaseType, OverflowType, numFracBits>>* a,
+                              const FpComplex<FpF<BaseType, OverflowType, numFracBits>>* b,
+                              FpComplex<FpF<BaseType, OverflowType, numFracBits>>* out, std::size_t count) {
+    detail::ComplexArrayOpDispatch<BaseType, OverflowType>(detail::ComplexArrayOp::MultiplyConj,
+                                                           detail::ComplexRawPointer(a), detail::ComplexRawPointer(b),
+                                                           detail::ComplexRawPointer(out), count, numFracBits);
+}
+
+/// \brief      out[i] = a[i].MagnitudeSquared(), for i = 0 to count - 1.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayMagnitudeSquared(const FpComplex<FpF<BaseType, OverflowType, numFracBits>>* a,
+                           FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+    static_assert(sizeof(FpF<BaseType, OverflowType, numFracBits>) == sizeof(BaseType),
+                  "FpF arrays must have the same memory layout as arrays of BaseType.");
+    detail::MagnitudeSquaredDispatch<BaseType, OverflowType>(detail::ComplexRawPointer(a),
+                                                             reinterpret_cast<BaseType*>(out), count, numFracBits);
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FP_COMPLEX_H
+
+// EOF
@@ -20,10 +20,15 @@
 #define MN_MFIXEDPOINT_FpF_H
 
 // System includes
+#include <cstddef>
 #include <ostream>
 #include <stdint.h>
 #include <string>
 
+// User includes
+#include "MFixedPoint/FpChars.hpp"
+#include "MFixedPoint/Int128.hpp"
+
 namespace mn {
 namespace MFixedPoint {
 
@@ -42,7 +47,7 @@ namespace MFixedPoint {
 /// 			prevent intermediary overflow problems.
 /// \note 		Slower than FpF::FixMulF()
 template<class BaseType, class OverflowType, uint8_t numFracBits>
-inline BaseType FpFMultiply(BaseType a, BaseType b) {
+constexpr BaseType FpFMultiply(BaseType a, BaseType b) {
     return (BaseType) (((OverflowType) a * b) >> numFracBits);
 }
 
@@ -145,18 +150,20 @@ inline BaseType FpFMultiply(BaseType a, BaseType b) {
 /// \brief		Converts from float to a raw 32-bit fixed-point number.
 /// \details	Do not write "myFpNum = FloatToRawFix32()"! This function outputs a raw
 ///				number, so you would have to use the syntax "myFpNum.rawVal_ = FloatToRawFix32()".
-/// \warning	Slow!
+/// \warning	Slow! Undefined behaviour if the number doesn't fit, see FromFloat() in FpFConvert.hpp for
+///				a version which rounds and saturates.
 template<uint8_t q>
-int32_t FloatToRawFix32(float f) {
+constexpr int32_t FloatToRawFix32(float f) {
     return (int32_t) (f * (1 << q));
 }
 
 /// \brief		Converts from double to a raw 32-bit fixed-point number.
 /// \details	Do not write "myFpNum = DoubleToRawFix32()"! This function outputs a raw
 ///				number, so you would have to use the syntax "myFpNum.rawVal_ = DoubleToRawFix32()".
-/// \warning	Slow!
+/// \warning	Slow! Undefined behaviour if the number doesn't fit, see FromFloat() in FpFConvert.hpp for
+///				a version which rounds and saturates.
 template<uint8_t q>
-int32_t DoubleToRawFix32(double f) {
+constexpr int32_t DoubleToRawFix32(double f) {
     return (int32_t) (f * (double) (1 << q));
 }
 
@@ -199,26 +206,36 @@ public:
     //===============================================================================================//
 
     /// \brief		Get the raw value (memory representation) of this fixed-point number,
-    BaseType GetRawVal() const {
+    constexpr BaseType GetRawVal() const {
         return rawVal_;
     }
 
-    FpF(int8_t i) :
-            rawVal_((BaseType) i << numFracBits) {}
+    /// \brief		Creates a fixed-point number directly from a raw value (memory representation).
+    /// \details	No shifting is performed, rawVal is expected to already have numFracBits of
+    ///				fractional precision.
+    static constexpr FpF FromRaw(BaseType rawVal) {
+        return FpF(rawVal, RawTag());
+    }
+
+    constexpr FpF(int8_t i) :
+            rawVal_(IntToRaw(i)) {}
 
-    FpF(int16_t i) :
-            rawVal_((BaseType) i << numFracBits) {}
+    constexpr FpF(int16_t i) :
+            rawVal_(IntToRaw(i)) {}
 
-    FpF(int32_t i) :
-            rawVal_((BaseType)i << numFracBits) {}
+    constexpr FpF(int32_t i) :
+            rawVal_(IntToRaw(i)) {}
 
     /// \brief		Constructor that accepts a float.
-    FpF(float f) :
-            rawVal_((BaseType) (f * (float) ((BaseType) 1 << numFracBits))) {}
+    /// \details	Truncates towards zero. Undefined behaviour if f doesn't fit, see FromFloat() in
+    ///				FpFConvert.hpp for conversions with rounding and saturation.
+    constexpr FpF(float f) :
+            rawVal_((BaseType) (f * (float) ((uint64_t) 1 << numFracBits))) {}
 
     /// \brief		Create a fixed-point number from a double.
-    FpF(double f) :
-            rawVal_((BaseType) (f * (double) ((BaseType) 1 << numFracBits))) {}
+    /// \details	constexpr, so constants (e.g. FpF32<16>(3.14159)) can be calculated at compile time.
+    constexpr FpF(double f) :
+            rawVal_((BaseType) (f * (double) ((uint64_t) 1 << numFracBits))) {}
 
     //===============================================================================================//
     //================================= COMPOUND ARITHMETIC OVERLOADS ===============================//
@@ -260,81 +277,70 @@ public:
 
 
     // Simple Arithmetic Overloads
+    // These are written as single expressions (rather than using the compound operators) so that they can
+    // be constexpr in C++11.
 
     /// \brief		Overload for '-itself' operator.
-    FpF operator - () const {
-        FpF x;
-        x.rawVal_ = -rawVal_;
-        return x;
+    constexpr FpF operator - () const {
+        return FromRaw((BaseType) -rawVal_);
     }
 
     /// \brief		Overload for '+' operator.
-    /// \details	Uses '+=' operator.
-    FpF operator + (const FpF& r) const {
-        FpF x = *this;
-        x += r;
-        return x;
+    constexpr FpF operator + (const FpF& r) const {
+        return FromRaw((BaseType) (rawVal_ + r.rawVal_));
     }
 
     /// \brief		Overload for '-' operator.
-    /// \details	Uses '-=' operator.
-    FpF operator - (const FpF& r) const {
-        FpF x = *this;
-        x -= r;
-        return x;
+    constexpr FpF operator - (const FpF& r) const {
+        return FromRaw((BaseType) (rawVal_ - r.rawVal_));
     }
 
     /// \brief		Overload for '*' operator.
-    /// \details	Uses '*=' operator.
+    /// \details	Uses intermediatary casting to OverflowType to prevent overflows.
     template<class BaseTypeR, class OverflowTypeR, uint8_t numFracBitsR>
-    FpF<BaseType, OverflowType, numFracBits> operator*(FpF<BaseTypeR, OverflowTypeR, numFracBitsR> r) const {
+    constexpr FpF<BaseType, OverflowType, numFracBits> operator*(FpF<BaseTypeR, OverflowTypeR, numFracBitsR> r) const {
         SAME_TEMPLATE_PARAM_CHECK();
-        FpF<BaseType, OverflowType, numFracBits> x = *this;
-        x *= r;
-        return x;
+        return FromRaw(FpFMultiply<BaseType, OverflowType, numFracBits>(rawVal_, r.rawVal_));
     }
 
     /// \brief		Overload for '/' operator.
-    /// \details	Uses '/=' operator.
+    /// \details	Uses intermediatary casting to OverflowType to prevent overflows. The numerator is scaled with a
+    ///				multiply rather than a left shift, which is not allowed on negative numbers in a constant expression.
     template<class BaseTypeR, class OverflowTypeR, uint8_t numFracBitsR>
-    FpF operator/(FpF<BaseTypeR, OverflowTypeR, numFracBitsR> r) const {
+    constexpr FpF operator/(FpF<BaseTypeR, OverflowTypeR, numFracBitsR> r) const {
         SAME_TEMPLATE_PARAM_CHECK();
-        FpF x = *this;
-        x /= r;
-        return x;
+        return FromRaw((BaseType) (((OverflowType) rawVal_ * ((OverflowType) 1 << numFracBits)) /
+                                   (OverflowType) r.rawVal_));
     }
 
     /// \brief		Overload for '%' operator.
-    /// \details	Uses '%=' operator.
-    FpF operator % (const FpF& r) const {
-        FpF x = *this;
-        x %= r;
-        return x;
+    constexpr FpF operator % (const FpF& r) const {
+        return FromRaw((BaseType) (rawVal_ % r.rawVal_));
     }
 
     // FpF-FpF Binary Operator Overloads
 
-    bool operator == (const FpF& r) const {
+    constexpr bool operator == (const FpF& r) const {
         return rawVal_ == r.rawVal_;
     }
 
-    bool operator != (const FpF &r) {
+    constexpr bool operator != (const FpF &r) const {
         return !(*this == r);
     }
 
-    bool operator < (const FpF &r) {
+    constexpr bool operator < (const FpF &r) const {
         return rawVal_ < r.rawVal_;
     }
 
-    bool operator > (const FpF &r) {
+    constexpr bool operator > (const FpF &r) const {
         return rawVal_ > r.rawVal_;
     }
 
-    bool operator <= (const FpF& r) const {
+    constexpr bool operator <= (const FpF& r) const {
         return rawVal_ <= r.rawVal_;
     }
 
-    bool operator >= (const FpF& r) const {
+    constexpr bool operator >= (const FpF& r) const {
         return rawVal_ >= r.rawVal_;
     }
 
@@ -346,52 +352,52 @@ public:
     /// \details	Always rounds to negative infinity (66.3 becomes 66, -66.3 becomes -67).
     /// \tparam		IntType		The return integer type.
     template<class IntType>
-    IntType ToInt() const {
+    constexpr IntType ToInt() const {
         // Right-shift to get rid of all the decimal bits
         // This rounds towards negative infinity
         return (IntType) (rawVal_ >> numFracBits);
     }
 
     /// \brief		Converts the fixed-point number to a float.
-    float ToFloat() const {
-        return (float) rawVal_ / (float) ((BaseType) 1 << numFracBits);
+    constexpr float ToFloat() const {
+        return (float) rawVal_ / (float) ((uint64_t) 1 << numFracBits);
     }
 
     /// \brief		Converts the fixed-point number to a double.
-    double ToDouble() const {
-        return (double) rawVal_ / (double) ((BaseType) 1 << numFracBits);
+    constexpr double ToDouble() const {
+        return (double) rawVal_ / (double) ((uint64_t) 1 << numFracBits);
     }
 
     /// \brief		Conversion operator from fixed-point to int16_t.
     /// \details    Truncates answer.
-    explicit operator int16_t() {
+    explicit constexpr operator int16_t() const {
         // Right-shift to get rid of all the decimal bits (truncate)
         return (int16_t) (rawVal_ >> numFracBits);
     }
 
     /// \brief		Conversion operator from fixed-point to int32_t.
     /// \details    Truncates answer.
-    explicit operator int32_t() {
+    explicit constexpr operator int32_t() const {
         // Right-shift to get rid of all the decimal bits (truncate)
         return (int32_t)(rawVal_ >> numFracBits);
     }
 
     /// \brief		Conversion operator from fixed-point to int64_t.
     /// \details    Truncates answer.
-    explicit operator int64_t() {
+    explicit constexpr operator int64_t() const {
         // Right-shift to get rid of all the decimal bits (truncate)
         return (int64_t) (rawVal_ >> numFracBits);
     }
 
     /// \brief		Conversion operator from fixed-point to float.
-    explicit operator float() {
-        return (float) rawVal_ / (float) (1 << numFracBits);
+    explicit constexpr operator float() const {
+        return ToFloat();
     }
 
     /// \brief		Conversion operator from fixed-point to double.
     /// \note		Similar to float conversion.
-    explicit operator double() {
-        return (double) rawVal_ / (double) (1 << numFracBits);
+    explicit constexpr operator double() const {
+        return ToDouble();
     }
 
     /// \}
@@ -410,62 +416,74 @@ public:
         return *this;
     }
 
-    FpF operator + (int r) const {
-        FpF x = *this;
-        x += FpF(r);
-        return x;
+    constexpr FpF operator + (int r) const {
+        return FromRaw((BaseType) (rawVal_ + IntToRaw(r)));
     }
 
-    FpF operator - (int r) const {
-        FpF x = *this;
-        x -= r;
-        return x;
+    constexpr FpF operator - (int r) const {
+        return FromRaw((BaseType) (rawVal_ - IntToRaw(r)));
     }
 
-    FpF operator * (int r) const {
-        FpF x = *this;
-        x *= r;
-        return x;
+    constexpr FpF operator * (int r) const {
+        return FromRaw((BaseType) (rawVal_ * r));
     }
 
-    FpF operator / (int r) const {
-        FpF x = *this;
-        x /= r;
-        return x;
+    constexpr FpF operator / (int r) const {
+        return FromRaw((BaseType) (rawVal_ / r));
     }
 
-    bool operator >(int r) const {
-        return rawVal_ > ((BaseType)r << numFracBits);
+    constexpr bool operator >(int r) const {
+        return rawVal_ > IntToRaw(r);
     }
 
-    bool operator >=(int r) const {
-        return rawVal_ >= ((BaseType)r << numFracBits);
+    constexpr bool operator >=(int r) const {
+        return rawVal_ >= IntToRaw(r);
     }
 
-    bool operator < (int r) const {
-        return rawVal_ < ((BaseType)r << numFracBits);
+    constexpr bool operator < (int r) const {
+        return rawVal_ < IntToRaw(r);
     }
 
-    bool operator <= (int r) const {
-        return rawVal_ <= ((BaseType)r << numFracBits);
+    constexpr bool operator <= (int r) const {
+        return rawVal_ <= IntToRaw(r);
     }
 
-    bool operator ==(int r) const {
-        return rawVal_ == ((BaseType)r << numFracBits);
+    constexpr bool operator ==(int r) const {
+        return rawVal_ == IntToRaw(r);
     }
 
-    bool operator !=(int r) const {
-        return rawVal_ != ((BaseType)r << numFracBits);
+    constexpr bool operator !=(int r) const {
+        return rawVal_ != IntToRaw(r);
     }
 
     //===============================================================================================//
     //====================================== STRING/STREAM RELATED ==================================//
     //===============================================================================================//
 
-    /// \brief		Converts the fixed-point number into a string representation, using a fixed-point->double->string
-    /// 				conversion process.
+    /// \brief		Converts the fixed-point number into a string with 6 decimal places (the same as
+    ///				std::to_string(ToDouble()), but formatted directly from the raw value).
     std::string ToString() const {
-        return std::to_string(ToDouble());
+        char buffer[32];
+        return std::string(buffer, ToChars(buffer, buffer + sizeof(buffer), 6).ptr);
+    }
+
+    /// \brief		Writes the number to [first, last) in decimal, without allocating or converting to a double.
+    /// \details	numDigits is the number of decimal places (rounded to nearest, ties to even, like printf()), or
+    ///				exactDigits for the exact decimal expansion (at most numFracBits decimal places).
+    ToCharsResult ToChars(char* first, char* last, int numDigits = exactDigits) const {
+        return detail::RawToChars(first, last, rawVal_, std::integral_constant<unsigned, numFracBits>(), numDigits);
+    }
+
+    /// \brief		Parses a decimal number ([-]digits[.digits]) from [first, last) into value, rounding to the
+    ///				nearest representable number (ties to even), without going through a double.
+    /// \details	Works like std::from_chars(), see FromCharsResult for the errors.
+    static FromCharsResult FromChars(const char* first, const char* last, FpF& value) {
+        int64_t rawVal;
+        const FromCharsResult result = detail::CharsToRaw(first, last, std::integral_constant<unsigned, numFracBits>(),
+                                                          sizeof(BaseType) * 8, rawVal);
+        if(result.ec == std::errc())
+            value = FromRaw((BaseType) rawVal);
+        return result;
     }
 
     /// \brief      Overload so we can print to a ostream (e.g. std::cout).
@@ -476,6 +494,19 @@ public:
 
 private:
 
+    /// \brief		Used to select the constructor which takes a raw value.
+    struct RawTag {};
+
+    constexpr FpF(BaseType rawVal, RawTag) :
+            rawVal_(rawVal) {}
+
+    /// \brief		Converts an integer to a raw value.
+    /// \details	The shift is done on an unsigned number, as left-shifting a negative number is not allowed in
+    ///				a constant expression.
+    static constexpr BaseType IntToRaw(int64_t i) {
+        return (BaseType) ((uint64_t) i << numFracBits);
+    }
+
     /// \brief		The fixed-point number is stored in this basic data type.
     BaseType rawVal_;
 
@@ -490,8 +521,38 @@ using FpF16 = FpF<int16_t, int32_t, numFracBits>;
 template<uint8_t numFracBits>
 using FpF32 = FpF<int32_t, int64_t, numFracBits>;
 
+/// \brief      Uses a 128-bit OverflowType so that multiplication and division are protected from
+///             intermediary overflows (native __int128 where available, otherwise Int128Emulated).
 template<uint8_t numFracBits>
-using FpF64 = FpF<int64_t, int64_t, numFracBits>;
+using FpF64 = FpF<int64_t, Int128, numFracBits>;
+
+//===============================================================================================//
+//======================================= USER-DEFINED LITERALS =================================//
+//===============================================================================================//
+
+/// \brief		User-defined literals for FpF32 numbers, e.g. 1.5_q16 is a FpF32<16>(1.5).
+/// \details	These are constexpr, so the raw value is calculated at compile time. Brought into scope by
+///				either "using namespace mn::MFixedPoint" or "using namespace mn::MFixedPoint::literals".
+inline namespace literals {
+
+#define MN_MFIXEDPOINT_FPF32_LITERAL(numFracBits) \
+        constexpr FpF32<numFracBits> operator"" _q##numFracBits(long double value) { \
+            return FpF32<numFracBits>((double) value); \
+        } \
+        constexpr FpF32<numFracBits> operator"" _q##numFracBits(unsigned long long value) { \
+            return FpF32<numFracBits>((int32_t) value); \
+        }
+
+MN_MFIXEDPOINT_FPF32_LITERAL(8)
+MN_MFIXEDPOINT_FPF32_LITERAL(12)
+MN_MFIXEDPOINT_FPF32_LITERAL(16)
+MN_MFIXEDPOINT_FPF32_LITERAL(20)
+MN_MFIXEDPOINT_FPF32_LITERAL(24)
+MN_MFIXEDPOINT_FPF32_LITERAL(28)
+
+#undef MN_MFIXEDPOINT_FPF32_LITERAL
+
+} // inline namespace literals
 
 
 // math functions
@@ -563,20 +624,40 @@ using FpF64 = FpF<int64_t, int64_t, numFracBits>;
 // 	return r;
 // }
 
-// // The multiply accumulate case can be optimized.
-// template <uint8_t numFracBits>
-// inline FpF<numFracBits> multiply_accumulate(
-// 	int32_t count, 
-// 	const FpF<numFracBits> *a,
-// 	const FpF<numFracBits> *b)
-// {
-// 	long long result = 0;
-// 	for (int32_t i = 0; i < count; ++i)
-// 		result += static_cast<long long>(a[i].rawVal_) * b[i].rawVal_;
-// 	FpF<numFracBits> r;
-// 	r.rawVal_ = static_cast<int32_t>(result >> numFracBits);
-// 	return r;
-// }
+//===============================================================================================//
+//==================================== BATCH (ARRAY) OPERATIONS =================================//
+//===============================================================================================//
+
+/// \brief		Calculates acc + sum(a[i]*b[i]) for i = 0 to count - 1.
+/// \details	The products are accumulated in OverflowType at double the fractional precision, and the
+///				result is only shifted back down by numFracBits once at the very end. This is both faster and
+///				more precise than writing "acc += a[i] * b[i]" in a loop, which shifts (and truncates) every
+///				product.
+/// \warning	The sum of all raw products (plus the accumulator) must fit in OverflowType. For FpF32 this
+///				gives 64 - 2*32 + 1 = 1 bit of headroom when the inputs use their full range, so keep the
+///				magnitude of the inputs small compared to the range of BaseType when count is large.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> MultiplyAccumulate(
+        FpF<BaseType, OverflowType, numFracBits> acc,
+        const FpF<BaseType, OverflowType, numFracBits>* a,
+        const FpF<BaseType, OverflowType, numFracBits>* b,
+        std::size_t count) {
+    OverflowType result = (OverflowType) acc.GetRawVal() << numFracBits;
+    for (std::size_t i = 0; i < count; ++i) {
+        result += (OverflowType) a[i].GetRawVal() * b[i].GetRawVal();
+    }
+    return FpF<BaseType, OverflowType, numFracBits>::FromRaw((BaseType) (result >> numFracBits));
+}
+
+/// \brief		Calculates the dot product sum(a[i]*b[i]) for i = 0 to count - 1.
+/// \details	Uses MultiplyAccumulate() with a zero accumulator, so only one shift is performed.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> DotProduct(
+        const FpF<BaseType, OverflowType, numFracBits>* a,
+        const FpF<BaseType, OverflowType, numFracBits>* b,
+        std::size_t count) {
+    return MultiplyAccumulate(FpF<BaseType, OverflowType, numFracBits>::FromRaw(0), a, b, count);
+}
 
 //===============================================================================================//
 //======================================== GRAVEYARD ============================================//
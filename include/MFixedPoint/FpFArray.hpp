@@ -0,0 +1,674 @@
+///
+/// \file 				FpFArray.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-17
+/// \brief 				Element-wise arithmetic on arrays of FpF numbers.
+/// \details
+///		The FpF16 and FpF32 overloads use SSE4.1/AVX2/AVX-512 kernels on x86 (the best instruction set is
+///		picked at runtime via CPUID). All other types and platforms (e.g. ARM Cortex-M) use a portable
+///		scalar loop which gives bit-identical results. Define MN_MFIXEDPOINT_NO_SIMD to force the scalar
+///		loop everywhere.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPF_ARRAY_H
+#define MN_MFIXEDPOINT_FPF_ARRAY_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+
+#if !defined(MN_MFIXEDPOINT_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define MN_MFIXEDPOINT_X86_SIMD 1
+    #include <immintrin.h>
+    /// \brief      Compiles a single function for the given instruction set, regardless of the -m flags.
+    #define MN_MFIXEDPOINT_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define MN_MFIXEDPOINT_X86_SIMD 0
+#endif
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      The instruction sets the array functions can use.
+/// \details    Ordered from slowest to fastest.
+enum class SimdIsa {
+    Scalar,
+    Sse41,
+    Avx2,
+    Avx512,
+};
+
+namespace detail {
+
+    /// \brief      The element-wise operations supported by the array kernels.
+    enum class ArrayOp {
+        Add,
+        Subtract,
+        Multiply,
+        Scale,
+        Negate,
+    };
+
+    /// \brief      Queries the CPU for the best supported instruction set.
+    inline SimdIsa DetectSimdIsa() {
+#if MN_MFIXEDPOINT_X86_SIMD
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            return SimdIsa::Avx512;
+        if(__builtin_cpu_supports("avx2"))
+            return SimdIsa::Avx2;
+        if(__builtin_cpu_supports("sse4.1"))
+            return SimdIsa::Sse41;
+#endif
+        return SimdIsa::Scalar;
+    }
+
+    /// \brief      The instruction set currently used by the array functions.
+    /// \details    Detected once, on first use.
+    inline SimdIsa& ActiveSimdIsa() {
+        static SimdIsa isa = DetectSimdIsa();
+        return isa;
+    }
+
+    /// \brief      Portable implementation of all array operations, works with every FpF type.
+    /// \details    b is ignored for ArrayOp::Negate, and b[0] is used for every element with ArrayOp::Scale.
+    template<class BaseType, class OverflowType>
+    void ArrayOpScalar(ArrayOp op, const BaseType* a, const BaseType* b, BaseType* out, std::size_t count,
+                       uint8_t numFracBits) {
+        switch(op) {
+            case ArrayOp::Add:
+                for(std::size_t i = 0; i < count; i++)
+                    out[i] = (BaseType) (a[i] + b[i]);
+                break;
+            case ArrayOp::Subtract:
+                for(std::size_t i = 0; i < count; i++)
+                    out[i] = (BaseType) (a[i] - b[i]);
+                break;
+            case ArrayOp::Multiply:
+                for(std::size_t i = 0; i < count; i++)
+                    out[i] = (BaseType) (((OverflowType) a[i] * b[i]) >> numFracBits);
+                break;
+            case ArrayOp::Scale: {
+                const OverflowType scale = b[0];
+                for(std::size_t i = 0; i < count; i++)
+                    out[i] = (BaseType) (((OverflowType) a[i] * scale) >> numFracBits);
+                break;
+            }
+            case ArrayOp::Negate:
+                for(std::size_t i = 0; i < count; i++)
+                    out[i] = (BaseType) -a[i];
+                break;
+        }
+    }
+
+    /// \brief      Gives the unsigned counterpart of an OverflowType, so sums can wrap-around without
+    ///             signed overflow. Int128Emulated already wraps-around, so it is its own counterpart.
+    template<class OverflowType>
+    struct UnsignedOf { typedef OverflowType type; };
+    template<> struct UnsignedOf<int16_t> { typedef uint16_t type; };
+    template<> struct UnsignedOf<int32_t> { typedef uint32_t type; };
+    template<> struct UnsignedOf<int64_t> { typedef uint64_t type; };
+#if defined(__SIZEOF_INT128__) && !defined(MN_MFIXEDPOINT_NO_NATIVE_INT128)
+    template<> struct UnsignedOf<Int128> { __extension__ typedef unsigned __int128 type; };
+#endif
+
+    /// \brief      Portable dot product of two raw arrays, sum(a[i]*b[i]) for i = 0 to count - 1.
+    /// \details    The products are accumulated in the unsigned counterpart of OverflowType (so the sum
+    ///             wraps-around like the SIMD kernels) and not shifted (so the result has 2*numFracBits
+    ///             fractional bits).
+    template<class BaseType, class OverflowType>
+    OverflowType DotProductRawScalar(const BaseType* a, const BaseType* b, std::size_t count) {
+        typedef typename UnsignedOf<OverflowType>::type UnsignedType;
+        UnsignedType sum = 0;
+        for(std::size_t i = 0; i < count; i++)
+            sum += (UnsignedType) ((OverflowType) a[i] * b[i]);
+        return (OverflowType) sum;
+    }
+
+    /// \brief      Works out where b points to for the scalar tail of a SIMD kernel that stopped at element i.
+    template<class BaseType>
+    const BaseType* TailOfB(ArrayOp op, const BaseType* b, std::size_t i) {
+        return (op == ArrayOp::Scale || op == ArrayOp::Negate) ? b : b + i;
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+
+// GCC gives false positives from inside the AVX-512 intrinsic headers (which use _mm512_undefined_epi32())
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+    //===============================================================================================//
+    //============================================ SSE4.1 ===========================================//
+    //===============================================================================================//
+
+    /// \brief      Q-format multiply of four int32 lanes, (a*b) >> numFracBits.
+    /// \details    _mm_mul_epi32 only multiplies the even lanes, so the odd lanes are moved down and
+    ///             multiplied separately. Only the bits [numFracBits, numFracBits + 31] of each 64-bit
+    ///             product are kept, so a logical shift gives the same result as an arithmetic one.
+    MN_MFIXEDPOINT_TARGET("sse4.1")
+    inline __m128i MulQ32Sse41(__m128i a, __m128i b, __m128i shiftDown, __m128i shiftUp) {
+        __m128i even = _mm_srl_epi64(_mm_mul_epi32(a, b), shiftDown);
+        __m128i odd = _mm_sll_epi64(_mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), shiftUp);
+        return _mm_blend_epi16(even, odd, 0xCC);
+    }
+
+    /// \brief      Q-format multiply of eight int16 lanes, (a*b) >> numFracBits.
+    MN_MFIXEDPOINT_TARGET("sse4.1")
+    inline __m128i MulQ16Sse41(__m128i a, __m128i b, __m128i shiftDown, __m128i shiftUp) {
+        return _mm_or_si128(_mm_sll_epi16(_mm_mulhi_epi16(a, b), shiftUp),
+                            _mm_srl_epi16(_mm_mullo_epi16(a, b), shiftDown));
+    }
+
+    MN_MFIXEDPOINT_TARGET("sse4.1")
+    inline void ArrayOpSse41(ArrayOp op, const int32_t* a, const int32_t* b, int32_t* out, std::size_t count,
+                             uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m128i shiftUp = _mm_cvtsi32_si128(32 - numFracBits);
+        std::size_t i = 0;
+        switch(op) {
+            case ArrayOp::Add:
+                for(; i + 4 <= count; i += 4)
+                    _mm_storeu_si128((__m128i*) (out + i), _mm_add_epi32(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                                        _mm_loadu_si128((const __m128i*) (b + i))));
+                break;
+            case ArrayOp::Subtract:
+                for(; i + 4 <= count; i += 4)
+                    _mm_storeu_si128((__m128i*) (out + i), _mm_sub_epi32(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                                        _mm_loadu_si128((const __m128i*) (b + i))));
+                break;
+            case ArrayOp::Multiply:
+                for(; i + 4 <= count; i += 4)
+                    _mm_storeu_si128((__m128i*) (out + i), MulQ32Sse41(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                                      _mm_loadu_si128((const __m128i*) (b + i)),
+                                                                      shiftDown, shiftUp));
+                break;
+            case ArrayOp::Scale: {
+                const __m128i scale = _mm_set1_epi32(b[0]);
+                for(; i + 4 <= count; i += 4)
+                    _mm_storeu_si128((__m128i*) (out + i), MulQ32Sse41(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                                      scale, shiftDown, shiftUp));
+                break;
+            }
+            case ArrayOp::Negate:
+                for(; i + 4 <= count; i += 4)
+                    _mm_storeu_si128((__m128i*) (out + i), _mm_sub_epi32(_mm_setzero_si128(),
+                                                                        _mm_loadu_si128((const __m128i*) (a + i))));
+                break;
+        }
+        ArrayOpScalar<int32_t, int64_t>(op, a + i, TailOfB(op, b, i), out + i, count - i, numFracBits);
+    }
+
+    MN_MFIXEDPOINT_TARGET("sse4.1")
+    inline void ArrayOpSse41(ArrayOp op, const int16_t* a, const int16_t* b, int16_t* out, std::size_t count,
+                             uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m128i shiftUp = _mm_cvtsi32_si128(16 - numFracBits);
+        std::size_t i = 0;
+        switch(op) {
+            case ArrayOp::Add:
+                for(; i + 8 <= count; i += 8)
+                    _mm_storeu_si128((__m128i*) (out + i), _mm_add_epi16(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                                        _mm_loadu_si128((const __m128i*) (b + i))));
+                break;
+            case ArrayOp::Subtract:
+                for(; i + 8 <= count; i += 8)
+                    _mm_storeu_si128((__m128i*) (out + i), _mm_sub_epi16(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                                        _mm_loadu_si128((const __m128i*) (b + i))));
+                break;
+            case ArrayOp::Multiply:
+                for(; i + 8 <= count; i += 8)
+                    _mm_storeu_si128((__m128i*) (out + i), MulQ16Sse41(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                                      _mm_loadu_si128((const __m128i*) (b + i)),
+                                                                      shiftDown, shiftUp));
+                break;
+            case ArrayOp::Scale: {
+                const __m128i scale = _mm_set1_epi16(b[0]);
+                for(; i + 8 <= count; i += 8)
+                    _mm_storeu_si128((__m128i*) (out + i), MulQ16Sse41(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                                      scale, shiftDown, shiftUp));
+                break;
+            }
+            case ArrayOp::Negate:
+                for(; i + 8 <= count; i += 8)
+                    _mm_storeu_si128((__m128i*) (out + i), _mm_sub_epi16(_mm_setzero_si128(),
+                                                                        _mm_loadu_si128((const __m128i*) (a + i))));
+                break;
+        }
+        ArrayOpScalar<int16_t, int32_t>(op, a + i, TailOfB(op, b, i), out + i, count - i, numFracBits);
+    }
+
+    //===============================================================================================//
+    //============================================= AVX2 ============================================//
+    //===============================================================================================//
+
+    /// \brief      Q-format multiply of eight int32 lanes, see MulQ32Sse41().
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline __m256i MulQ32Avx2(__m256i a, __m256i b, __m128i shiftDown, __m128i shiftUp) {
+        __m256i even = _mm256_srl_epi64(_mm256_mul_epi32(a, b), shiftDown);
+        __m256i odd = _mm256_sll_epi64(_mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)), shiftUp);
+        return _mm256_blend_epi32(even, odd, 0xAA);
+    }
+
+    /// \brief      Q-format multiply of sixteen int16 lanes, see MulQ16Sse41().
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline __m256i MulQ16Avx2(__m256i a, __m256i b, __m128i shiftDown, __m128i shiftUp) {
+        return _mm256_or_si256(_mm256_sll_epi16(_mm256_mulhi_epi16(a, b), shiftUp),
+                               _mm256_srl_epi16(_mm256_mullo_epi16(a, b), shiftDown));
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void ArrayOpAvx2(ArrayOp op, const int32_t* a, const int32_t* b, int32_t* out, std::size_t count,
+                            uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m128i shiftUp = _mm_cvtsi32_si128(32 - numFracBits);
+        std::size_t i = 0;
+        switch(op) {
+            case ArrayOp::Add:
+                for(; i + 8 <= count; i += 8)
+                    _mm256_storeu_si256((__m256i*) (out + i), _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                                              _mm256_loadu_si256((const __m256i*) (b + i))));
+                break;
+            case ArrayOp::Subtract:
+                for(; i + 8 <= count; i += 8)
+                    _mm256_storeu_si256((__m256i*) (out + i), _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                                              _mm256_loadu_si256((const __m256i*) (b + i))));
+                break;
+            case ArrayOp::Multiply:
+                for(; i + 8 <= count; i += 8)
+                    _mm256_storeu_si256((__m256i*) (out + i), MulQ32Avx2(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                                        _mm256_loadu_si256((const __m256i*) (b + i)),
+                                                                        shiftDown, shiftUp));
+                break;
+            case ArrayOp::Scale: {
+                const __m256i scale = _mm256_set1_epi32(b[0]);
+                for(; i + 8 <= count; i += 8)
+                    _mm256_storeu_si256((__m256i*) (out + i), MulQ32Avx2(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                                        scale, shiftDown, shiftUp));
+                break;
+            }
+            case ArrayOp::Negate:
+                for(; i + 8 <= count; i += 8)
+                    _mm256_storeu_si256((__m256i*) (out + i), _mm256_sub_epi32(_mm256_setzero_si256(),
+                                                                              _mm256_loadu_si256((const __m256i*) (a + i))));
+                break;
+        }
+        ArrayOpScalar<int32_t, int64_t>(op, a + i, TailOfB(op, b, i), out + i, count - i, numFracBits);
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void ArrayOpAvx2(ArrayOp op, const int16_t* a, const int16_t* b, int16_t* out, std::size_t count,
+                            uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m128i shiftUp = _mm_cvtsi32_si128(16 - numFracBits);
+        std::size_t i = 0;
+        switch(op) {
+            case ArrayOp::Add:
+                for(; i + 16 <= count; i += 16)
+                    _mm256_storeu_si256((__m256i*) (out + i), _mm256_add_epi16(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                                              _mm256_loadu_si256((const __m256i*) (b + i))));
+                break;
+            case ArrayOp::Subtract:
+                for(; i + 16 <= count; i += 16)
+                    _mm256_storeu_si256((__m256i*) (out + i), _mm256_sub_epi16(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                                              _mm256_loadu_si256((const __m256i*) (b + i))));
+                break;
+            case ArrayOp::Multiply:
+                for(; i + 16 <= count; i += 16)
+                    _mm256_storeu_si256((__m256i*) (out + i), MulQ16Avx2(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                                        _mm256_loadu_si256((const __m256i*) (b + i)),
+                                                                        shiftDown, shiftUp));
+                break;
+            case ArrayOp::Scale: {
+                const __m256i scale = _mm256_set1_epi16(b[0]);
+                for(; i + 16 <= count; i += 16)
+                    _mm256_storeu_si256((__m256i*) (out + i), MulQ16Avx2(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                                        scale, shiftDown, shiftUp));
+                break;
+            }
+            case ArrayOp::Negate:
+                for(; i + 16 <= count; i += 16)
+                    _mm256_storeu_si256((__m256i*) (out + i), _mm256_sub_epi16(_mm256_setzero_si256(),
+                                                                              _mm256_loadu_si256((const __m256i*) (a + i))));
+                break;
+        }
+        ArrayOpScalar<int16_t, int32_t>(op, a + i, TailOfB(op, b, i), out + i, count - i, numFracBits);
+    }
+
+    //===============================================================================================//
+    //=========================================== AVX-512 ===========================================//
+    //===============================================================================================//
+
+    /// \brief      Q-format multiply of sixteen int32 lanes, see MulQ32Sse41().
+    MN_MFIXEDPOINT_TARGET("avx512f")
+    inline __m512i MulQ32Avx512(__m512i a, __m512i b, __m128i shiftDown, __m128i shiftUp) {
+        __m512i even = _mm512_srl_epi64(_mm512_mul_epi32(a, b), shiftDown);
+        __m512i odd = _mm512_sll_epi64(_mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32)), shiftUp);
+        return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+    }
+
+    /// \brief      Q-format multiply of thirty-two int16 lanes, see MulQ16Sse41().
+    MN_MFIXEDPOINT_TARGET("avx512bw")
+    inline __m512i MulQ16Avx512(__m512i a, __m512i b, __m128i shiftDown, __m128i shiftUp) {
+        return _mm512_or_si512(_mm512_sll_epi16(_mm512_mulhi_epi16(a, b), shiftUp),
+                               _mm512_srl_epi16(_mm512_mullo_epi16(a, b), shiftDown));
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx512f")
+    inline void ArrayOpAvx512(ArrayOp op, const int32_t* a, const int32_t* b, int32_t* out, std::size_t count,
+                              uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m128i shiftUp = _mm_cvtsi32_si128(32 - numFracBits);
+        std::size_t i = 0;
+        switch(op) {
+            case ArrayOp::Add:
+                for(; i + 16 <= count; i += 16)
+                    _mm512_storeu_si512(out + i, _mm512_add_epi32(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                break;
+            case ArrayOp::Subtract:
+                for(; i + 16 <= count; i += 16)
+                    _mm512_storeu_si512(out + i, _mm512_sub_epi32(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                break;
+            case ArrayOp::Multiply:
+                for(; i + 16 <= count; i += 16)
+                    _mm512_storeu_si512(out + i, MulQ32Avx512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i),
+                                                              shiftDown, shiftUp));
+                break;
+            case ArrayOp::Scale: {
+                const __m512i scale = _mm512_set1_epi32(b[0]);
+                for(; i + 16 <= count; i += 16)
+                    _mm512_storeu_si512(out + i, MulQ32Avx512(_mm512_loadu_si512(a + i), scale, shiftDown, shiftUp));
+                break;
+            }
+            case ArrayOp::Negate:
+                for(; i + 16 <= count; i += 16)
+                    _mm512_storeu_si512(out + i, _mm512_sub_epi32(_mm512_setzero_si512(), _mm512_loadu_si512(a + i)));
+                break;
+        }
+        ArrayOpScalar<int32_t, int64_t>(op, a + i, TailOfB(op, b, i), out + i, count - i, numFracBits);
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx512bw")
+    inline void ArrayOpAvx512(ArrayOp op, const int16_t* a, const int16_t* b, int16_t* out, std::size_t count,
+                              uint8_t numFracBits) {
+        const __m128i shiftDown = _mm_cvtsi32_si128(numFracBits);
+        const __m128i shiftUp = _mm_cvtsi32_si128(16 - numFracBits);
+        std::size_t i = 0;
+        switch(op) {
+            case ArrayOp::Add:
+                for(; i + 32 <= count; i += 32)
+                    _mm512_storeu_si512(out + i, _mm512_add_epi16(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                break;
+            case ArrayOp::Subtract:
+                for(; i + 32 <= count; i += 32)
+                    _mm512_storeu_si512(out + i, _mm512_sub_epi16(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                break;
+            case ArrayOp::Multiply:
+                for(; i + 32 <= count; i += 32)
+                    _mm512_storeu_si512(out + i, MulQ16Avx512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i),
+                                                              shiftDown, shiftUp));
+                break;
+            case ArrayOp::Scale: {
+                const __m512i scale = _mm512_set1_epi16(b[0]);
+                for(; i + 32 <= count; i += 32)
+                    _mm512_storeu_si512(out + i, MulQ16Avx512(_mm512_loadu_si512(a + i), scale, shiftDown, shiftUp));
+                break;
+            }
+            case ArrayOp::Negate:
+                for(; i + 32 <= count; i += 32)
+                    _mm512_storeu_si512(out + i, _mm512_sub_epi16(_mm512_setzero_si512(), _mm512_loadu_si512(a + i)));
+                break;
+        }
+        ArrayOpScalar<int16_t, int32_t>(op, a + i, TailOfB(op, b, i), out + i, count - i, numFracBits);
+    }
+
+    //===============================================================================================//
+    //========================================= DOT PRODUCTS ========================================//
+    //===============================================================================================//
+
+    // The int32 kernels multiply the even and odd lanes into 64-bit products separately (like the Q-format
+    // multiply above) and accumulate them in 64-bit lanes. The int16 kernels use madd, which multiplies
+    // pairs of lanes and adds them into 32-bit lanes. Both wrap around exactly like the scalar loop.
+
+    MN_MFIXEDPOINT_TARGET("sse4.1")
+    inline int64_t DotProductRawSse41(const int32_t* a, const int32_t* b, std::size_t count) {
+        __m128i sum = _mm_setzero_si128();
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m128i x = _mm_loadu_si128((const __m128i*) (a + i));
+            const __m128i y = _mm_loadu_si128((const __m128i*) (b + i));
+            sum = _mm_add_epi64(sum, _mm_mul_epi32(x, y));
+            sum = _mm_add_epi64(sum, _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32)));
+        }
+        uint64_t lanes[2];
+        _mm_storeu_si128((__m128i*) lanes, sum);
+        return (int64_t) (lanes[0] + lanes[1] + (uint64_t) DotProductRawScalar<int32_t, int64_t>(a + i, b + i, count - i));
+    }
+
+    MN_MFIXEDPOINT_TARGET("sse4.1")
+    inline int32_t DotProductRawSse41(const int16_t* a, const int16_t* b, std::size_t count) {
+        __m128i sum = _mm_setzero_si128();
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8)
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_loadu_si128((const __m128i*) (a + i)),
+                                                    _mm_loadu_si128((const __m128i*) (b + i))));
+        uint32_t lanes[4];
+        _mm_storeu_si128((__m128i*) lanes, sum);
+        return (int32_t) (lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                          (uint32_t) DotProductRawScalar<int16_t, int32_t>(a + i, b + i, count - i));
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline int64_t DotProductRawAvx2(const int32_t* a, const int32_t* b, std::size_t count) {
+        __m256i sum = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256i x = _mm256_loadu_si256((const __m256i*) (a + i));
+            const __m256i y = _mm256_loadu_si256((const __m256i*) (b + i));
+            sum = _mm256_add_epi64(sum, _mm256_mul_epi32(x, y));
+            sum = _mm256_add_epi64(sum, _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32)));
+        }
+        uint64_t lanes[4];
+        _mm256_storeu_si256((__m256i*) lanes, sum);
+        return (int64_t) (lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                          (uint64_t) DotProductRawScalar<int32_t, int64_t>(a + i, b + i, count - i));
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline int32_t DotProductRawAvx2(const int16_t* a, const int16_t* b, std::size_t count) {
+        __m256i sum = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for(; i + 16 <= count; i += 16)
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_loadu_si256((const __m256i*) (a + i)),
+                                                          _mm256_loadu_si256((const __m256i*) (b + i))));
+        uint32_t lanes[8];
+        _mm256_storeu_si256((__m256i*) lanes, sum);
+        uint32_t total = (uint32_t) DotProductRawScalar<int16_t, int32_t>(a + i, b + i, count - i);
+        for(int lane = 0; lane < 8; lane++)
+            total += lanes[lane];
+        return (int32_t) total;
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx512f")
+    inline int64_t DotProductRawAvx512(const int32_t* a, const int32_t* b, std::size_t count) {
+        __m512i sum = _mm512_setzero_si512();
+        std::size_t i = 0;
+        for(; i + 16 <= count; i += 16) {
+            const __m512i x = _mm512_loadu_si512(a + i);
+            const __m512i y = _mm512_loadu_si512(b + i);
+            sum = _mm512_add_epi64(sum, _mm512_mul_epi32(x, y));
+            sum = _mm512_add_epi64(sum, _mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32)));
+        }
+        uint64_t lanes[8];
+        _mm512_storeu_si512(lanes, sum);
+        uint64_t total = (uint64_t) DotProductRawScalar<int32_t, int64_t>(a + i, b + i, count - i);
+        for(int lane = 0; lane < 8; lane++)
+            total += lanes[lane];
+        return (int64_t) total;
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx512bw")
+    inline int32_t DotProductRawAvx512(const int16_t* a, const int16_t* b, std::size_t count) {
+        __m512i sum = _mm512_setzero_si512();
+        std::size_t i = 0;
+        for(; i + 32 <= count; i += 32)
+            sum = _mm512_add_epi32(sum, _mm512_madd_epi16(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+        uint32_t lanes[16];
+        _mm512_storeu_si512(lanes, sum);
+        uint32_t total = (uint32_t) DotProductRawScalar<int16_t, int32_t>(a + i, b + i, count - i);
+        for(int lane = 0; lane < 16; lane++)
+            total += lanes[lane];
+        return (int32_t) total;
+    }
+
+#pragma GCC diagnostic pop
+
+#endif // #if MN_MFIXEDPOINT_X86_SIMD
+
+    /// \brief      Runs an array operation with the portable scalar loop.
+    template<class BaseType, class OverflowType>
+    void ArrayOpDispatch(ArrayOp op, const BaseType* a, const BaseType* b, BaseType* out, std::size_t count,
+                         uint8_t numFracBits) {
+        ArrayOpScalar<BaseType, OverflowType>(op, a, b, out, count, numFracBits);
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+    /// \brief      Runs a FpF32 array operation with the fastest instruction set available.
+    template<>
+    inline void ArrayOpDispatch<int32_t, int64_t>(ArrayOp op, const int32_t* a, const int32_t* b, int32_t* out,
+                                                  std::size_t count, uint8_t numFracBits) {
+        switch(ActiveSimdIsa()) {
+            case SimdIsa::Avx512: ArrayOpAvx512(op, a, b, out, count, numFracBits); break;
+            case SimdIsa::Avx2:   ArrayOpAvx2(op, a, b, out, count, numFracBits); break;
+            case SimdIsa::Sse41:  ArrayOpSse41(op, a, b, out, count, numFracBits); break;
+            case SimdIsa::Scalar: ArrayOpScalar<int32_t, int64_t>(op, a, b, out, count, numFracBits); break;
+        }
+    }
+
+    /// \brief      Runs a FpF16 array operation with the fastest instruction set available.
+    template<>
+    inline void ArrayOpDispatch<int16_t, int32_t>(ArrayOp op, const int16_t* a, const int16_t* b, int16_t* out,
+                                                  std::size_t count, uint8_t numFracBits) {
+        switch(ActiveSimdIsa()) {
+            case SimdIsa::Avx512: ArrayOpAvx512(op, a, b, out, count, numFracBits); break;
+            case SimdIsa::Avx2:   ArrayOpAvx2(op, a, b, out, count, numFracBits); break;
+            case SimdIsa::Sse41:  ArrayOpSse41(op, a, b, out, count, numFracBits); break;
+            case SimdIsa::Scalar: ArrayOpScalar<int16_t, int32_t>(op, a, b, out, count, numFracBits); break;
+        }
+    }
+#endif
+
+    /// \brief      Calculates the dot product of two raw arrays with the portable scalar loop.
+    template<class BaseType, class OverflowType>
+    OverflowType DotProductRawDispatch(const BaseType* a, const BaseType* b, std::size_t count) {
+        return DotProductRawScalar<BaseType, OverflowType>(a, b, count);
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+    /// \brief      Calculates the dot product of two raw FpF32 arrays with the fastest instruction set available.
+    template<>
+    inline int64_t DotProductRawDispatch<int32_t, int64_t>(const int32_t* a, const int32_t* b, std::size_t count) {
+        switch(ActiveSimdIsa()) {
+            case SimdIsa::Avx512: return DotProductRawAvx512(a, b, count);
+            case SimdIsa::Avx2:   return DotProductRawAvx2(a, b, count);
+            case SimdIsa::Sse41:  return DotProductRawSse41(a, b, count);
+            default:              return DotProductRawScalar<int32_t, int64_t>(a, b, count);
+        }
+    }
+
+    /// \brief      Calculates the dot product of two raw FpF16 arrays with the fastest instruction set available.
+    template<>
+    inline int32_t DotProductRawDispatch<int16_t, int32_t>(const int16_t* a, const int16_t* b, std::size_t count) {
+        switch(ActiveSimdIsa()) {
+            case SimdIsa::Avx512: return DotProductRawAvx512(a, b, count);
+            case SimdIsa::Avx2:   return DotProductRawAvx2(a, b, count);
+            case SimdIsa::Sse41:  return DotProductRawSse41(a, b, count);
+            default:              return DotProductRawScalar<int16_t, int32_t>(a, b, count);
+        }
+    }
+#endif
+
+    /// \brief      Converts the FpF pointers to raw pointers and runs the array operation.
+    template<class BaseType, class OverflowType, uint8_t numFracBits>
+    void RunArrayOp(ArrayOp op, const FpF<BaseType, OverflowType, numFracBits>* a,
+                 const FpF<BaseType, OverflowType, numFracBits>* b,
+                 FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+        static_assert(sizeof(FpF<BaseType, OverflowType, numFracBits>) == sizeof(BaseType),
+                      "FpF arrays must have the same memory layout as arrays of BaseType.");
+        ArrayOpDispatch<BaseType, OverflowType>(op, reinterpret_cast<const BaseType*>(a),
+                                                reinterpret_cast<const BaseType*>(b),
+                                                reinterpret_cast<BaseType*>(out), count, numFracBits);
+    }
+
+} // namespace detail
+
+/// \brief      Returns the instruction set the array functions are currently using.
+inline SimdIsa GetSimdIsa() {
+    return detail::ActiveSimdIsa();
+}
+
+/// \brief      Changes the instruction set the array functions use (e.g. to compare against the scalar loop).
+/// \details    Instruction sets which are not supported by the CPU fall back to the best one that is.
+inline void SetSimdIsa(SimdIsa isa) {
+    SimdIsa best = detail::DetectSimdIsa();
+    detail::ActiveSimdIsa() = isa > best ? best : isa;
+}
+
+/// \brief      out[i] = a[i] + b[i], for i = 0 to count - 1.
+/// \details    out may be the same array as a or b.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayAdd(const FpF<BaseType, OverflowType, numFracBits>* a, const FpF<BaseType, OverflowType, numFracBits>* b,
+              FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+    detail::RunArrayOp(detail::ArrayOp::Add, a, b, out, count);
+}
+
+/// \brief      out[i] = a[i] - b[i], for i = 0 to count - 1.
+/// \details    out may be the same array as a or b.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArraySubtract(const FpF<BaseType, OverflowType, numFracBits>* a, const FpF<BaseType, OverflowType, numFracBits>* b,
+                   FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+    detail::RunArrayOp(detail::ArrayOp::Subtract, a, b, out, count);
+}
+
+/// \brief      out[i] = a[i] * b[i], for i = 0 to count - 1.
+/// \details    Gives identical results to the FpF '*' operator. out may be the same array as a or b.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayMultiply(const FpF<BaseType, OverflowType, numFracBits>* a, const FpF<BaseType, OverflowType, numFracBits>* b,
+                   FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+    detail::RunArrayOp(detail::ArrayOp::Multiply, a, b, out, count);
+}
+
+/// \brief      out[i] = a[i] * scale, for i = 0 to count - 1.
+/// \details    out may be the same array as a.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayScale(const FpF<BaseType, OverflowType, numFracBits>* a, FpF<BaseType, OverflowType, numFracBits> scale,
+                FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+    detail::RunArrayOp(detail::ArrayOp::Scale, a, &scale, out, count);
+}
+
+/// \brief      out[i] = -a[i], for i = 0 to count - 1.
+/// \details    out may be the same array as a.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayNegate(const FpF<BaseType, OverflowType, numFracBits>* a, FpF<BaseType, OverflowType, numFracBits>* out,
+                 std::size_t count) {
+    detail::RunArrayOp(detail::ArrayOp::Negate, a, (const FpF<BaseType, OverflowType, numFracBits>*) nullptr, out, count);
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPF_ARRAY_H
+
+// EOF
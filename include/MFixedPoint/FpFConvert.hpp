@@ -0,0 +1,387 @@
+///
+/// \file 				FpFConvert.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				Conversion between float/double and FpF numbers, with selectable rounding and saturation.
+/// \details
+///		The FpF(float) and FpF(double) constructors truncate through a C cast, which is undefined behaviour for
+///		numbers that don't fit. FromFloat() and the array converters round according to a RoundingMode and
+///		saturate out of range numbers (NaN converts to 0). The FpF32 array converters use AVX2/AVX-512
+///		kernels on x86 (see SetSimdIsa()), which scale by 2^numFracBits by adding numFracBits to the IEEE
+///		exponent field and give bit-identical results to the scalar code.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPF_CONVERT_H
+#define MN_MFIXEDPOINT_FPF_CONVERT_H
+
+// System includes
+#include <cstddef>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFArray.hpp"
+#include "MFixedPoint/Rounding.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      What happens to numbers which are out of range of the FpF type (and NaN).
+enum class OverflowMode {
+    Saturate,   ///< Clamp to the largest/smallest representable number. NaN converts to 0.
+    Unchecked,  ///< The result is unspecified (but not undefined behaviour), which saves a few instructions
+                ///< per vector in the array kernels.
+};
+
+namespace detail {
+
+    /// \brief      Converts f to a raw value with numFracBits fractional bits, rounding according to mode and
+    ///             saturating to the range of BaseType.
+    /// \details    RoundingMode::Truncate rounds towards zero here, like a C cast. Multiplying by a power of 2
+    ///             is exact and everything in range of an int64_t is converted exactly, so this gives the same
+    ///             results as the SIMD kernels (which only differ for out of range numbers with
+    ///             OverflowMode::Unchecked).
+    template<class BaseType, RoundingMode mode, class FloatType>
+    BaseType FloatToRaw(FloatType f, uint8_t numFracBits) {
+        const FloatType scaled = f * (FloatType) ((uint64_t) 1 << numFracBits);
+        const FloatType limit = (FloatType) 9223372036854775808.0;
+        int64_t rounded;
+        if(scaled >= limit) {
+            rounded = std::numeric_limits<int64_t>::max();
+        } else if(scaled < -limit) {
+            rounded = std::numeric_limits<int64_t>::min();
+        } else if(scaled != scaled) {
+            return 0;
+        } else {
+            // Both scaled - truncated and the comparisons with 0.5 are exact
+            const int64_t truncated = (int64_t) scaled;
+            const FloatType frac = scaled - (FloatType) truncated;
+            rounded = truncated;
+            if(mode == RoundingMode::HalfUp) {
+                rounded += (frac >= (FloatType) 0.5) - (frac < (FloatType) -0.5);
+            } else if(mode == RoundingMode::HalfEven) {
+                // Written with & rather than && so there are no branches
+                const FloatType absFrac = frac < 0 ? -frac : frac;
+                const int64_t awayFromZero = (absFrac > (FloatType) 0.5) | ((absFrac == (FloatType) 0.5) & truncated);
+                rounded += frac < 0 ? -awayFromZero : awayFromZero;
+            } else if(mode == RoundingMode::Stochastic) {
+                // Round down to negative infinity, then up with a probability of the (now positive) fraction
+                const bool negative = frac < 0;
+                const FloatType positiveFrac = negative ? frac + 1 : frac;
+                rounded -= negative;
+                rounded += positiveFrac * (FloatType) 4294967296.0 > (FloatType) (NextRandom() >> 32);
+            }
+        }
+        const int64_t maxVal = std::numeric_limits<BaseType>::max();
+        const int64_t minVal = std::numeric_limits<BaseType>::min();
+        return (BaseType) (rounded > maxVal ? maxVal : (rounded < minVal ? minVal : rounded));
+    }
+
+    /// \brief      Converts arrays of float/double to raw values with the portable scalar loop.
+    template<RoundingMode mode, class BaseType, class FloatType>
+    void ArrayFloatToRawScalar(const FloatType* in, BaseType* out, std::size_t count, uint8_t numFracBits) {
+        for(std::size_t i = 0; i < count; i++)
+            out[i] = FloatToRaw<BaseType, mode>(in[i], numFracBits);
+    }
+
+    /// \brief      Converts arrays of raw values to float/double with the portable scalar loop, giving the same
+    ///             results as FpF::ToFloat() and FpF::ToDouble().
+    template<class BaseType, class FloatType>
+    void ArrayRawToFloatScalar(const BaseType* in, FloatType* out, std::size_t count, uint8_t numFracBits) {
+        const FloatType scale = (FloatType) ((uint64_t) 1 << numFracBits);
+        for(std::size_t i = 0; i < count; i++)
+            out[i] = (FloatType) in[i] / scale;
+    }
+
+    /// \brief      The smallest number (before scaling by 2^numFracBits) which rounds to 2^31 or more, and the
+    ///             largest which rounds below -2^31 (inclusive for RoundingMode::Truncate, exclusive
+    ///             otherwise). Exact for double, and for float the nearest float has the same effect.
+    template<RoundingMode mode>
+    double Int32UpperLimit(uint8_t numFracBits) {
+        return (2147483648.0 - (mode == RoundingMode::Truncate ? 0.0 : 0.5)) / (double) ((uint64_t) 1 << numFracBits);
+    }
+
+    template<RoundingMode mode>
+    double Int32LowerLimit(uint8_t numFracBits) {
+        return -(2147483648.0 + (mode == RoundingMode::Truncate ? 1.0 : 0.5)) / (double) ((uint64_t) 1 << numFracBits);
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+
+// GCC gives false positives from inside the AVX-512 intrinsic headers (which use _mm512_undefined_epi32())
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+    //===============================================================================================//
+    //============================================= AVX2 ============================================//
+    //===============================================================================================//
+
+    /// \brief      Rounds eight scaled floats to integers (still as floats) according to mode.
+    /// \details    RoundingMode::HalfUp rounds to nearest even and then moves ties which went down up.
+    template<RoundingMode mode>
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline __m256 RoundAvx2(__m256 x) {
+        if(mode == RoundingMode::Truncate)
+            return x;
+        const __m256 rounded = _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        if(mode == RoundingMode::HalfEven)
+            return rounded;
+        const __m256 tiesDown = _mm256_cmp_ps(_mm256_sub_ps(x, rounded), _mm256_set1_ps(0.5f), _CMP_EQ_OQ);
+        return _mm256_add_ps(rounded, _mm256_and_ps(tiesDown, _mm256_set1_ps(1.0f)));
+    }
+
+    template<RoundingMode mode>
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline __m256d RoundAvx2(__m256d x) {
+        if(mode == RoundingMode::Truncate)
+            return x;
+        const __m256d rounded = _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        if(mode == RoundingMode::HalfEven)
+            return rounded;
+        const __m256d tiesDown = _mm256_cmp_pd(_mm256_sub_pd(x, rounded), _mm256_set1_pd(0.5), _CMP_EQ_OQ);
+        return _mm256_add_pd(rounded, _mm256_and_pd(tiesDown, _mm256_set1_pd(1.0)));
+    }
+
+    template<RoundingMode mode, OverflowMode overflow>
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void ArrayFloatToRawAvx2(const float* in, int32_t* out, std::size_t count, uint8_t numFracBits) {
+        const __m256i exponentOffset = _mm256_set1_epi32((int32_t) numFracBits << 23);
+        const __m256 upperLimit = _mm256_set1_ps((float) Int32UpperLimit<mode>(numFracBits));
+        const __m256 lowerLimit = _mm256_set1_ps((float) Int32LowerLimit<mode>(numFracBits));
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256 f = _mm256_loadu_ps(in + i);
+            const __m256 scaled = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(f), exponentOffset));
+            __m256i result = _mm256_cvttps_epi32(RoundAvx2<mode>(scaled));
+            if(overflow == OverflowMode::Saturate) {
+                const __m256 tooLow = mode == RoundingMode::Truncate ? _mm256_cmp_ps(f, lowerLimit, _CMP_LE_OQ) :
+                                                                       _mm256_cmp_ps(f, lowerLimit, _CMP_LT_OQ);
+                result = _mm256_blendv_epi8(result, _mm256_set1_epi32(INT32_MIN), _mm256_castps_si256(tooLow));
+                result = _mm256_blendv_epi8(result, _mm256_set1_epi32(INT32_MAX),
+                                            _mm256_castps_si256(_mm256_cmp_ps(f, upperLimit, _CMP_GE_OQ)));
+                result = _mm256_and_si256(result, _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_ORD_Q)));
+            }
+            _mm256_storeu_si256((__m256i*) (out + i), result);
+        }
+        ArrayFloatToRawScalar<mode>(in + i, out + i, count - i, numFracBits);
+    }
+
+    /// \brief      Narrows four 64-bit lane masks to four 32-bit lane masks.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline __m128i NarrowMaskAvx2(__m256d mask) {
+        return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_castpd_si256(mask),
+                                                                   _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+    }
+
+    template<RoundingMode mode, OverflowMode overflow>
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void ArrayFloatToRawAvx2(const double* in, int32_t* out, std::size_t count, uint8_t numFracBits) {
+        const __m256i exponentOffset = _mm256_set1_epi64x((int64_t) numFracBits << 52);
+        const __m256d upperLimit = _mm256_set1_pd(Int32UpperLimit<mode>(numFracBits));
+        const __m256d lowerLimit = _mm256_set1_pd(Int32LowerLimit<mode>(numFracBits));
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m256d f = _mm256_loadu_pd(in + i);
+            const __m256d scaled = _mm256_castsi256_pd(_mm256_add_epi64(_mm256_castpd_si256(f), exponentOffset));
+            __m128i result = _mm256_cvttpd_epi32(RoundAvx2<mode>(scaled));
+            if(overflow == OverflowMode::Saturate) {
+                const __m256d tooLow = mode == RoundingMode::Truncate ? _mm256_cmp_pd(f, lowerLimit, _CMP_LE_OQ) :
+                                                                        _mm256_cmp_pd(f, lowerLimit, _CMP_LT_OQ);
+                result = _mm_blendv_epi8(result, _mm_set1_epi32(INT32_MIN), NarrowMaskAvx2(tooLow));
+                result = _mm_blendv_epi8(result, _mm_set1_epi32(INT32_MAX),
+                                         NarrowMaskAvx2(_mm256_cmp_pd(f, upperLimit, _CMP_GE_OQ)));
+                result = _mm_and_si128(result, NarrowMaskAvx2(_mm256_cmp_pd(f, f, _CMP_ORD_Q)));
+            }
+            _mm_storeu_si128((__m128i*) (out + i), result);
+        }
+        ArrayFloatToRawScalar<mode>(in + i, out + i, count - i, numFracBits);
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void ArrayRawToFloatAvx2(const int32_t* in, float* out, std::size_t count, uint8_t numFracBits) {
+        const __m256 scale = _mm256_set1_ps(1.0f / (float) ((uint64_t) 1 << numFracBits));
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256i raw = _mm256_loadu_si256((const __m256i*) (in + i));
+            _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(raw), scale));
+        }
+        ArrayRawToFloatScalar(in + i, out + i, count - i, numFracBits);
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void ArrayRawToFloatAvx2(const int32_t* in, double* out, std::size_t count, uint8_t numFracBits) {
+        const __m256d scale = _mm256_set1_pd(1.0 / (double) ((uint64_t) 1 << numFracBits));
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m128i raw = _mm_loadu_si128((const __m128i*) (in + i));
+            _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_cvtepi32_pd(raw), scale));
+        }
+        ArrayRawToFloatScalar(in + i, out + i, count - i, numFracBits);
+    }
+
+    //===============================================================================================//
+    //=========================================== AVX-512 ===========================================//
+    //===============================================================================================//
+
+    template<RoundingMode mode>
+    MN_MFIXEDPOINT_TARGET("avx512f")
+    inline __m512 RoundAvx512(__m512 x) {
+        if(mode == RoundingMode::Truncate)
+            return x;
+        const __m512 rounded = _mm512_roundscale_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        if(mode == RoundingMode::HalfEven)
+            return rounded;
+        const __mmask16 tiesDown = _mm512_cmp_ps_mask(_mm512_sub_ps(x, rounded), _mm512_set1_ps(0.5f), _CMP_EQ_OQ);
+        return _mm512_mask_add_ps(rounded, tiesDown, rounded, _mm512_set1_ps(1.0f));
+    }
+
+    template<RoundingMode mode, OverflowMode overflow>
+    MN_MFIXEDPOINT_TARGET("avx512f")
+    inline void ArrayFloatToRawAvx512(const float* in, int32_t* out, std::size_t count, uint8_t numFracBits) {
+        const __m512i exponentOffset = _mm512_set1_epi32((int32_t) numFracBits << 23);
+        const __m512 upperLimit = _mm512_set1_ps((float) Int32UpperLimit<mode>(numFracBits));
+        const __m512 lowerLimit = _mm512_set1_ps((float) Int32LowerLimit<mode>(numFracBits));
+        std::size_t i = 0;
+        for(; i + 16 <= count; i += 16) {
+            const __m512 f = _mm512_loadu_ps(in + i);
+            const __m512 scaled = _mm512_castsi512_ps(_mm512_add_epi32(_mm512_castps_si512(f), exponentOffset));
+            __m512i result = _mm512_cvttps_epi32(RoundAvx512<mode>(scaled));
+            if(overflow == OverflowMode::Saturate) {
+                const __mmask16 tooLow = mode == RoundingMode::Truncate ? _mm512_cmp_ps_mask(f, lowerLimit, _CMP_LE_OQ) :
+                                                                          _mm512_cmp_ps_mask(f, lowerLimit, _CMP_LT_OQ);
+                result = _mm512_mask_mov_epi32(result, tooLow, _mm512_set1_epi32(INT32_MIN));
+                result = _mm512_mask_mov_epi32(result, _mm512_cmp_ps_mask(f, upperLimit, _CMP_GE_OQ),
+                                               _mm512_set1_epi32(INT32_MAX));
+                result = _mm512_maskz_mov_epi32(_mm512_cmp_ps_mask(f, f, _CMP_ORD_Q), result);
+            }
+            _mm512_storeu_si512((void*) (out + i), result);
+        }
+        ArrayFloatToRawScalar<mode>(in + i, out + i, count - i, numFracBits);
+    }
+
+    MN_MFIXEDPOINT_TARGET("avx512f")
+    inline void ArrayRawToFloatAvx512(const int32_t* in, float* out, std::size_t count, uint8_t numFracBits) {
+        const __m512 scale = _mm512_set1_ps(1.0f / (float) ((uint64_t) 1 << numFracBits));
+        std::size_t i = 0;
+        for(; i + 16 <= count; i += 16) {
+            const __m512i raw = _mm512_loadu_si512((const void*) (in + i));
+            _mm512_storeu_ps(out + i, _mm512_mul_ps(_mm512_cvtepi32_ps(raw), scale));
+        }
+        ArrayRawToFloatScalar(in + i, out + i, count - i, numFracBits);
+    }
+
+#pragma GCC diagnostic pop
+
+#endif // #if MN_MFIXEDPOINT_X86_SIMD
+
+    /// \brief      Converts an array of float/double to raw values with the portable scalar loop.
+    template<RoundingMode mode, OverflowMode overflow, class BaseType, class FloatType>
+    void ArrayFloatToRawDispatch(const FloatType* in, BaseType* out, std::size_t count, uint8_t numFracBits) {
+        ArrayFloatToRawScalar<mode>(in, out, count, numFracBits);
+    }
+
+    /// \brief      Converts an array of raw values to float/double with the portable scalar loop.
+    template<class BaseType, class FloatType>
+    void ArrayRawToFloatDispatch(const BaseType* in, FloatType* out, std::size_t count, uint8_t numFracBits) {
+        ArrayRawToFloatScalar(in, out, count, numFracBits);
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+    /// \brief      Converts an array of float to raw FpF32 values with the fastest instruction set available.
+    /// \details    RoundingMode::Stochastic always uses the scalar loop.
+    template<RoundingMode mode, OverflowMode overflow>
+    void ArrayFloatToRawDispatch(const float* in, int32_t* out, std::size_t count, uint8_t numFracBits) {
+        if(mode != RoundingMode::Stochastic && ActiveSimdIsa() == SimdIsa::Avx512)
+            ArrayFloatToRawAvx512<mode, overflow>(in, out, count, numFracBits);
+        else if(mode != RoundingMode::Stochastic && ActiveSimdIsa() == SimdIsa::Avx2)
+            ArrayFloatToRawAvx2<mode, overflow>(in, out, count, numFracBits);
+        else
+            ArrayFloatToRawScalar<mode>(in, out, count, numFracBits);
+    }
+
+    /// \brief      Converts an array of double to raw FpF32 values with AVX2 if available.
+    template<RoundingMode mode, OverflowMode overflow>
+    void ArrayFloatToRawDispatch(const double* in, int32_t* out, std::size_t count, uint8_t numFracBits) {
+        if(mode != RoundingMode::Stochastic && ActiveSimdIsa() >= SimdIsa::Avx2)
+            ArrayFloatToRawAvx2<mode, overflow>(in, out, count, numFracBits);
+        else
+            ArrayFloatToRawScalar<mode>(in, out, count, numFracBits);
+    }
+
+    /// \brief      Converts an array of raw FpF32 values to float with the fastest instruction set available.
+    inline void ArrayRawToFloatDispatch(const int32_t* in, float* out, std::size_t count, uint8_t numFracBits) {
+        switch(ActiveSimdIsa()) {
+            case SimdIsa::Avx512: ArrayRawToFloatAvx512(in, out, count, numFracBits); break;
+            case SimdIsa::Avx2:   ArrayRawToFloatAvx2(in, out, count, numFracBits); break;
+            default:              ArrayRawToFloatScalar(in, out, count, numFracBits); break;
+        }
+    }
+
+    /// \brief      Converts an array of raw FpF32 values to double with AVX2 if available.
+    inline void ArrayRawToFloatDispatch(const int32_t* in, double* out, std::size_t count, uint8_t numFracBits) {
+        if(ActiveSimdIsa() >= SimdIsa::Avx2)
+            ArrayRawToFloatAvx2(in, out, count, numFracBits);
+        else
+            ArrayRawToFloatScalar(in, out, count, numFracBits);
+    }
+#endif
+
+} // namespace detail
+
+/// \brief      Converts f to OutType (e.g. FpF32<16>), rounding according to mode (RoundingMode::Truncate rounds
+///             towards zero, like the FpF(float) constructor) and saturating out of range numbers.
+/// \details    Unlike the FpF(float) constructor this is never undefined behaviour. The result with
+///             OverflowMode::Unchecked is the same as with OverflowMode::Saturate (only the array kernels
+///             skip the checks).
+template<class OutType, RoundingMode mode = RoundingMode::HalfEven, OverflowMode overflow = OverflowMode::Saturate>
+OutType FromFloat(float f) {
+    return OutType::FromRaw(detail::FloatToRaw<typename detail::FpFTraits<OutType>::BaseType, mode>(
+            f, detail::FpFTraits<OutType>::numFracBits));
+}
+
+/// \brief      Converts f to OutType (e.g. FpF32<16>), rounding according to mode (RoundingMode::Truncate rounds
+///             towards zero, like the FpF(double) constructor) and saturating out of range numbers.
+template<class OutType, RoundingMode mode = RoundingMode::HalfEven, OverflowMode overflow = OverflowMode::Saturate>
+OutType FromFloat(double f) {
+    return OutType::FromRaw(detail::FloatToRaw<typename detail::FpFTraits<OutType>::BaseType, mode>(
+            f, detail::FpFTraits<OutType>::numFracBits));
+}
+
+/// \brief      out[i] = FromFloat<..., mode, overflow>(in[i]), for i = 0 to count - 1.
+/// \details    in can be an array of float or double.
+template<RoundingMode mode = RoundingMode::HalfEven, OverflowMode overflow = OverflowMode::Saturate,
+         class FloatType, class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayFromFloat(const FloatType* in, FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+    static_assert(std::is_floating_point<FloatType>::value, "ArrayFromFloat() converts arrays of float or double.");
+    static_assert(sizeof(FpF<BaseType, OverflowType, numFracBits>) == sizeof(BaseType),
+                  "FpF arrays must have the same memory layout as arrays of BaseType.");
+    detail::ArrayFloatToRawDispatch<mode, overflow>(in, reinterpret_cast<BaseType*>(out), count, numFracBits);
+}
+
+/// \brief      out[i] = in[i].ToFloat() (or ToDouble() if out is an array of double), for i = 0 to count - 1.
+template<class FloatType, class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayToFloat(const FpF<BaseType, OverflowType, numFracBits>* in, FloatType* out, std::size_t count) {
+    static_assert(std::is_floating_point<FloatType>::value, "ArrayToFloat() converts to arrays of float or double.");
+    static_assert(sizeof(FpF<BaseType, OverflowType, numFracBits>) == sizeof(BaseType),
+                  "FpF arrays must have the same memory layout as arrays of BaseType.");
+    detail::ArrayRawToFloatDispatch(reinterpret_cast<const BaseType*>(in), out, count, numFracBits);
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPF_CONVERT_H
+
+// EOF
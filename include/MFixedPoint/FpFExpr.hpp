@@ -0,0 +1,279 @@
+///
+/// \file 				FpFExpr.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				Expression templates which fuse chains of FpF arithmetic and shift once.
+/// \details
+///		FpF's '*' operator shifts every product back to numFracBits, so a*b + c*d - e*f shifts (and
+///		truncates) three times. Wrapping an operand with Lazy() makes the operators build an expression
+///		instead: products stay in OverflowType with 2*numFracBits fractional bits, sums of products are
+///		accumulated at that precision, and the result is shifted once when the expression is converted
+///		to the FpF type (e.g. on assignment), e.g.
+///			FpF32<16> y = Lazy(a) * b + Lazy(c) * d - Lazy(e) * f;
+///		This is opt-in (the FpF operators are unchanged), so existing code keeps its exact results.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPF_EXPR_H
+#define MN_MFIXEDPOINT_FPF_EXPR_H
+
+// System includes
+#include <stdint.h>
+#include <type_traits>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+namespace detail {
+
+    /// \brief      The value of an expression node at numFracBits of fractional precision, as an OverflowType
+    ///             which holds a BaseType value (so multiplying two of them cannot overflow). Wraps around like
+    ///             the FpF operators do if the value doesn't fit in BaseType.
+    template<class Node>
+    constexpr typename Node::OverflowType FpFExprNarrow(const Node& node) {
+        return (typename Node::OverflowType) (typename Node::BaseType) (
+                node.Wide() >> (Node::numFracBits * Node::scale));
+    }
+
+    /// \brief      The value of an expression node at the precision of an expression with the given scale
+    ///             (numFracBits * (1 + scale) fractional bits). Multiplies rather than shifts left, because
+    ///             the value can be negative.
+    template<int scale, class Node>
+    constexpr typename Node::OverflowType FpFExprAlign(const Node& node) {
+        return scale == Node::scale ? node.Wide() :
+               node.Wide() * ((typename Node::OverflowType) 1 << Node::numFracBits);
+    }
+
+    /// \brief      Expression node members common to every node.
+    /// \details    Wide() returns the value of the node with numFracBits * (1 + scale) fractional bits, scale
+    ///             is 0 for FpF values and sums of them, and 1 for products and anything added to them.
+    template<class Derived, class FpFType, int nodeScale>
+    class FpFExprBase;
+
+    template<class Derived, class BaseTypeT, class OverflowTypeT, uint8_t numFracBitsT, int nodeScale>
+    class FpFExprBase<Derived, FpF<BaseTypeT, OverflowTypeT, numFracBitsT>, nodeScale> {
+    public:
+
+        typedef FpF<BaseTypeT, OverflowTypeT, numFracBitsT> FpFType;
+        typedef BaseTypeT BaseType;
+        typedef OverflowTypeT OverflowType;
+        static constexpr uint8_t numFracBits = numFracBitsT;
+        static constexpr int scale = nodeScale;
+
+        /// \brief      Evaluates the expression, shifting once to numFracBits.
+        constexpr FpFType Eval() const {
+            return FpFType::FromRaw(
+                    (BaseType) (static_cast<const Derived&>(*this).Wide() >> (numFracBits * scale)));
+        }
+
+        constexpr operator FpFType() const {
+            return Eval();
+        }
+
+    };
+
+    /// \brief      An FpF value in an expression.
+    template<class FpFType>
+    class FpFExprLeaf : public FpFExprBase<FpFExprLeaf<FpFType>, FpFType, 0> {
+    public:
+
+        typedef FpFExprBase<FpFExprLeaf<FpFType>, FpFType, 0> Base;
+
+        explicit constexpr FpFExprLeaf(FpFType value) :
+                value_(value) {}
+
+        constexpr typename Base::OverflowType Wide() const {
+            return value_.GetRawVal();
+        }
+
+    private:
+
+        FpFType value_;
+
+    };
+
+    /// \brief      The product of two expressions, with 2*numFracBits fractional bits. Products of products
+    ///             narrow their operands first, so the value always fits in OverflowType.
+    template<class L, class R>
+    class FpFExprProduct : public FpFExprBase<FpFExprProduct<L, R>, typename L::FpFType, 1> {
+    public:
+
+        typedef FpFExprBase<FpFExprProduct<L, R>, typename L::FpFType, 1> Base;
+
+        constexpr FpFExprProduct(const L& l, const R& r) :
+                l_(l), r_(r) {}
+
+        constexpr typename Base::OverflowType Wide() const {
+            return FpFExprNarrow(l_) * FpFExprNarrow(r_);
+        }
+
+    private:
+
+        L l_;
+        R r_;
+
+    };
+
+    /// \brief      The sum (or difference, if negate is true) of two expressions, at the precision of the
+    ///             more precise one.
+    template<class L, class R, bool negate>
+    class FpFExprSum : public FpFExprBase<FpFExprSum<L, R, negate>, typename L::FpFType,
+                                          (L::scale > R::scale ? L::scale : R::scale)> {
+    public:
+
+        typedef FpFExprBase<FpFExprSum<L, R, negate>, typename L::FpFType,
+                            (L::scale > R::scale ? L::scale : R::scale)> Base;
+
+        constexpr FpFExprSum(const L& l, const R& r) :
+                l_(l), r_(r) {}
+
+        constexpr typename Base::OverflowType Wide() const {
+            return negate ? FpFExprAlign<Base::scale>(l_) - FpFExprAlign<Base::scale>(r_) :
+                            FpFExprAlign<Base::scale>(l_) + FpFExprAlign<Base::scale>(r_);
+        }
+
+    private:
+
+        L l_;
+        R r_;
+
+    };
+
+    /// \brief      The negation of an expression.
+    template<class Node>
+    class FpFExprNegate : public FpFExprBase<FpFExprNegate<Node>, typename Node::FpFType, Node::scale> {
+    public:
+
+        typedef FpFExprBase<FpFExprNegate<Node>, typename Node::FpFType, Node::scale> Base;
+
+        explicit constexpr FpFExprNegate(const Node& node) :
+                node_(node) {}
+
+        constexpr typename Base::OverflowType Wide() const {
+            return -node_.Wide();
+        }
+
+    private:
+
+        Node node_;
+
+    };
+
+    /// \brief      Converts an operand of an expression operator to an expression node (FpF values become
+    ///             leaves). isNode is false for FpF values, so the FpF operators are used when neither
+    ///             operand is an expression node.
+    template<class T>
+    struct FpFExprOperand {
+        static constexpr bool isExpr = false;
+        static constexpr bool isNode = false;
+    };
+
+    template<class BaseType, class OverflowType, uint8_t numFracBits>
+    struct FpFExprOperand<FpF<BaseType, OverflowType, numFracBits>> {
+        static constexpr bool isExpr = true;
+        static constexpr bool isNode = false;
+        typedef FpFExprLeaf<FpF<BaseType, OverflowType, numFracBits>> Type;
+        static constexpr Type Make(FpF<BaseType, OverflowType, numFracBits> value) {
+            return Type(value);
+        }
+    };
+
+    template<class Node>
+    struct FpFExprNodeOperand {
+        static constexpr bool isExpr = true;
+        static constexpr bool isNode = true;
+        typedef Node Type;
+        static constexpr const Node& Make(const Node& node) {
+            return node;
+        }
+    };
+
+    template<class FpFType>
+    struct FpFExprOperand<FpFExprLeaf<FpFType>> : FpFExprNodeOperand<FpFExprLeaf<FpFType>> {};
+
+    template<class L, class R>
+    struct FpFExprOperand<FpFExprProduct<L, R>> : FpFExprNodeOperand<FpFExprProduct<L, R>> {};
+
+    template<class L, class R, bool negate>
+    struct FpFExprOperand<FpFExprSum<L, R, negate>> : FpFExprNodeOperand<FpFExprSum<L, R, negate>> {};
+
+    template<class Node>
+    struct FpFExprOperand<FpFExprNegate<Node>> : FpFExprNodeOperand<FpFExprNegate<Node>> {};
+
+    /// \brief      Type is the expression type Op<L, R> if at least one of the operands is an expression node
+    ///             and both are expressions of the same FpF type.
+    template<template<class, class> class Op, class L, class R, bool enable =
+             FpFExprOperand<L>::isExpr && FpFExprOperand<R>::isExpr &&
+             (FpFExprOperand<L>::isNode || FpFExprOperand<R>::isNode)>
+    struct FpFExprResult {};
+
+    template<template<class, class> class Op, class L, class R>
+    struct FpFExprResult<Op, L, R, true> {
+        typedef typename FpFExprOperand<L>::Type LNode;
+        typedef typename FpFExprOperand<R>::Type RNode;
+        static_assert(std::is_same<typename LNode::FpFType, typename RNode::FpFType>::value,
+                      "FpF expressions must be made of fixed-point numbers whose template parameters are the same.");
+        typedef Op<LNode, RNode> Type;
+    };
+
+    template<class L, class R>
+    using FpFExprAdd = FpFExprSum<L, R, false>;
+
+    template<class L, class R>
+    using FpFExprSubtract = FpFExprSum<L, R, true>;
+
+} // namespace detail
+
+/// \brief      Starts a fused expression, e.g. FpF32<16> y = Lazy(a) * b + Lazy(c) * d, which shifts once when
+///             it is converted back to FpF32<16> (or by calling Eval()).
+/// \details    Every product must have at least one Lazy() operand (otherwise FpF's '*' operator shifts it),
+///             e.g. wrap each variable once with auto la = Lazy(a). Products of products (Lazy(a) * b * c)
+///             are shifted before the second multiply, so they truncate like FpF's operators do.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+constexpr detail::FpFExprLeaf<FpF<BaseType, OverflowType, numFracBits>> Lazy(
+        FpF<BaseType, OverflowType, numFracBits> value) {
+    return detail::FpFExprLeaf<FpF<BaseType, OverflowType, numFracBits>>(value);
+}
+
+template<class L, class R>
+constexpr typename detail::FpFExprResult<detail::FpFExprProduct, L, R>::Type operator * (const L& l, const R& r) {
+    return typename detail::FpFExprResult<detail::FpFExprProduct, L, R>::Type(
+            detail::FpFExprOperand<L>::Make(l), detail::FpFExprOperand<R>::Make(r));
+}
+
+template<class L, class R>
+constexpr typename detail::FpFExprResult<detail::FpFExprAdd, L, R>::Type operator + (const L& l, const R& r) {
+    return typename detail::FpFExprResult<detail::FpFExprAdd, L, R>::Type(
+            detail::FpFExprOperand<L>::Make(l), detail::FpFExprOperand<R>::Make(r));
+}
+
+template<class L, class R>
+constexpr typename detail::FpFExprResult<detail::FpFExprSubtract, L, R>::Type operator - (const L& l, const R& r) {
+    return typename detail::FpFExprResult<detail::FpFExprSubtract, L, R>::Type(
+            detail::FpFExprOperand<L>::Make(l), detail::FpFExprOperand<R>::Make(r));
+}
+
+template<class Node>
+constexpr typename std::enable_if<detail::FpFExprOperand<Node>::isNode, detail::FpFExprNegate<Node>>::type
+operator - (const Node& node) {
+    return detail::FpFExprNegate<Node>(node);
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPF_EXPR_H
+
+// EOF
@@ -0,0 +1,506 @@
+///
+/// \file 				FpFMath.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				Math functions for the FpF class.
+/// \details
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPF_MATH_H
+#define MN_MFIXEDPOINT_FPF_MATH_H
+
+// System includes
+#include <cstddef>
+#include <limits>
+#include <stdint.h>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+namespace detail {
+
+    /// \brief      Returns the number of leading zero bits in x (64 if x is 0).
+    inline uint8_t CountLeadingZeros(uint64_t x) {
+#if defined(__GNUC__)
+        return x == 0 ? 64 : (uint8_t) __builtin_clzll(x);
+#else
+        uint8_t count = 0;
+        if(x == 0)
+            return 64;
+        if(!(x & 0xFFFFFFFF00000000)) { count += 32; x <<= 32; }
+        if(!(x & 0xFFFF000000000000)) { count += 16; x <<= 16; }
+        if(!(x & 0xFF00000000000000)) { count += 8; x <<= 8; }
+        if(!(x & 0xF000000000000000)) { count += 4; x <<= 4; }
+        if(!(x & 0xC000000000000000)) { count += 2; x <<= 2; }
+        if(!(x & 0x8000000000000000)) { count += 1; }
+        return count;
+#endif
+    }
+
+    /// \brief      Returns the absolute value of a raw fixed-point value (works for the most negative value).
+    template<class BaseType>
+    uint64_t Magnitude(BaseType x) {
+        return x < 0 ? (uint64_t) 0 - (uint64_t) (int64_t) x : (uint64_t) x;
+    }
+
+    /// \brief      Shifts left if shift is positive, right if it is negative.
+    /// \details    Right shifts by the full width of the type (or more) give 0.
+    template<class IntType>
+    IntType ShiftBy(IntType x, int shift) {
+        if(shift >= 0)
+            return (IntType) (x << shift);
+        if(-shift >= (int) sizeof(IntType) * 8)
+            return (IntType) 0;
+        return (IntType) (x >> -shift);
+    }
+
+    /// \brief      The default number of Newton-Raphson iterations used by Reciprocal() and FastDivide().
+    /// \details    Enough to give full precision for the BaseType.
+    template<class BaseType>
+    struct ReciprocalIterations {
+        static constexpr uint8_t value = sizeof(BaseType) <= 2 ? 1 : (sizeof(BaseType) <= 4 ? 2 : 3);
+    };
+
+    /// \brief      Initial estimates of 1/v for v in [0.5, 1), in Q2.14 format.
+    /// \details    Entry i is 1/v at the midpoint of [0.5 + i/512, 0.5 + (i+1)/512), so the estimate has a
+    ///             relative error of less than 2^-9. Each Newton-Raphson iteration doubles the number of
+    ///             correct bits.
+    inline uint16_t ReciprocalSeed(uint8_t index) {
+        static const uint16_t reciprocalTable[256] = {
+            0x7fc0, 0x7f41, 0x7ec3, 0x7e46, 0x7dca, 0x7d4f, 0x7cd5, 0x7c5b,
+            0x7be3, 0x7b6c, 0x7af5, 0x7a7f, 0x7a0a, 0x7997, 0x7923, 0x78b1,
+            0x7840, 0x77cf, 0x7760, 0x76f1, 0x7683, 0x7615, 0x75a9, 0x753d,
+            0x74d2, 0x7468, 0x73fe, 0x7395, 0x732d, 0x72c6, 0x7260, 0x71fa,
+            0x7195, 0x7130, 0x70cc, 0x7069, 0x7007, 0x6fa5, 0x6f44, 0x6ee4,
+            0x6e84, 0x6e25, 0x6dc7, 0x6d69, 0x6d0c, 0x6caf, 0x6c53, 0x6bf8,
+            0x6b9d, 0x6b43, 0x6ae9, 0x6a90, 0x6a38, 0x69e0, 0x6988, 0x6932,
+            0x68dc, 0x6886, 0x6831, 0x67dc, 0x6788, 0x6735, 0x66e2, 0x668f,
+            0x663e, 0x65ec, 0x659b, 0x654b, 0x64fb, 0x64ab, 0x645d, 0x640e,
+            0x63c0, 0x6373, 0x6326, 0x62d9, 0x628d, 0x6241, 0x61f6, 0x61ab,
+            0x6161, 0x6117, 0x60ce, 0x6085, 0x603c, 0x5ff4, 0x5fac, 0x5f65,
+            0x5f1e, 0x5ed8, 0x5e92, 0x5e4c, 0x5e07, 0x5dc2, 0x5d7d, 0x5d39,
+            0x5cf5, 0x5cb2, 0x5c6f, 0x5c2d, 0x5bea, 0x5ba9, 0x5b67, 0x5b26,
+            0x5ae5, 0x5aa5, 0x5a65, 0x5a25, 0x59e6, 0x59a7, 0x5968, 0x592a,
+            0x58ec, 0x58af, 0x5871, 0x5834, 0x57f8, 0x57bb, 0x577f, 0x5744,
+            0x5708, 0x56cd, 0x5693, 0x5658, 0x561e, 0x55e4, 0x55ab, 0x5572,
+            0x5539, 0x5500, 0x54c8, 0x5490, 0x5458, 0x5421, 0x53ea, 0x53b3,
+            0x537c, 0x5346, 0x5310, 0x52da, 0x52a5, 0x526f, 0x523a, 0x5206,
+            0x51d1, 0x519d, 0x5169, 0x5136, 0x5102, 0x50cf, 0x509c, 0x506a,
+            0x5037, 0x5005, 0x4fd3, 0x4fa1, 0x4f70, 0x4f3f, 0x4f0e, 0x4edd,
+            0x4ead, 0x4e7c, 0x4e4c, 0x4e1d, 0x4ded, 0x4dbe, 0x4d8f, 0x4d60,
+            0x4d31, 0x4d03, 0x4cd4, 0x4ca6, 0x4c79, 0x4c4b, 0x4c1e, 0x4bf1,
+            0x4bc4, 0x4b97, 0x4b6a, 0x4b3e, 0x4b12, 0x4ae6, 0x4aba, 0x4a8f,
+            0x4a63, 0x4a38, 0x4a0d, 0x49e3, 0x49b8, 0x498e, 0x4963, 0x4939,
+            0x4910, 0x48e6, 0x48bd, 0x4893, 0x486a, 0x4841, 0x4819, 0x47f0,
+            0x47c8, 0x47a0, 0x4778, 0x4750, 0x4728, 0x4701, 0x46da, 0x46b2,
+            0x468b, 0x4665, 0x463e, 0x4618, 0x45f1, 0x45cb, 0x45a5, 0x457f,
+            0x455a, 0x4534, 0x450f, 0x44ea, 0x44c5, 0x44a0, 0x447b, 0x4456,
+            0x4432, 0x440e, 0x43ea, 0x43c6, 0x43a2, 0x437e, 0x435b, 0x4337,
+            0x4314, 0x42f1, 0x42ce, 0x42ab, 0x4289, 0x4266, 0x4244, 0x4222,
+            0x41ff, 0x41de, 0x41bc, 0x419a, 0x4178, 0x4157, 0x4136, 0x4115,
+            0x40f4, 0x40d3, 0x40b2, 0x4091, 0x4071, 0x4050, 0x4030, 0x4010,
+        };
+        return reciprocalTable[index];
+    }
+
+    /// \brief      Calculates the reciprocal of d using a table lookup followed by Newton-Raphson iterations.
+    /// \details    d is normalised to m = d * 2^shift, so that v = m / 2^F is in [0.5, 1), where
+    ///             F = (number of bits in BaseType) - 2. The returned value is 1/v with F fractional bits.
+    ///             F is chosen so that none of the intermediate products overflow OverflowType.
+    /// \param      d           The number to find the reciprocal of. Must not be 0.
+    /// \param      shift       Set to the normalisation shift.
+    template<class BaseType, class OverflowType, uint8_t numIterations>
+    OverflowType NormalisedReciprocal(uint64_t d, int& shift) {
+        const int F = (int) sizeof(BaseType) * 8 - 2;
+        shift = F - (64 - CountLeadingZeros(d));
+        const uint64_t m = ShiftBy(d, shift);
+        // The 8 bits after the leading one select the initial estimate
+        const uint8_t index = (uint8_t) (ShiftBy(m, 9 - F) & 0xFF);
+        const OverflowType v = (OverflowType) (int64_t) m;
+        const OverflowType two = (OverflowType) 2 << F;
+        OverflowType x = ShiftBy((OverflowType) (int64_t) ReciprocalSeed(index), F - 14);
+        for(uint8_t i = 0; i < numIterations; i++) {
+            // x = x(2 - vx)
+            x = (OverflowType) ((x * (OverflowType) (two - ((v * x) >> F))) >> F);
+        }
+        return x;
+    }
+
+    /// \brief      A compile-time list of indices (std::index_sequence is not available in C++11).
+    template<std::size_t... indices>
+    struct IndexSequence {};
+
+    template<class First, class Second>
+    struct ConcatIndexSequence;
+
+    template<std::size_t... first, std::size_t... second>
+    struct ConcatIndexSequence<IndexSequence<first...>, IndexSequence<second...>> {
+        typedef IndexSequence<first..., (sizeof...(first) + second)...> type;
+    };
+
+    /// \brief      Creates IndexSequence<0, 1, ..., n - 1>.
+    /// \details    Splits the sequence in half at each step, so the template recursion depth is only log2(n).
+    template<std::size_t n>
+    struct MakeIndexSequence {
+        typedef typename ConcatIndexSequence<typename MakeIndexSequence<n / 2>::type,
+                                             typename MakeIndexSequence<n - n / 2>::type>::type type;
+    };
+
+    template<>
+    struct MakeIndexSequence<0> {
+        typedef IndexSequence<> type;
+    };
+
+    template<>
+    struct MakeIndexSequence<1> {
+        typedef IndexSequence<0> type;
+    };
+
+    /// \brief      Compile-time Taylor series for sin(x), accurate to double precision for x in [0, pi/2].
+    constexpr double SinTaylor(double x, double term, double sum, int n) {
+        return n > 15 ? sum : SinTaylor(x, -term * x * x / ((2 * n) * (2 * n + 1)), sum + term, n + 1);
+    }
+
+    /// \brief      The i'th entry of a quarter-wave sine table with tableSize intervals, in Q1.30 format.
+    constexpr int32_t SinTableEntry(std::size_t i, std::size_t tableSize) {
+        return (int32_t) (SinTaylor(1.5707963267948966 * (double) i / (double) tableSize,
+                                    1.5707963267948966 * (double) i / (double) tableSize, 0.0, 1)
+                          * 1073741824.0 + 0.5);
+    }
+
+    /// \brief      Quarter-wave sine table, sin(pi/2 * i/tableSize) in Q1.30 format, generated at compile time.
+    /// \details    Has tableSize + 2 entries, the last one is past pi/2 and is only read (and multiplied by
+    ///             0) when interpolating at exactly pi/2.
+    template<uint16_t tableSize, class Indices = typename MakeIndexSequence<tableSize + 2>::type>
+    struct SinTable;
+
+    template<uint16_t tableSize, std::size_t... indices>
+    struct SinTable<tableSize, IndexSequence<indices...>> {
+        static constexpr int32_t values[sizeof...(indices)] = { SinTableEntry(indices, tableSize)... };
+    };
+
+    template<uint16_t tableSize, std::size_t... indices>
+    constexpr int32_t SinTable<tableSize, IndexSequence<indices...>>::values[sizeof...(indices)];
+
+    /// \brief      Converts an angle in radians to a phase, where 2^32 is one full turn.
+    /// \details    x * 2^64/2pi is calculated with a wrapping 64-bit multiply, and the phase is the upper 32 bits
+    ///             of the result. The wrap-around does the modulo 2pi for free, without losing precision for
+    ///             large angles.
+    template<class BaseType, class OverflowType, uint8_t numFracBits>
+    uint32_t AngleToPhase(FpF<BaseType, OverflowType, numFracBits> x) {
+        // Any fractional bits past 32 are below the precision of the phase
+        const int shiftDown = numFracBits > 32 ? numFracBits - 32 : 0;
+        // 2^(64 - numFracBits)/2pi, so that raw * turnsPerRadian = turns * 2^64
+        const uint64_t turnsPerRadian = (uint64_t) (18446744073709551616.0 / 6.283185307179586
+                                                    / (double) ((uint64_t) 1 << (numFracBits - shiftDown)) + 0.5);
+        const uint64_t raw = (uint64_t) (int64_t) (x.GetRawVal() >> shiftDown);
+        return (uint32_t) ((raw * turnsPerRadian) >> 32);
+    }
+
+    /// \brief      Calculates sin(phase) from the quarter-wave table, where 2^32 is one full turn.
+    /// \returns    The result in Q1.30 format.
+    template<uint16_t tableSize>
+    int32_t SinOfPhase(uint32_t phase) {
+        static_assert(tableSize >= 2 && tableSize <= 16384 && (tableSize & (tableSize - 1)) == 0,
+                      "tableSize must be a power of 2 between 2 and 16384.");
+        // log2(tableSize)
+        const int indexBits = 64 - 1 - CountLeadingZeros(tableSize);
+        const int interpolationBits = 30 - indexBits;
+        const uint32_t quadrant = phase >> 30;
+        uint32_t quadrantPhase = phase & 0x3FFFFFFF;
+        // 2nd and 4th quadrants are the 1st and 3rd mirrored
+        if(quadrant & 1)
+            quadrantPhase = 0x40000000 - quadrantPhase;
+        const uint32_t index = quadrantPhase >> interpolationBits;
+        const int64_t fraction = quadrantPhase & ((1u << interpolationBits) - 1);
+        const int32_t* table = SinTable<tableSize>::values;
+        const int32_t value = table[index] + (int32_t) (((table[index + 1] - table[index]) * fraction) >> interpolationBits);
+        return quadrant & 2 ? -value : value;
+    }
+
+    /// \brief      Converts a Q1.30 sin/cos value to FpF, rounding to nearest and clamping to the maximum
+    ///             value (e.g. FpF8<7> cannot represent 1.0).
+    template<class BaseType, class OverflowType, uint8_t numFracBits>
+    FpF<BaseType, OverflowType, numFracBits> SinResultToFpF(int32_t valueQ30) {
+        int64_t raw = numFracBits >= 30 ? (int64_t) valueQ30 * ((int64_t) 1 << (numFracBits >= 30 ? numFracBits - 30 : 0)) :
+                      ((int64_t) valueQ30 + ((int64_t) 1 << (numFracBits < 30 ? 29 - numFracBits : 0)))
+                              >> (numFracBits < 30 ? 30 - numFracBits : 0);
+        const int64_t maxRaw = (int64_t) std::numeric_limits<BaseType>::max();
+        if(raw > maxRaw)
+            raw = maxRaw;
+        return FpF<BaseType, OverflowType, numFracBits>::FromRaw((BaseType) raw);
+    }
+
+    /// \brief      The default number of Newton-Raphson iterations used by RSqrt().
+    /// \details    Enough to give full precision for the BaseType.
+    template<class BaseType>
+    struct RSqrtIterations {
+        static constexpr uint8_t value = sizeof(BaseType) == 1 ? 1 : (sizeof(BaseType) == 2 ? 2 : (sizeof(BaseType) <= 4 ? 3 : 4));
+    };
+
+    /// \brief      Initial estimates of 1/sqrt(v) for v in [0.25, 1), in Q2.14 format.
+    /// \details    Entry i is 1/sqrt(v) at the midpoint of [(i + 16)/64, (i + 17)/64), so the estimate has a
+    ///             relative error of less than 2^-7.
+    inline uint16_t RSqrtSeed(uint8_t index) {
+        static const uint16_t rSqrtTable[48] = {
+            0x7e0c, 0x7a64, 0x770a, 0x73f2, 0x7115, 0x6e6c, 0x6bf0, 0x699e,
+            0x6771, 0x6564, 0x6376, 0x61a2, 0x5fe8, 0x5e44, 0x5cb5, 0x5b3a,
+            0x59d0, 0x5876, 0x572b, 0x55ef, 0x54bf, 0x539c, 0x5284, 0x5177,
+            0x5074, 0x4f7a, 0x4e8a, 0x4da1, 0x4cc1, 0x4be7, 0x4b15, 0x4a4a,
+            0x4985, 0x48c6, 0x480c, 0x4758, 0x46aa, 0x4600, 0x455b, 0x44ba,
+            0x441e, 0x4385, 0x42f1, 0x4260, 0x41d3, 0x414a, 0x40c3, 0x4040,
+        };
+        return rSqrtTable[index - 16];
+    }
+
+    /// \brief      Calculates 1/sqrt(v), where v is raw normalised to [0.25, 1) with F = (number of bits in
+    ///             BaseType) - 2 fractional bits.
+    /// \details    raw is shifted left by shift bits to give v, where shift is chosen so that
+    ///             (shift + numFracBits - F) is even (so the square root of the normalisation is exact). The
+    ///             initial estimate from the table is then refined with Newton-Raphson iterations,
+    ///             y = y(3 - vy^2)/2. The result has F fractional bits.
+    /// \warning    raw must be greater than 0.
+    template<class BaseType, class OverflowType, uint8_t numIterations>
+    OverflowType NormalisedRSqrt(BaseType raw, uint8_t numFracBits, OverflowType& v, int& shift) {
+        const int F = (int) sizeof(BaseType) * 8 - 2;
+        const uint64_t d = (uint64_t) raw;
+        shift = F - (64 - CountLeadingZeros(d));
+        if((shift + numFracBits - F) & 1)
+            shift--;
+        const uint64_t m = ShiftBy(d, shift);
+        // The top 6 bits select the initial estimate (m is in [2^(F - 2), 2^F))
+        const uint8_t index = (uint8_t) ShiftBy(m, 6 - F);
+        v = (OverflowType) (int64_t) m;
+        const OverflowType three = (OverflowType) 3 << F;
+        OverflowType y = ShiftBy((OverflowType) (int64_t) RSqrtSeed(index), F - 14);
+        for(uint8_t i = 0; i < numIterations; i++) {
+            y = (OverflowType) ((y * (OverflowType) (three - ((((v * y) >> F) * y) >> F))) >> (F + 1));
+        }
+        return y;
+    }
+
+    /// \brief      Calculates the raw value of 1/sqrt(x), where raw is the raw value of x. Rounds to nearest.
+    /// \warning    raw must be greater than 0.
+    template<class BaseType, class OverflowType, uint8_t numIterations>
+    BaseType RSqrtRaw(BaseType raw, uint8_t numFracBits) {
+        const int F = (int) sizeof(BaseType) * 8 - 2;
+        OverflowType v;
+        int shift;
+        OverflowType y = NormalisedRSqrt<BaseType, OverflowType, numIterations>(raw, numFracBits, v, shift);
+        // x = v * 2^(F - shift - numFracBits), so 1/sqrt(x) = 1/sqrt(v) * 2^((shift + numFracBits - F)/2)
+        const int resultShift = (shift + numFracBits - F) / 2 + numFracBits - F;
+        if(resultShift < 0 && -resultShift < (int) sizeof(OverflowType) * 8)
+            y += (OverflowType) 1 << (-resultShift - 1);
+        return (BaseType) ShiftBy(y, resultShift);
+    }
+
+    /// \brief      Calculates the raw value of sqrt(x), where raw is the raw value of x.
+    /// \details    The raw value of sqrt(x) is floor(sqrt(raw*2^numFracBits)). This is estimated with
+    ///             sqrt(v) = v/sqrt(v) (using NormalisedRSqrt()), and then corrected by the last LSB or two so
+    ///             that the result is exactly rounded down. Returns 0 for negative numbers.
+    template<class BaseType, class OverflowType>
+    BaseType SqrtRaw(BaseType raw, uint8_t numFracBits) {
+        if(raw <= 0)
+            return 0;
+        const int F = (int) sizeof(BaseType) * 8 - 2;
+        OverflowType v;
+        int shift;
+        const OverflowType y = NormalisedRSqrt<BaseType, OverflowType, RSqrtIterations<BaseType>::value>(
+                raw, numFracBits, v, shift);
+        // raw*2^numFracBits = v * 2^(F - shift + numFracBits), and the exponent is even
+        OverflowType root = ShiftBy((OverflowType) ((v * y) >> F), (numFracBits - shift - F) / 2);
+        const OverflowType square = (OverflowType) raw << numFracBits;
+        while(root * root > square)
+            root -= 1;
+        while((OverflowType) (root + 1) * (OverflowType) (root + 1) <= square)
+            root += 1;
+        return (BaseType) root;
+    }
+
+} // namespace detail
+
+//===============================================================================================//
+//========================================= RECIPROCAL/DIVISION =================================//
+//===============================================================================================//
+
+/// \brief      Calculates 1/b, without a hardware divide.
+/// \details    Uses a table lookup followed by numIterations Newton-Raphson iterations. The result may
+///             wrap-around if 1/b is too large to be represented (e.g. b is smaller than 1/(max value)).
+/// \tparam     numIterations   More iterations give more precision. Each one doubles the number of correct bits,
+///                             starting from 9.
+/// \warning    b must not be 0.
+template<uint8_t numIterations, class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> Reciprocal(FpF<BaseType, OverflowType, numFracBits> b) {
+    const int F = (int) sizeof(BaseType) * 8 - 2;
+    int shift;
+    OverflowType x = detail::NormalisedReciprocal<BaseType, OverflowType, numIterations>(
+            detail::Magnitude(b.GetRawVal()), shift);
+    OverflowType result = detail::ShiftBy(x, shift + 2 * numFracBits - 2 * F);
+    return FpF<BaseType, OverflowType, numFracBits>::FromRaw((BaseType) (b.GetRawVal() < 0 ? -result : result));
+}
+
+/// \brief      Calculates 1/b, using enough Newton-Raphson iterations for full precision.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> Reciprocal(FpF<BaseType, OverflowType, numFracBits> b) {
+    return Reciprocal<detail::ReciprocalIterations<BaseType>::value>(b);
+}
+
+/// \brief      Calculates a/b by multiplying a with the reciprocal of b, without a hardware divide.
+/// \details    Rounds towards zero (like the '/' operator), but may be 1 LSB smaller in magnitude than
+///             the '/' operator if numIterations does not give full precision.
+/// \warning    b must not be 0.
+template<uint8_t numIterations, class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> FastDivide(FpF<BaseType, OverflowType, numFracBits> a,
+                                                    FpF<BaseType, OverflowType, numFracBits> b) {
+    const int F = (int) sizeof(BaseType) * 8 - 2;
+    int shift;
+    OverflowType x = detail::NormalisedReciprocal<BaseType, OverflowType, numIterations>(
+            detail::Magnitude(b.GetRawVal()), shift);
+    const OverflowType aMagnitude = a.GetRawVal() < 0 ? (OverflowType) -(OverflowType) a.GetRawVal() : (OverflowType) a.GetRawVal();
+    OverflowType result = detail::ShiftBy((OverflowType) (aMagnitude * x), shift + numFracBits - 2 * F);
+    return FpF<BaseType, OverflowType, numFracBits>::FromRaw(
+            (BaseType) ((a.GetRawVal() < 0) != (b.GetRawVal() < 0) ? -result : result));
+}
+
+/// \brief      Calculates a/b, using enough Newton-Raphson iterations for full precision.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> FastDivide(FpF<BaseType, OverflowType, numFracBits> a,
+                                                    FpF<BaseType, OverflowType, numFracBits> b) {
+    return FastDivide<detail::ReciprocalIterations<BaseType>::value>(a, b);
+}
+
+/// \brief      Calculates out[i] = a[i]/divisor, for i = 0 to count - 1.
+/// \details    The reciprocal of the divisor is only calculated once, so each element only costs a multiply
+///             and a shift. Gives the same results as FastDivide<numIterations>(). out may be the same array as a.
+/// \warning    divisor must not be 0.
+template<uint8_t numIterations, class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayFastDivide(const FpF<BaseType, OverflowType, numFracBits>* a, FpF<BaseType, OverflowType, numFracBits> divisor,
+                     FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+    const int F = (int) sizeof(BaseType) * 8 - 2;
+    int shift;
+    const OverflowType x = detail::NormalisedReciprocal<BaseType, OverflowType, numIterations>(
+            detail::Magnitude(divisor.GetRawVal()), shift);
+    const int resultShift = shift + numFracBits - 2 * F;
+    const bool divisorNegative = divisor.GetRawVal() < 0;
+    for(std::size_t i = 0; i < count; i++) {
+        const BaseType aRaw = a[i].GetRawVal();
+        const OverflowType aMagnitude = aRaw < 0 ? (OverflowType) -(OverflowType) aRaw : (OverflowType) aRaw;
+        const OverflowType result = detail::ShiftBy((OverflowType) (aMagnitude * x), resultShift);
+        out[i] = FpF<BaseType, OverflowType, numFracBits>::FromRaw(
+                (BaseType) ((aRaw < 0) != divisorNegative ? -result : result));
+    }
+}
+
+/// \brief      Calculates out[i] = a[i]/divisor, using enough Newton-Raphson iterations for full precision.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayFastDivide(const FpF<BaseType, OverflowType, numFracBits>* a, FpF<BaseType, OverflowType, numFracBits> divisor,
+                     FpF<BaseType, OverflowType, numFracBits>* out, std::size_t count) {
+    ArrayFastDivide<detail::ReciprocalIterations<BaseType>::value>(a, divisor, out, count);
+}
+
+//===============================================================================================//
+//========================================== SQUARE ROOTS =======================================//
+//===============================================================================================//
+
+/// \brief      Calculates sqrt(x).
+/// \details    Exact (rounded down). Returns 0 for negative numbers.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> Sqrt(FpF<BaseType, OverflowType, numFracBits> x) {
+    return FpF<BaseType, OverflowType, numFracBits>::FromRaw(
+            detail::SqrtRaw<BaseType, OverflowType>(x.GetRawVal(), numFracBits));
+}
+
+/// \brief      Calculates 1/sqrt(x).
+/// \details    Uses a count-leading-zeros normalisation, a table lookup and numIterations Newton-Raphson
+///             iterations. Accurate to within 1 LSB with the default number of iterations. The result may
+///             wrap-around if it is too large to be represented.
+/// \tparam     numIterations   Each iteration approximately doubles the number of correct bits, starting from 7.
+/// \warning    x must be greater than 0.
+template<uint8_t numIterations, class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> RSqrt(FpF<BaseType, OverflowType, numFracBits> x) {
+    return FpF<BaseType, OverflowType, numFracBits>::FromRaw(
+            detail::RSqrtRaw<BaseType, OverflowType, numIterations>(x.GetRawVal(), numFracBits));
+}
+
+/// \brief      Calculates 1/sqrt(x), using enough Newton-Raphson iterations for full precision.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> RSqrt(FpF<BaseType, OverflowType, numFracBits> x) {
+    return RSqrt<detail::RSqrtIterations<BaseType>::value>(x);
+}
+
+/// \brief      Calculates out[i] = sqrt(a[i]), for i = 0 to count - 1. out may be the same array as a.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArraySqrt(const FpF<BaseType, OverflowType, numFracBits>* a, FpF<BaseType, OverflowType, numFracBits>* out,
+               std::size_t count) {
+    for(std::size_t i = 0; i < count; i++) {
+        out[i] = Sqrt(a[i]);
+    }
+}
+
+/// \brief      Calculates out[i] = 1/sqrt(a[i]), for i = 0 to count - 1. out may be the same array as a.
+/// \warning    All elements of a must be greater than 0.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void ArrayRSqrt(const FpF<BaseType, OverflowType, numFracBits>* a, FpF<BaseType, OverflowType, numFracBits>* out,
+                std::size_t count) {
+    for(std::size_t i = 0; i < count; i++) {
+        out[i] = RSqrt(a[i]);
+    }
+}
+
+//===============================================================================================//
+//========================================== TRIGONOMETRY =======================================//
+//===============================================================================================//
+
+/// \brief      Calculates sin(x), where x is in radians.
+/// \details    Uses a quarter-wave lookup table (generated at compile time) with linear interpolation.
+///             The maximum error vs. std::sin() is approximately (pi/2/tableSize)^2/8 plus half an LSB of
+///             the FpF type:
+///             - tableSize = 64:   7.6e-5
+///             - tableSize = 256:  4.8e-6 (default, 1KB table)
+///             - tableSize = 1024: 3.0e-7
+///             Works with any numFracBits, large angles are reduced modulo 2pi first.
+/// \tparam     tableSize   Number of table intervals per quarter-wave. Must be a power of 2.
+template<uint16_t tableSize = 256, class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> Sin(FpF<BaseType, OverflowType, numFracBits> x) {
+    return detail::SinResultToFpF<BaseType, OverflowType, numFracBits>(
+            detail::SinOfPhase<tableSize>(detail::AngleToPhase(x)));
+}
+
+/// \brief      Calculates cos(x), where x is in radians.
+/// \details    Same accuracy as Sin().
+template<uint16_t tableSize = 256, class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> Cos(FpF<BaseType, OverflowType, numFracBits> x) {
+    // cos(x) = sin(x + pi/2), a quarter turn is 2^30
+    return detail::SinResultToFpF<BaseType, OverflowType, numFracBits>(
+            detail::SinOfPhase<tableSize>(detail::AngleToPhase(x) + 0x40000000));
+}
+
+/// \brief      Calculates both sin(x) and cos(x), only reducing the angle once.
+/// \details    Same accuracy as Sin().
+template<uint16_t tableSize = 256, class BaseType, class OverflowType, uint8_t numFracBits>
+void SinCos(FpF<BaseType, OverflowType, numFracBits> x, FpF<BaseType, OverflowType, numFracBits>& sin,
+            FpF<BaseType, OverflowType, numFracBits>& cos) {
+    const uint32_t phase = detail::AngleToPhase(x);
+    sin = detail::SinResultToFpF<BaseType, OverflowType, numFracBits>(detail::SinOfPhase<tableSize>(phase));
+    cos = detail::SinResultToFpF<BaseType, OverflowType, numFracBits>(detail::SinOfPhase<tableSize>(phase + 0x40000000));
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPF_MATH_H
+
+// EOF
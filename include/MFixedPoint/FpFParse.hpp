@@ -0,0 +1,178 @@
+///
+/// \file 				FpFParse.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				Bulk parsing of comma- or newline-separated columns of FpF numbers.
+/// \details
+///		ParseColumn() gives identical results to calling FpF::FromChars() on each number. On x86 with SSE4.1
+///		(picked at runtime, see SetSimdIsa()) numbers with up to 8 integer and 8 fractional digits are
+///		parsed with a SIMD kernel which converts all the digits at once, everything else (and every number on
+///		other platforms) falls back to FpF::FromChars().
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPF_PARSE_H
+#define MN_MFIXEDPOINT_FPF_PARSE_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+#include <system_error>
+#include <type_traits>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFArray.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      The result of ParseColumn(). count numbers were parsed, and ptr is where parsing stopped (last, or
+///             the start of the next number if values is full). If a number can't be parsed (see
+///             FromCharsResult), ptr is the start of it and ec is the error.
+struct ParseColumnResult {
+    const char* ptr;
+    std::errc ec;
+    std::size_t count;
+};
+
+namespace detail {
+
+    /// \brief      If p points to a separator ("," "\n" or "\r\n"), returns one past it, otherwise nullptr.
+    inline const char* SkipSeparator(const char* p, const char* last) {
+        if(*p == ',' || *p == '\n')
+            return p + 1;
+        if(*p == '\r' && p + 1 != last && p[1] == '\n')
+            return p + 2;
+        return nullptr;
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+    /// \brief      Parses numbers from p with SSE4.1, for as long as they have at most 8 integer and 8 fractional
+    ///             digits and are followed by a separator within 16 bytes (and there are at least 17 bytes
+    ///             left, so the loads never go past last).
+    /// \details    The digits are shuffled so the integer digits are right-aligned in bytes 0-7 and the
+    ///             fractional digits left-aligned in bytes 8-15 (i.e. the fraction becomes a multiple of
+    ///             10^-8), and then combined 2, 4 and 8 at a time with multiply-adds. numFracBits must be at
+    ///             most 36 so the fraction times 2^numFracBits fits in 64 bits.
+    /// \returns    The number of numbers parsed, p is moved to the start of the next one.
+    template<class BaseType, class NumFracBits>
+    MN_MFIXEDPOINT_TARGET("sse4.1")
+    std::size_t ParseColumnSse41(const char*& p, const char* last, BaseType* out, std::size_t maxCount,
+                                 NumFracBits numFracBits) {
+        const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        const __m128i pairWeights = _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1);
+        const __m128i quadWeights = _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1);
+        const __m128i octWeights = _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1);
+        std::size_t count = 0;
+        while(count < maxCount) {
+            const bool negative = last - p > 17 && *p == '-';
+            const char* const start = p + negative;
+            if(last - start < 17)
+                break;
+            const __m128i chars = _mm_loadu_si128((const __m128i*) start);
+            const __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+            const unsigned digitMask = (unsigned) _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits));
+            const unsigned numIntDigits = (unsigned) __builtin_ctz(~digitMask);
+            if(numIntDigits > 8)
+                break;
+            unsigned numFracDigits = 0, length = numIntDigits;
+            if(start[numIntDigits] == '.') {
+                numFracDigits = (unsigned) __builtin_ctz(~(digitMask >> (numIntDigits + 1)));
+                length += 1 + numFracDigits;
+            }
+            if(numFracDigits > 8 || numIntDigits + numFracDigits == 0)
+                break;
+            const char* const next = SkipSeparator(start + length, last);
+            if(next == nullptr)
+                break;
+
+            // Bytes which don't get a digit have the top bit of their shuffle index set, which shuffles in 0
+            const __m128i intIndices = _mm_add_epi8(iota, _mm_set1_epi8((char) (numIntDigits - 8)));
+            const __m128i fracIndices = _mm_or_si128(_mm_add_epi8(iota, _mm_set1_epi8((char) (numIntDigits - 7))),
+                    _mm_andnot_si128(_mm_cmpgt_epi8(_mm_set1_epi8((char) (8 + numFracDigits)), iota),
+                                     _mm_set1_epi8((char) 0x80)));
+            const __m128i aligned = _mm_shuffle_epi8(digits, _mm_blend_epi16(intIndices, fracIndices, 0xF0));
+            const __m128i pairs = _mm_maddubs_epi16(aligned, pairWeights);
+            const __m128i quads = _mm_madd_epi16(pairs, quadWeights);
+            const __m128i octs = _mm_madd_epi16(_mm_packus_epi32(quads, quads), octWeights);
+            const uint64_t intPart = (uint32_t) _mm_cvtsi128_si32(octs);
+
+            // Round the fraction (exactly frac / 10^8) to numFracBits bits, ties to even
+            const uint64_t scaledFrac = (uint64_t) (uint32_t) _mm_extract_epi32(octs, 1) << numFracBits;
+            uint64_t fracBits = scaledFrac / 100000000u;
+            const uint64_t remainder = scaledFrac % 100000000u;
+            const bool odd = numFracBits > 0 ? (fracBits & 1) : (intPart & 1);
+            if(remainder > 50000000u || (remainder == 50000000u && odd))
+                fracBits++;
+
+            int64_t rawVal;
+            if(!MakeParsedRaw(negative, intPart, fracBits, numFracBits, sizeof(BaseType) * 8, rawVal))
+                break;
+            out[count++] = (BaseType) rawVal;
+            p = next;
+        }
+        return count;
+    }
+#endif
+
+    /// \brief      Parses a column of raw values, with the SIMD kernel if possible.
+    template<class BaseType, class NumFracBits>
+    ParseColumnResult ParseColumnRaw(const char* first, const char* last, BaseType* out, std::size_t maxCount,
+                                     NumFracBits numFracBits) {
+        const char* p = first;
+        std::size_t count = 0;
+        while(p != last && count < maxCount) {
+#if MN_MFIXEDPOINT_X86_SIMD
+            if(numFracBits <= 36 && ActiveSimdIsa() >= SimdIsa::Sse41) {
+                count += ParseColumnSse41(p, last, out + count, maxCount - count, numFracBits);
+                if(p == last || count == maxCount)
+                    break;
+            }
+#endif
+            int64_t rawVal;
+            const FromCharsResult result = CharsToRaw(p, last, numFracBits, sizeof(BaseType) * 8, rawVal);
+            if(result.ec != std::errc())
+                return ParseColumnResult{ p, result.ec, count };
+            const char* next = last;
+            if(result.ptr != last) {
+                next = SkipSeparator(result.ptr, last);
+                if(next == nullptr)
+                    return ParseColumnResult{ p, std::errc::invalid_argument, count };
+            }
+            out[count++] = (BaseType) rawVal;
+            p = next;
+        }
+        return ParseColumnResult{ p, std::errc(), count };
+    }
+
+} // namespace detail
+
+/// \brief      Parses up to maxCount numbers separated by commas or newlines ("\n" or "\r\n") from [first, last)
+///             into values. A separator after the last number is allowed.
+/// \details    Each number is parsed (and rounded) exactly like FpF::FromChars().
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+ParseColumnResult ParseColumn(const char* first, const char* last, FpF<BaseType, OverflowType, numFracBits>* values,
+                              std::size_t maxCount) {
+    static_assert(sizeof(FpF<BaseType, OverflowType, numFracBits>) == sizeof(BaseType),
+                  "FpF arrays must have the same memory layout as arrays of BaseType.");
+    return detail::ParseColumnRaw(first, last, reinterpret_cast<BaseType*>(values), maxCount,
+                                  std::integral_constant<unsigned, numFracBits>());
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPF_PARSE_H
+
+// EOF
@@ -0,0 +1,416 @@
+///
+/// \file 				FpFSat.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				Saturating version of the FpF class.
+/// \details
+///		FpFSat behaves like FpF, except that results which do not fit in the BaseType are clamped to the
+///		largest/smallest representable number instead of wrapping around.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPF_SAT_H
+#define MN_MFIXEDPOINT_FPF_SAT_H
+
+// System includes
+#include <limits>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/Int128.hpp"
+
+/// \brief      Defined to 1 if the compiler has __builtin_add_overflow() and __builtin_sub_overflow().
+#ifndef MN_MFIXEDPOINT_HAS_OVERFLOW_BUILTINS
+    #if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+        #define MN_MFIXEDPOINT_HAS_OVERFLOW_BUILTINS 1
+    #else
+        #define MN_MFIXEDPOINT_HAS_OVERFLOW_BUILTINS 0
+    #endif
+#endif
+
+namespace mn {
+namespace MFixedPoint {
+
+namespace detail {
+
+    /// \brief      An integer type wide enough to hold the product of a BaseType and an int without overflowing.
+    template<class BaseType>
+    struct SatWideType {
+        typedef typename std::conditional<sizeof(BaseType) < 8, int64_t, Int128>::type type;
+    };
+
+    /// \brief      Clamps x to the range of BaseType.
+    /// \details    Written as two selects so that compilers emit conditional moves rather than branches.
+    template<class BaseType, class WideType>
+    BaseType SaturateCast(WideType x) {
+        const WideType maxVal = (WideType) (int64_t) std::numeric_limits<BaseType>::max();
+        const WideType minVal = (WideType) (int64_t) std::numeric_limits<BaseType>::min();
+        x = x > maxVal ? maxVal : x;
+        x = x < minVal ? minVal : x;
+        return (BaseType) x;
+    }
+
+    /// \brief      Returns the largest representable number with the same sign as x (the smallest one if x
+    ///             is negative), without branching.
+    template<class BaseType>
+    BaseType SaturateToSignOf(BaseType x) {
+        return (BaseType) ((x >> (sizeof(BaseType) * 8 - 1)) ^ std::numeric_limits<BaseType>::max());
+    }
+
+    /// \brief      Returns saturated if overflow is true, otherwise result.
+    /// \details    Uses a mask rather than '?:', as compilers otherwise tend to branch on the overflow flag.
+    template<class BaseType>
+    BaseType SelectIfOverflow(bool overflow, BaseType saturated, BaseType result) {
+        const BaseType mask = (BaseType) -(BaseType) overflow;
+        return (BaseType) ((saturated & mask) | (result & ~mask));
+    }
+
+    /// \brief      Calculates a + b, clamped to the range of BaseType.
+    template<class BaseType>
+    BaseType SaturatingAdd(BaseType a, BaseType b) {
+        BaseType result;
+#if MN_MFIXEDPOINT_HAS_OVERFLOW_BUILTINS
+        const bool overflow = __builtin_add_overflow(a, b, &result);
+#else
+        typedef typename std::make_unsigned<BaseType>::type UnsignedType;
+        result = (BaseType) ((UnsignedType) a + (UnsignedType) b);
+        // Overflow happened if a and b have the same sign and the result has a different one
+        const bool overflow = (BaseType) ((a ^ result) & (b ^ result)) < 0;
+#endif
+        // When adding overflows, a and b have the same sign, so saturate towards the sign of a
+        return SelectIfOverflow(overflow, SaturateToSignOf(a), result);
+    }
+
+    /// \brief      Calculates a - b, clamped to the range of BaseType.
+    template<class BaseType>
+    BaseType SaturatingSubtract(BaseType a, BaseType b) {
+        BaseType result;
+#if MN_MFIXEDPOINT_HAS_OVERFLOW_BUILTINS
+        const bool overflow = __builtin_sub_overflow(a, b, &result);
+#else
+        typedef typename std::make_unsigned<BaseType>::type UnsignedType;
+        result = (BaseType) ((UnsignedType) a - (UnsignedType) b);
+        // Overflow happened if a and b have different signs and the result has a different sign to a
+        const bool overflow = (BaseType) ((a ^ b) & (a ^ result)) < 0;
+#endif
+        // When subtracting overflows, the result should have the sign of a
+        return SelectIfOverflow(overflow, SaturateToSignOf(a), result);
+    }
+
+    /// \brief      Calculates (a * b) >> numFracBits in OverflowType, clamped to the range of BaseType.
+    template<class BaseType, class OverflowType>
+    BaseType SaturatingMultiply(BaseType a, BaseType b, uint8_t numFracBits) {
+        return SaturateCast<BaseType>(((OverflowType) a * (OverflowType) b) >> numFracBits);
+    }
+
+    /// \brief      Calculates (a * 2^numFracBits) / b in OverflowType, clamped to the range of BaseType.
+    /// \details    Dividing by zero saturates towards the sign of a.
+    template<class BaseType, class OverflowType>
+    BaseType SaturatingDivide(BaseType a, BaseType b, uint8_t numFracBits) {
+        if(b == 0)
+            return SaturateToSignOf(a);
+        return SaturateCast<BaseType>(((OverflowType) a * ((OverflowType) 1 << numFracBits)) / (OverflowType) b);
+    }
+
+    /// \brief      Calculates a * 2^shift, clamped to the range of BaseType. Negative shifts shift right.
+    template<class BaseType, class OverflowType>
+    BaseType SaturatingShiftLeft(BaseType a, int shift) {
+        const int numBits = (int) sizeof(BaseType) * 8;
+        if(shift < 0)
+            return (BaseType) (a >> (-shift < numBits ? -shift : numBits - 1));
+        // Any shift of a non-zero number by numBits - 1 or more saturates, so clamp the shift to keep
+        // the intermediary result within OverflowType
+        return SaturateCast<BaseType>((OverflowType) a * ((OverflowType) 1 << (shift < numBits ? shift : numBits - 1)));
+    }
+
+    /// \brief      Converts a double to a raw value with numFracBits fractional bits, clamped to the range of
+    ///             BaseType.
+    template<class BaseType>
+    BaseType SaturateDoubleToRaw(double f, uint8_t numFracBits) {
+        const double scaled = f * (double) ((uint64_t) 1 << numFracBits);
+        if(scaled >= (double) std::numeric_limits<BaseType>::max())
+            return std::numeric_limits<BaseType>::max();
+        if(scaled <= (double) std::numeric_limits<BaseType>::min())
+            return std::numeric_limits<BaseType>::min();
+        return (BaseType) scaled;
+    }
+
+} // namespace detail
+
+/// \brief      A saturating fast fixed-point number.
+/// \details    Same as FpF, except that addition, subtraction, multiplication, division, negation, shifts and
+///             the constructors clamp results that do not fit in the BaseType to the largest/smallest
+///             representable number, rather than wrapping around. Division by zero saturates towards the sign
+///             of the dividend.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+class FpFSat {
+
+public:
+
+    //===============================================================================================//
+    //================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+    //===============================================================================================//
+
+    FpFSat() = default;
+
+    ~FpFSat() = default;
+
+    FpFSat(int8_t i) :
+            rawVal_(detail::SaturateCast<BaseType>((typename detail::SatWideType<BaseType>::type) i *
+                                                   ((typename detail::SatWideType<BaseType>::type) 1 << numFracBits))) {}
+
+    FpFSat(int16_t i) :
+            rawVal_(detail::SaturateCast<BaseType>((typename detail::SatWideType<BaseType>::type) i *
+                                                   ((typename detail::SatWideType<BaseType>::type) 1 << numFracBits))) {}
+
+    FpFSat(int32_t i) :
+            rawVal_(detail::SaturateCast<BaseType>((typename detail::SatWideType<BaseType>::type) i *
+                                                   ((typename detail::SatWideType<BaseType>::type) 1 << numFracBits))) {}
+
+    /// \brief      Create a fixed-point number from a float, clamped to the representable range.
+    FpFSat(float f) :
+            rawVal_(detail::SaturateDoubleToRaw<BaseType>(f, numFracBits)) {}
+
+    /// \brief      Create a fixed-point number from a double, clamped to the representable range.
+    FpFSat(double f) :
+            rawVal_(detail::SaturateDoubleToRaw<BaseType>(f, numFracBits)) {}
+
+    /// \brief      Converts a wrapping FpF into a saturating FpFSat (the raw value is unchanged).
+    explicit FpFSat(FpF<BaseType, OverflowType, numFracBits> x) :
+            rawVal_(x.GetRawVal()) {}
+
+    //===============================================================================================//
+    //========================================= GETTERS/SETTERS =====================================//
+    //===============================================================================================//
+
+    /// \brief      Get the raw value (memory representation) of this fixed-point number,
+    BaseType GetRawVal() const {
+        return rawVal_;
+    }
+
+    /// \brief      Creates a fixed-point number directly from a raw value (memory representation).
+    static FpFSat FromRaw(BaseType rawVal) {
+        FpFSat x;
+        x.rawVal_ = rawVal;
+        return x;
+    }
+
+    /// \brief      The largest representable number.
+    static FpFSat Max() {
+        return FromRaw(std::numeric_limits<BaseType>::max());
+    }
+
+    /// \brief      The smallest (most negative) representable number.
+    static FpFSat Min() {
+        return FromRaw(std::numeric_limits<BaseType>::min());
+    }
+
+    //===============================================================================================//
+    //================================= COMPOUND ARITHMETIC OVERLOADS ===============================//
+    //===============================================================================================//
+
+    FpFSat& operator += (FpFSat r) {
+        rawVal_ = detail::SaturatingAdd(rawVal_, r.rawVal_);
+        return *this;
+    }
+
+    FpFSat& operator -= (FpFSat r) {
+        rawVal_ = detail::SaturatingSubtract(rawVal_, r.rawVal_);
+        return *this;
+    }
+
+    FpFSat& operator *= (FpFSat r) {
+        rawVal_ = detail::SaturatingMultiply<BaseType, OverflowType>(rawVal_, r.rawVal_, numFracBits);
+        return *this;
+    }
+
+    FpFSat& operator /= (FpFSat r) {
+        rawVal_ = detail::SaturatingDivide<BaseType, OverflowType>(rawVal_, r.rawVal_, numFracBits);
+        return *this;
+    }
+
+    /// \brief      Multiplies by 2^shift.
+    FpFSat& operator <<= (int shift) {
+        rawVal_ = detail::SaturatingShiftLeft<BaseType, OverflowType>(rawVal_, shift);
+        return *this;
+    }
+
+    /// \brief      Divides by 2^shift (rounds towards negative infinity).
+    FpFSat& operator >>= (int shift) {
+        rawVal_ = detail::SaturatingShiftLeft<BaseType, OverflowType>(rawVal_, -shift);
+        return *this;
+    }
+
+    //===============================================================================================//
+    //================================== SIMPLE ARITHMETIC OVERLOADS ================================//
+    //===============================================================================================//
+
+    /// \brief      Overload for '-itself' operator. The most negative number saturates to the largest one.
+    FpFSat operator - () const {
+        return FromRaw(detail::SaturatingSubtract((BaseType) 0, rawVal_));
+    }
+
+    FpFSat operator + (FpFSat r) const {
+        FpFSat x = *this;
+        x += r;
+        return x;
+    }
+
+    FpFSat operator - (FpFSat r) const {
+        FpFSat x = *this;
+        x -= r;
+        return x;
+    }
+
+    FpFSat operator * (FpFSat r) const {
+        FpFSat x = *this;
+        x *= r;
+        return x;
+    }
+
+    FpFSat operator / (FpFSat r) const {
+        FpFSat x = *this;
+        x /= r;
+        return x;
+    }
+
+    FpFSat operator << (int shift) const {
+        FpFSat x = *this;
+        x <<= shift;
+        return x;
+    }
+
+    FpFSat operator >> (int shift) const {
+        FpFSat x = *this;
+        x >>= shift;
+        return x;
+    }
+
+    //===============================================================================================//
+    //================================ OVERLOADS BETWEEN FpFSat AND int =============================//
+    //===============================================================================================//
+
+    FpFSat& operator *= (int r) {
+        rawVal_ = detail::SaturateCast<BaseType>((typename detail::SatWideType<BaseType>::type) rawVal_ * r);
+        return *this;
+    }
+
+    FpFSat& operator /= (int r) {
+        if(r == 0)
+            rawVal_ = detail::SaturateToSignOf(rawVal_);
+        else
+            rawVal_ = detail::SaturateCast<BaseType>((typename detail::SatWideType<BaseType>::type) rawVal_ / r);
+        return *this;
+    }
+
+    FpFSat operator + (int r) const {
+        return *this + FpFSat(r);
+    }
+
+    FpFSat operator - (int r) const {
+        return *this - FpFSat(r);
+    }
+
+    FpFSat operator * (int r) const {
+        FpFSat x = *this;
+        x *= r;
+        return x;
+    }
+
+    FpFSat operator / (int r) const {
+        FpFSat x = *this;
+        x /= r;
+        return x;
+    }
+
+    //===============================================================================================//
+    //====================================== COMPARISON OVERLOADS ===================================//
+    //===============================================================================================//
+
+    bool operator == (FpFSat r) const { return rawVal_ == r.rawVal_; }
+    bool operator != (FpFSat r) const { return rawVal_ != r.rawVal_; }
+    bool operator < (FpFSat r) const { return rawVal_ < r.rawVal_; }
+    bool operator > (FpFSat r) const { return rawVal_ > r.rawVal_; }
+    bool operator <= (FpFSat r) const { return rawVal_ <= r.rawVal_; }
+    bool operator >= (FpFSat r) const { return rawVal_ >= r.rawVal_; }
+
+    //===============================================================================================//
+    //======================================= CONVERSION METHODS ====================================//
+    //===============================================================================================//
+
+    /// \brief      Converts the fixed-point number into an integer.
+    /// \details    Always rounds to negative infinity (66.3 becomes 66, -66.3 becomes -67).
+    template<class IntType>
+    IntType ToInt() const {
+        return (IntType) (rawVal_ >> numFracBits);
+    }
+
+    /// \brief      Converts the fixed-point number to a float.
+    float ToFloat() const {
+        return (float) rawVal_ / (float) ((uint64_t) 1 << numFracBits);
+    }
+
+    /// \brief      Converts the fixed-point number to a double.
+    double ToDouble() const {
+        return (double) rawVal_ / (double) ((uint64_t) 1 << numFracBits);
+    }
+
+    /// \brief      Converts to the equivalent wrapping FpF (the raw value is unchanged).
+    FpF<BaseType, OverflowType, numFracBits> ToFpF() const {
+        return FpF<BaseType, OverflowType, numFracBits>::FromRaw(rawVal_);
+    }
+
+    //===============================================================================================//
+    //====================================== STRING/STREAM RELATED ==================================//
+    //===============================================================================================//
+
+    /// \brief      Converts the fixed-point number into a string representation, using a fixed-point->double->string
+    ///             conversion process.
+    std::string ToString() const {
+        return std::to_string(ToDouble());
+    }
+
+    /// \brief      Overload so we can print to a ostream (e.g. std::cout).
+    friend std::ostream& operator<<(std::ostream& stream, FpFSat obj) {
+        stream << obj.ToDouble();
+        return stream;
+    }
+
+private:
+
+    /// \brief      The fixed-point number is stored in this basic data type.
+    BaseType rawVal_;
+
+};
+
+template<uint8_t numFracBits>
+using FpFSat8 = FpFSat<int8_t, int16_t, numFracBits>;
+
+template<uint8_t numFracBits>
+using FpFSat16 = FpFSat<int16_t, int32_t, numFracBits>;
+
+template<uint8_t numFracBits>
+using FpFSat32 = FpFSat<int32_t, int64_t, numFracBits>;
+
+template<uint8_t numFracBits>
+using FpFSat64 = FpFSat<int64_t, Int128, numFracBits>;
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPF_SAT_H
+
+// EOF
@@ -0,0 +1,418 @@
+///
+/// \file 				FpMatrix.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				Fixed-size matrices and vectors of FpF numbers, and a matrix multiply for large matrices.
+/// \details
+///		Every output of a matrix product is a dot product which is accumulated in OverflowType and shifted
+///		once, instead of shifting (and truncating) every product like FpF's '*' operator does.
+///		The fixed-size FpMatrix operations are constexpr and fully unrolled at compile time (with index
+///		sequences), so they are meant for small matrices (e.g. 3x3 and 4x4 transforms).
+///		MatrixMultiply() multiplies dynamically sized row-major matrices in cache-sized blocks, with an AVX2
+///		kernel for FpF32 (selected like the ones in FpFArray.hpp).
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FP_MATRIX_H
+#define MN_MFIXEDPOINT_FP_MATRIX_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFArray.hpp"
+#include "MFixedPoint/FpFMath.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+namespace detail {
+
+    /// \brief      Adds up the values, at compile time if they are constants.
+    template<class T>
+    constexpr T MatrixSum(T x) {
+        return x;
+    }
+
+    template<class T, class... Ts>
+    constexpr T MatrixSum(T x, Ts... rest) {
+        return x + MatrixSum(rest...);
+    }
+
+} // namespace detail
+
+/// \brief      A numRows x numCols matrix of FpFType numbers, stored in row-major order.
+/// \details    FpFType must be an FpF type (e.g. FpF32<16>).
+template<class FpFType, std::size_t numRows, std::size_t numCols>
+class FpMatrix;
+
+/// \brief      A column vector of numRows FpFType numbers.
+template<class FpFType, std::size_t numRows>
+using FpVec = FpMatrix<FpFType, numRows, 1>;
+
+template<class BaseType, class OverflowType, uint8_t numFracBits, std::size_t numRows, std::size_t numCols>
+class FpMatrix<FpF<BaseType, OverflowType, numFracBits>, numRows, numCols> {
+
+    static_assert(numRows > 0 && numCols > 0, "A matrix must have at least one row and one column.");
+
+    template<class, std::size_t, std::size_t>
+    friend class FpMatrix;
+
+public:
+
+    typedef FpF<BaseType, OverflowType, numFracBits> FpFType;
+
+    //===============================================================================================//
+    //================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+    //===============================================================================================//
+
+    FpMatrix() = default;
+
+    /// \brief      Creates a matrix from its numRows*numCols elements in row-major order, e.g.
+    ///             FpMatrix<FpF32<16>, 2, 2>({ a, b, c, d }).
+    constexpr FpMatrix(const FpFType (&values)[numRows * numCols]) :
+            FpMatrix(values, typename detail::MakeIndexSequence<numRows * numCols>::type()) {}
+
+    /// \brief      Returns a matrix with every element set to 0.
+    static constexpr FpMatrix Zero() {
+        return Fill(FpFType::FromRaw(0), typename detail::MakeIndexSequence<numRows * numCols>::type());
+    }
+
+    /// \brief      Returns a matrix with 1s on the diagonal and 0s everywhere else.
+    static constexpr FpMatrix Identity() {
+        return Identity(typename detail::MakeIndexSequence<numRows * numCols>::type());
+    }
+
+    //===============================================================================================//
+    //========================================= GETTERS/SETTERS =====================================//
+    //===============================================================================================//
+
+    constexpr FpFType operator () (std::size_t row, std::size_t col) const {
+        return values_[row * numCols + col];
+    }
+
+    FpFType& operator () (std::size_t row, std::size_t col) {
+        return values_[row * numCols + col];
+    }
+
+    /// \brief      Returns element i in row-major order (so element i of a vector).
+    constexpr FpFType operator [] (std::size_t i) const {
+        return values_[i];
+    }
+
+    FpFType& operator [] (std::size_t i) {
+        return values_[i];
+    }
+
+    /// \brief      Returns a pointer to the row-major elements, e.g. to pass to MatrixMultiply().
+    const FpFType* Data() const {
+        return values_;
+    }
+
+    FpFType* Data() {
+        return values_;
+    }
+
+    //===============================================================================================//
+    //==================================== ARITHMETIC OVERLOADS =====================================//
+    //===============================================================================================//
+
+    constexpr FpMatrix operator - () const {
+        return Negate(typename detail::MakeIndexSequence<numRows * numCols>::type());
+    }
+
+    constexpr FpMatrix operator + (const FpMatrix& r) const {
+        return Add(r, typename detail::MakeIndexSequence<numRows * numCols>::type());
+    }
+
+    constexpr FpMatrix operator - (const FpMatrix& r) const {
+        return Subtract(r, typename detail::MakeIndexSequence<numRows * numCols>::type());
+    }
+
+    /// \brief      Matrix product. Each element is a dot product which is accumulated in OverflowType and
+    ///             shifted once.
+    template<std::size_t numColsR>
+    constexpr FpMatrix<FpFType, numRows, numColsR> operator * (const FpMatrix<FpFType, numCols, numColsR>& r) const {
+        return Multiply(r, typename detail::MakeIndexSequence<numRows * numColsR>::type());
+    }
+
+    /// \brief      Multiplies every element by a scalar.
+    constexpr FpMatrix operator * (FpFType r) const {
+        return Scale(r, typename detail::MakeIndexSequence<numRows * numCols>::type());
+    }
+
+    FpMatrix& operator += (const FpMatrix& r) {
+        *this = *this + r;
+        return *this;
+    }
+
+    FpMatrix& operator -= (const FpMatrix& r) {
+        *this = *this - r;
+        return *this;
+    }
+
+    //===============================================================================================//
+    //==================================== COMPARISON OVERLOADS =====================================//
+    //===============================================================================================//
+
+    constexpr bool operator == (const FpMatrix& r) const {
+        return Equal(r, 0);
+    }
+
+    constexpr bool operator != (const FpMatrix& r) const {
+        return !(*this == r);
+    }
+
+    //===============================================================================================//
+    //=========================================== METHODS ===========================================//
+    //===============================================================================================//
+
+    constexpr FpMatrix<FpFType, numCols, numRows> Transpose() const {
+        return Transpose(typename detail::MakeIndexSequence<numRows * numCols>::type());
+    }
+
+private:
+
+    struct ValuesTag {};
+
+    template<class... Values>
+    constexpr FpMatrix(ValuesTag, Values... values) :
+            values_{ values... } {}
+
+    template<std::size_t... indices>
+    constexpr FpMatrix(const FpFType (&values)[numRows * numCols], detail::IndexSequence<indices...>) :
+            values_{ values[indices]... } {}
+
+    /// \brief      Returns value, ignoring index (so a pack expansion can repeat a value).
+    template<std::size_t index>
+    static constexpr FpFType Repeat(FpFType value) {
+        return value;
+    }
+
+    template<std::size_t... indices>
+    static constexpr FpMatrix Fill(FpFType value, detail::IndexSequence<indices...>) {
+        return FpMatrix(ValuesTag(), Repeat<indices>(value)...);
+    }
+
+    template<std::size_t... indices>
+    static constexpr FpMatrix Identity(detail::IndexSequence<indices...>) {
+        return FpMatrix(ValuesTag(), FpFType::FromRaw(indices / numCols == indices % numCols ?
+                                                      (BaseType) ((BaseType) 1 << numFracBits) : (BaseType) 0)...);
+    }
+
+    template<std::size_t... indices>
+    constexpr FpMatrix Negate(detail::IndexSequence<indices...>) const {
+        return FpMatrix(ValuesTag(), -values_[indices]...);
+    }
+
+    template<std::size_t... indices>
+    constexpr FpMatrix Add(const FpMatrix& r, detail::IndexSequence<indices...>) const {
+        return FpMatrix(ValuesTag(), (values_[indices] + r.values_[indices])...);
+    }
+
+    template<std::size_t... indices>
+    constexpr FpMatrix Subtract(const FpMatrix& r, detail::IndexSequence<indices...>) const {
+        return FpMatrix(ValuesTag(), (values_[indices] - r.values_[indices])...);
+    }
+
+    template<std::size_t... indices>
+    constexpr FpMatrix Scale(FpFType r, detail::IndexSequence<indices...>) const {
+        return FpMatrix(ValuesTag(), (values_[indices] * r)...);
+    }
+
+    constexpr bool Equal(const FpMatrix& r, std::size_t i) const {
+        return i == numRows * numCols || (values_[i] == r.values_[i] && Equal(r, i + 1));
+    }
+
+    template<std::size_t... indices>
+    constexpr FpMatrix<FpFType, numCols, numRows> Transpose(detail::IndexSequence<indices...>) const {
+        return FpMatrix<FpFType, numCols, numRows>(typename FpMatrix<FpFType, numCols, numRows>::ValuesTag(),
+                                                   values_[indices % numRows * numCols + indices / numRows]...);
+    }
+
+    /// \brief      Element index of the product with r, the dot product of a row and a column.
+    template<std::size_t index, std::size_t numColsR, std::size_t... inner>
+    constexpr FpFType ProductElement(const FpMatrix<FpFType, numCols, numColsR>& r,
+                                     detail::IndexSequence<inner...>) const {
+        return FpFType::FromRaw((BaseType) (detail::MatrixSum(
+                (OverflowType) values_[index / numColsR * numCols + inner].GetRawVal() *
+                r.values_[inner * numColsR + index % numColsR].GetRawVal()...) >> numFracBits));
+    }
+
+    template<std::size_t numColsR, std::size_t... indices>
+    constexpr FpMatrix<FpFType, numRows, numColsR> Multiply(const FpMatrix<FpFType, numCols, numColsR>& r,
+                                                            detail::IndexSequence<indices...>) const {
+        return FpMatrix<FpFType, numRows, numColsR>(
+                typename FpMatrix<FpFType, numRows, numColsR>::ValuesTag(),
+                ProductElement<indices>(r, typename detail::MakeIndexSequence<numCols>::type())...);
+    }
+
+    FpFType values_[numRows * numCols];
+
+};
+
+/// \brief      Dot product of two vectors, accumulated in OverflowType and shifted once.
+template<class BaseType, class OverflowType, uint8_t numFracBits, std::size_t numRows>
+constexpr FpF<BaseType, OverflowType, numFracBits> Dot(
+        const FpVec<FpF<BaseType, OverflowType, numFracBits>, numRows>& a,
+        const FpVec<FpF<BaseType, OverflowType, numFracBits>, numRows>& b) {
+    return (a.Transpose() * b)[0];
+}
+
+namespace detail {
+
+    /// \brief      The sizes of the blocks MatrixMultiply() works on. A blockRows x blockCols tile of the output
+    ///             is accumulated (in OverflowType) over blockDepth long slices of the inner dimension, so the
+    ///             tile and the blocks of a and b it needs stay in cache.
+    struct MatrixBlockSizes {
+        static constexpr std::size_t blockRows = 64;
+        static constexpr std::size_t blockCols = 256;
+        static constexpr std::size_t blockDepth = 256;
+    };
+
+    /// \brief      Portable kernel, acc[i][j] += sum(a[i][kk] * b[kk][j]) for the given block.
+    /// \details    acc has a row stride of blockCols. The innermost loop goes along a row of b and acc, so
+    ///             the compiler can vectorize it.
+    template<class BaseType, class OverflowType>
+    void MatrixBlockScalar(const BaseType* a, const BaseType* b, OverflowType* acc, std::size_t lda, std::size_t ldb,
+                           std::size_t rows, std::size_t depth, std::size_t cols) {
+        for(std::size_t i = 0; i < rows; i++) {
+            OverflowType* accRow = acc + i * MatrixBlockSizes::blockCols;
+            for(std::size_t kk = 0; kk < depth; kk++) {
+                const OverflowType aik = a[i * lda + kk];
+                const BaseType* bRow = b + kk * ldb;
+                for(std::size_t j = 0; j < cols; j++)
+                    accRow[j] += aik * bRow[j];
+            }
+        }
+    }
+
+#if MN_MFIXEDPOINT_X86_SIMD
+
+    /// \brief      AVX2 version of MatrixBlockScalar() for FpF32. 4 x 8 tiles of the accumulators are kept in
+    ///             registers for the whole slice, as 64-bit lanes.
+    MN_MFIXEDPOINT_TARGET("avx2")
+    inline void MatrixBlockAvx2(const int32_t* a, const int32_t* b, int64_t* acc, std::size_t lda, std::size_t ldb,
+                                std::size_t rows, std::size_t depth, std::size_t cols) {
+        const std::size_t stride = MatrixBlockSizes::blockCols;
+        std::size_t i = 0;
+        for(; i + 4 <= rows; i += 4) {
+            std::size_t j = 0;
+            for(; j + 8 <= cols; j += 8) {
+                int64_t* c = acc + i * stride + j;
+                __m256i c0Lo = _mm256_loadu_si256((const __m256i*) c);
+                __m256i c0Hi = _mm256_loadu_si256((const __m256i*) (c + 4));
+                __m256i c1Lo = _mm256_loadu_si256((const __m256i*) (c + stride));
+                __m256i c1Hi = _mm256_loadu_si256((const __m256i*) (c + stride + 4));
+                __m256i c2Lo = _mm256_loadu_si256((const __m256i*) (c + 2*stride));
+                __m256i c2Hi = _mm256_loadu_si256((const __m256i*) (c + 2*stride + 4));
+                __m256i c3Lo = _mm256_loadu_si256((const __m256i*) (c + 3*stride));
+                __m256i c3Hi = _mm256_loadu_si256((const __m256i*) (c + 3*stride + 4));
+                const int32_t* aRow = a + i * lda;
+                for(std::size_t kk = 0; kk < depth; kk++) {
+                    // mul_epi32 multiplies the (sign-extended) low halves of the 64-bit lanes
+                    const int32_t* bRow = b + kk * ldb + j;
+                    const __m256i bLo = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) bRow));
+                    const __m256i bHi = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) (bRow + 4)));
+                    const __m256i a0 = _mm256_set1_epi32(aRow[kk]);
+                    const __m256i a1 = _mm256_set1_epi32(aRow[lda + kk]);
+                    const __m256i a2 = _mm256_set1_epi32(aRow[2*lda + kk]);
+                    const __m256i a3 = _mm256_set1_epi32(aRow[3*lda + kk]);
+                    c0Lo = _mm256_add_epi64(c0Lo, _mm256_mul_epi32(a0, bLo));
+                    c0Hi = _mm256_add_epi64(c0Hi, _mm256_mul_epi32(a0, bHi));
+                    c1Lo = _mm256_add_epi64(c1Lo, _mm256_mul_epi32(a1, bLo));
+                    c1Hi = _mm256_add_epi64(c1Hi, _mm256_mul_epi32(a1, bHi));
+                    c2Lo = _mm256_add_epi64(c2Lo, _mm256_mul_epi32(a2, bLo));
+                    c2Hi = _mm256_add_epi64(c2Hi, _mm256_mul_epi32(a2, bHi));
+                    c3Lo = _mm256_add_epi64(c3Lo, _mm256_mul_epi32(a3, bLo));
+                    c3Hi = _mm256_add_epi64(c3Hi, _mm256_mul_epi32(a3, bHi));
+                }
+                _mm256_storeu_si256((__m256i*) c, c0Lo);
+                _mm256_storeu_si256((__m256i*) (c + 4), c0Hi);
+                _mm256_storeu_si256((__m256i*) (c + stride), c1Lo);
+                _mm256_storeu_si256((__m256i*) (c + stride + 4), c1Hi);
+                _mm256_storeu_si256((__m256i*) (c + 2*stride), c2Lo);
+                _mm256_storeu_si256((__m256i*) (c + 2*stride + 4), c2Hi);
+                _mm256_storeu_si256((__m256i*) (c + 3*stride), c3Lo);
+                _mm256_storeu_si256((__m256i*) (c + 3*stride + 4), c3Hi);
+            }
+            if(j < cols)
+                MatrixBlockScalar<int32_t, int64_t>(a + i * lda, b + j, acc + i * stride + j, lda, ldb, 4, depth,
+                                                    cols - j);
+        }
+        MatrixBlockScalar<int32_t, int64_t>(a + i * lda, b, acc + i * stride, lda, ldb, rows - i, depth, cols);
+    }
+
+#endif // #if MN_MFIXEDPOINT_X86_SIMD
+
+    template<class BaseType, class OverflowType>
+    void MatrixBlock(const BaseType* a, const BaseType* b, OverflowType* acc, std::size_t lda, std::size_t ldb,
+                     std::size_t rows, std::size_t depth, std::size_t cols) {
+#if MN_MFIXEDPOINT_X86_SIMD
+        if(std::is_same<BaseType, int32_t>::value && std::is_same<OverflowType, int64_t>::value &&
+           ActiveSimdIsa() >= SimdIsa::Avx2) {
+            MatrixBlockAvx2(reinterpret_cast<const int32_t*>(a), reinterpret_cast<const int32_t*>(b),
+                            reinterpret_cast<int64_t*>(acc), lda, ldb, rows, depth, cols);
+            return;
+        }
+#endif
+        MatrixBlockScalar<BaseType, OverflowType>(a, b, acc, lda, ldb, rows, depth, cols);
+    }
+
+} // namespace detail
+
+/// \brief      out = a * b, where a is numRows x numInner, b is numInner x numCols and out is numRows x numCols,
+///             all stored in row-major order.
+/// \details    Each element of out is accumulated in OverflowType and shifted once. The output is calculated
+///             in blocks (see detail::MatrixBlockSizes), and FpF32 matrices use an AVX2 kernel when the CPU
+///             supports it (which gives identical results). out must not be the same array as a or b.
+template<class BaseType, class OverflowType, uint8_t numFracBits>
+void MatrixMultiply(const FpF<BaseType, OverflowType, numFracBits>* a,
+                    const FpF<BaseType, OverflowType, numFracBits>* b,
+                    FpF<BaseType, OverflowType, numFracBits>* out,
+                    std::size_t numRows, std::size_t numInner, std::size_t numCols) {
+    static_assert(sizeof(FpF<BaseType, OverflowType, numFracBits>) == sizeof(BaseType),
+                  "FpF arrays must have the same memory layout as arrays of BaseType.");
+    typedef detail::MatrixBlockSizes Sizes;
+    const BaseType* rawA = reinterpret_cast<const BaseType*>(a);
+    const BaseType* rawB = reinterpret_cast<const BaseType*>(b);
+    std::vector<OverflowType> acc(Sizes::blockRows * Sizes::blockCols);
+    for(std::size_t j0 = 0; j0 < numCols; j0 += Sizes::blockCols) {
+        const std::size_t cols = numCols - j0 < Sizes::blockCols ? numCols - j0 : Sizes::blockCols;
+        for(std::size_t i0 = 0; i0 < numRows; i0 += Sizes::blockRows) {
+            const std::size_t rows = numRows - i0 < Sizes::blockRows ? numRows - i0 : Sizes::blockRows;
+            for(std::size_t i = 0; i < rows * Sizes::blockCols; i++)
+                acc[i] = 0;
+            for(std::size_t k0 = 0; k0 < numInner; k0 += Sizes::blockDepth) {
+                const std::size_t depth = numInner - k0 < Sizes::blockDepth ? numInner - k0 : Sizes::blockDepth;
+                detail::MatrixBlock<BaseType, OverflowType>(rawA + i0 * numInner + k0, rawB + k0 * numCols + j0,
+                                                            acc.data(), numInner, numCols, rows, depth, cols);
+            }
+            for(std::size_t i = 0; i < rows; i++) {
+                for(std::size_t j = 0; j < cols; j++)
+                    out[(i0 + i) * numCols + j0 + j] = FpF<BaseType, OverflowType, numFracBits>::FromRaw(
+                            (BaseType) (acc[i * Sizes::blockCols + j] >> numFracBits));
+            }
+        }
+    }
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FP_MATRIX_H
+
+// EOF
@@ -0,0 +1,281 @@
+///
+/// \file 				FpQ.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-17
+/// \last-modified		2026-10-17
+/// \brief 				Fixed-point numbers whose format is tracked at compile time.
+/// \details
+///		FpQ<numIntBits, numFracBits> is a Qm.n number, where the integer bits include the sign bit (so FpQ<8, 8>
+///		is a 16-bit number with a range of [-128, 128)). Like FpF the format is a template parameter, so
+///		nothing is stored or checked at runtime, but like FpS numbers with different formats can be mixed.
+///		The operators return the format which holds every possible result exactly (e.g. Q8.8 * Q4.12 gives
+///		Q12.20), stored in the smallest integer type it fits in, so they can't overflow. Formats wider than
+///		64 bits are a compile-time error.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPQ_H
+#define MN_MFIXEDPOINT_FPQ_H
+
+// System includes
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+namespace mn {
+namespace MFixedPoint {
+
+template<uint8_t numIntBits, uint8_t numFracBits>
+class FpQ;
+
+namespace detail {
+
+    /// \brief      The smallest signed integer type with at least numBits bits.
+    template<int numBits>
+    struct FpQBaseType {
+        static_assert(numBits <= 64, "FpQ formats can't be wider than 64 bits (including the sign bit).");
+        typedef typename std::conditional<numBits <= 8, int8_t,
+                typename std::conditional<numBits <= 16, int16_t,
+                typename std::conditional<numBits <= 32, int32_t, int64_t>::type>::type>::type type;
+    };
+
+    constexpr int FpQMax(int a, int b) {
+        return a > b ? a : b;
+    }
+
+    /// \brief      Converts a raw value to one with shift more fractional bits (or -shift fewer, truncating
+    ///             towards negative infinity).
+    /// \details    The left shift is done on an unsigned number, as left-shifting a negative number is not
+    ///             allowed in a constant expression.
+    template<class To, class From>
+    constexpr To FpQRescale(From rawVal, int shift) {
+        return shift >= 0 ? (To) ((uint64_t) (int64_t) rawVal << shift) : (To) ((int64_t) rawVal >> -shift);
+    }
+
+    /// \brief      The format of the sum or difference of a Qm.n and a Qp.q number.
+    template<uint8_t m, uint8_t n, uint8_t p, uint8_t q>
+    struct FpQSum {
+        typedef FpQ<FpQMax(m, p) + 1, FpQMax(n, q)> type;
+    };
+
+    /// \brief      The format of the product of a Qm.n and a Qp.q number.
+    template<uint8_t m, uint8_t n, uint8_t p, uint8_t q>
+    struct FpQProduct {
+        typedef FpQ<m + p, n + q> type;
+    };
+
+} // namespace detail
+
+/// \brief		A fixed-point number with numIntBits integer bits (including the sign bit) and numFracBits
+///				fractional bits, stored in the smallest of int8_t, int16_t, int32_t and int64_t that fits.
+/// \details	The results of '+', '-' and '*' have a wider format which holds them exactly. Converting to a
+///				format which can represent every value (at least as many integer and fractional bits) is
+///				implicit, converting to a narrower one must be explicit and truncates/wraps around.
+template<uint8_t numIntBits, uint8_t numFracBits>
+class FpQ {
+
+    static_assert(numIntBits >= 1, "An FpQ must have at least one integer bit (the sign bit).");
+
+public:
+
+    typedef typename detail::FpQBaseType<numIntBits + numFracBits>::type BaseType;
+
+    static constexpr uint8_t intBits = numIntBits;
+    static constexpr uint8_t fracBits = numFracBits;
+
+    //===============================================================================================//
+    //================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+    //===============================================================================================//
+
+    FpQ() = default;
+
+    /// \brief		Creates a fixed-point number directly from a raw value (memory representation).
+    static constexpr FpQ FromRaw(BaseType rawVal) {
+        return FpQ(rawVal, RawTag());
+    }
+
+    constexpr FpQ(int32_t i) :
+            rawVal_(detail::FpQRescale<BaseType>(i, numFracBits)) {}
+
+    constexpr FpQ(float f) :
+            rawVal_((BaseType) (f * (float) ((uint64_t) 1 << numFracBits))) {}
+
+    constexpr FpQ(double f) :
+            rawVal_((BaseType) (f * (double) ((uint64_t) 1 << numFracBits))) {}
+
+    /// \brief		Converts from a format which this one can represent exactly.
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR, typename std::enable_if<
+            (numIntBitsR <= numIntBits && numFracBitsR <= numFracBits), int>::type = 0>
+    constexpr FpQ(FpQ<numIntBitsR, numFracBitsR> r) :
+            rawVal_(detail::FpQRescale<BaseType>(r.GetRawVal(), numFracBits - numFracBitsR)) {}
+
+    /// \brief		Converts from a format which this one can't represent exactly. Extra fractional bits are
+    ///				truncated (towards negative infinity) and extra integer bits wrap around.
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR, typename std::enable_if<
+            !(numIntBitsR <= numIntBits && numFracBitsR <= numFracBits), int>::type = 0>
+    explicit constexpr FpQ(FpQ<numIntBitsR, numFracBitsR> r) :
+            rawVal_(detail::FpQRescale<BaseType>(r.GetRawVal(), numFracBits - numFracBitsR)) {}
+
+    //===============================================================================================//
+    //========================================= GETTERS/SETTERS =====================================//
+    //===============================================================================================//
+
+    constexpr BaseType GetRawVal() const {
+        return rawVal_;
+    }
+
+    //===============================================================================================//
+    //==================================== ARITHMETIC OVERLOADS =====================================//
+    //===============================================================================================//
+
+    /// \brief		Negation, which needs one more integer bit (for the negation of the min. value).
+    constexpr FpQ<numIntBits + 1, numFracBits> operator - () const {
+        return FpQ<numIntBits + 1, numFracBits>::FromRaw(
+                -(typename FpQ<numIntBits + 1, numFracBits>::BaseType) rawVal_);
+    }
+
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr typename detail::FpQSum<numIntBits, numFracBits, numIntBitsR, numFracBitsR>::type operator + (
+            FpQ<numIntBitsR, numFracBitsR> r) const {
+        typedef typename detail::FpQSum<numIntBits, numFracBits, numIntBitsR, numFracBitsR>::type Result;
+        return Result::FromRaw((typename Result::BaseType) (
+                detail::FpQRescale<typename Result::BaseType>(rawVal_, Result::fracBits - numFracBits) +
+                detail::FpQRescale<typename Result::BaseType>(r.GetRawVal(), Result::fracBits - numFracBitsR)));
+    }
+
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr typename detail::FpQSum<numIntBits, numFracBits, numIntBitsR, numFracBitsR>::type operator - (
+            FpQ<numIntBitsR, numFracBitsR> r) const {
+        typedef typename detail::FpQSum<numIntBits, numFracBits, numIntBitsR, numFracBitsR>::type Result;
+        return Result::FromRaw((typename Result::BaseType) (
+                detail::FpQRescale<typename Result::BaseType>(rawVal_, Result::fracBits - numFracBits) -
+                detail::FpQRescale<typename Result::BaseType>(r.GetRawVal(), Result::fracBits - numFracBitsR)));
+    }
+
+    /// \brief		Multiplication, which is exact. The raw values are multiplied in the result's BaseType,
+    ///				with no shift.
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr typename detail::FpQProduct<numIntBits, numFracBits, numIntBitsR, numFracBitsR>::type operator * (
+            FpQ<numIntBitsR, numFracBitsR> r) const {
+        typedef typename detail::FpQProduct<numIntBits, numFracBits, numIntBitsR, numFracBitsR>::type Result;
+        return Result::FromRaw((typename Result::BaseType) (
+                (typename Result::BaseType) rawVal_ * (typename Result::BaseType) r.GetRawVal()));
+    }
+
+    //===============================================================================================//
+    //==================================== COMPARISON OVERLOADS =====================================//
+    //===============================================================================================//
+
+    // Both numbers are converted to the larger number of fractional bits (in an int64_t) first
+
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr bool operator == (FpQ<numIntBitsR, numFracBitsR> r) const {
+        return Compare(r) == 0;
+    }
+
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr bool operator != (FpQ<numIntBitsR, numFracBitsR> r) const {
+        return Compare(r) != 0;
+    }
+
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr bool operator < (FpQ<numIntBitsR, numFracBitsR> r) const {
+        return Compare(r) < 0;
+    }
+
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr bool operator > (FpQ<numIntBitsR, numFracBitsR> r) const {
+        return Compare(r) > 0;
+    }
+
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr bool operator <= (FpQ<numIntBitsR, numFracBitsR> r) const {
+        return Compare(r) <= 0;
+    }
+
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr bool operator >= (FpQ<numIntBitsR, numFracBitsR> r) const {
+        return Compare(r) >= 0;
+    }
+
+    //===============================================================================================//
+    //======================================= CONVERSIONS ===========================================//
+    //===============================================================================================//
+
+    /// \brief		Converts the fixed-point number into an integer, rounding towards negative infinity.
+    template<class IntType>
+    constexpr IntType ToInt() const {
+        return (IntType) (rawVal_ >> numFracBits);
+    }
+
+    constexpr float ToFloat() const {
+        return (float) rawVal_ / (float) ((uint64_t) 1 << numFracBits);
+    }
+
+    constexpr double ToDouble() const {
+        return (double) rawVal_ / (double) ((uint64_t) 1 << numFracBits);
+    }
+
+    explicit constexpr operator float() const {
+        return ToFloat();
+    }
+
+    explicit constexpr operator double() const {
+        return ToDouble();
+    }
+
+    //===============================================================================================//
+    //====================================== STRING/STREAM RELATED ==================================//
+    //===============================================================================================//
+
+    std::string ToString() const {
+        return std::to_string(ToDouble());
+    }
+
+    friend std::ostream &operator<<(std::ostream &stream, FpQ obj) {
+        stream << obj.ToDouble();
+        return stream;
+    }
+
+private:
+
+    /// \brief		Used to select the constructor which takes a raw value.
+    struct RawTag {};
+
+    constexpr FpQ(BaseType rawVal, RawTag) :
+            rawVal_(rawVal) {}
+
+    /// \brief		Returns -1, 0 or 1 if this number is less than, equal to or greater than r.
+    template<uint8_t numIntBitsR, uint8_t numFracBitsR>
+    constexpr int Compare(FpQ<numIntBitsR, numFracBitsR> r) const {
+        static_assert(detail::FpQMax(numIntBits, numIntBitsR) + detail::FpQMax(numFracBits, numFracBitsR) <= 64,
+                      "FpQ numbers can only be compared if they both fit in 64 bits with the same fractional bits.");
+        return Compare(
+                detail::FpQRescale<int64_t>(rawVal_, detail::FpQMax(numFracBits, numFracBitsR) - numFracBits),
+                detail::FpQRescale<int64_t>(r.GetRawVal(), detail::FpQMax(numFracBits, numFracBitsR) - numFracBitsR));
+    }
+
+    static constexpr int Compare(int64_t l, int64_t r) {
+        return l < r ? -1 : (l > r ? 1 : 0);
+    }
+
+    /// \brief		The fixed-point number is stored in this basic data type.
+    BaseType rawVal_;
+
+};
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPQ_H
+
+// EOF
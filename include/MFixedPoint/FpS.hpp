@@ -23,9 +23,62 @@
 #include <stdint.h>
 #include <type_traits>
 
+// User includes
+#include "MFixedPoint/FpChars.hpp"
+#include "MFixedPoint/Int128.hpp"
+
+#ifndef MN_MFIXEDPOINT_FPS_BRANCHLESS
+	/// \brief		Set to 1 to make the FpS arithmetic and comparison operators align the num. of fractional bits
+	///				of their operands without branching. This is faster when the operands' num. of fractional bits
+	///				vary unpredictably (the branches would mispredict), but slightly slower when they are always the
+	///				same. The results are identical.
+	#define MN_MFIXEDPOINT_FPS_BRANCHLESS 0
+#endif
+
 namespace mn {
 namespace MFixedPoint {
 
+namespace detail {
+
+	/// \brief		Shifts whichever of two raw values has the most fractional bits right, so both have the lowest num.
+	///				of fractional bits of the two.
+	/// \returns	The num. of fractional bits of both raw values after alignment.
+	template <bool branchless>
+	struct FpSAlign;
+
+	/// \brief		Branching alignment, optimised for when both numbers have the same num. of fractional bits.
+	template <>
+	struct FpSAlign<false> {
+		template <class BaseType>
+		static uint8_t Align(BaseType& lRawVal, uint8_t lNumFracBits, BaseType& rRawVal, uint8_t rNumFracBits) {
+			if(lNumFracBits == rNumFracBits)
+				return lNumFracBits;
+			if(lNumFracBits > rNumFracBits) {
+				// Second number has smaller num. of frac. bits, so result is in that precision
+				lRawVal = (BaseType)(lRawVal >> (lNumFracBits - rNumFracBits));
+				return rNumFracBits;
+			}
+			// First number has smaller num. of frac. bits, so result is in that precision
+			rRawVal = (BaseType)(rRawVal >> (rNumFracBits - lNumFracBits));
+			return lNumFracBits;
+		}
+	};
+
+	/// \brief		Branchless alignment, both raw values are always shifted (one of them by 0). The min. compiles to a
+	///				conditional move.
+	template <>
+	struct FpSAlign<true> {
+		template <class BaseType>
+		static uint8_t Align(BaseType& lRawVal, uint8_t lNumFracBits, BaseType& rRawVal, uint8_t rNumFracBits) {
+			const uint8_t numFracBits = lNumFracBits < rNumFracBits ? lNumFracBits : rNumFracBits;
+			lRawVal = (BaseType)(lRawVal >> (lNumFracBits - numFracBits));
+			rRawVal = (BaseType)(rRawVal >> (rNumFracBits - numFracBits));
+			return numFracBits;
+		}
+	};
+
+} // namespace detail
+
 /// \brief 		A class which represents a "slow" fixed-point number, where each instance supports an arbitrary number of fractional bits,
 ///				and arithmetic is supported between these instances.
 /// \tparam		BaseType		The underlying data type which will be store the raw fixed point data. It is recommended that
@@ -57,6 +110,12 @@ class FpS {
 		numFracBits_ = numFracBits;
 	}
 
+	/// \brief		Creates a fixed-point number directly from a raw value (memory representation) and a num. of
+	///				fractional bits.
+	static FpS FromRaw(BaseType rawVal, uint8_t numFracBits) {
+		return FpS(rawVal, numFracBits, RawTag());
+	}
+
 	//===============================================================================================//
 	//========================================= GETTERS/SETTERS =====================================//
 	//===============================================================================================//
@@ -77,124 +136,48 @@ class FpS {
 	
 	/// \brief		Overload for '+=' operator.
 	/// \details	Result has the same num. frac bits as the lowest num. frac bits of the two inputs.
-	FpS& operator += (FpS r) { 
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {			
-			rawVal_ = rawVal_ + r.rawVal_;
-			// No need to change num. frac. bits, both are the same
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller num. of frac. bits, so result is in that precision
-			rawVal_ = (rawVal_ >> (numFracBits_ - r.numFracBits_)) + r.rawVal_; 			
-			numFracBits_ = r.numFracBits_;
-		} else { // numFracBits_ < r.numFracBits_
-			// First number has smaller num. of frac. bits, so result is in that precision
-			rawVal_ = rawVal_ + (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-			// No need to change num. frac. bits
-		}
+	FpS& operator += (FpS r) {
+		BaseType rRawVal;
+		numFracBits_ = Align(r, rawVal_, rRawVal);
+		rawVal_ = rawVal_ + rRawVal;
 		return *this;
 	}
-	
+
 	/// \brief		Overload for '-=' operator.
 	/// \details	Result has the same num. frac bits as the lowest num. frac bits of the two inputs.
-	FpS& operator -= (FpS r) { 
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers
-			rawVal_ = rawVal_ - r.rawVal_;
-			// No need to change Q, both are the same
-		}
-		else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			rawVal_ = (rawVal_ >> (numFracBits_ - r.numFracBits_)) - r.rawVal_; 
-			// Change Q
-			numFracBits_ = r.numFracBits_;
-		} else { // numFracBits_ < r.numFracBits_		
-			// First number has smaller Q, so result is in that precision
-			rawVal_ = rawVal_ - (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-			// No need to change Q
-		}
+	FpS& operator -= (FpS r) {
+		BaseType rRawVal;
+		numFracBits_ = Align(r, rawVal_, rRawVal);
+		rawVal_ = rawVal_ - rRawVal;
 		return *this;
 	}
-	
+
 	/// \brief		Overlaod for '*=' operator.
 	/// \details	Uses intermediatary casting to OverflowType to prevent overflows.
 	FpS& operator *= (FpS r) {
-
-		// Optimised for when numFracBits_ is the same for both
-	
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers, shift right by Q
-			rawVal_ = (BaseType)(((OverflowType)rawVal_ * (OverflowType)r.rawVal_) >> numFracBits_);
-		
-			// No need to change Q, both are the same
-		
-		}
-		else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			rawVal_ = (BaseType)((((OverflowType)rawVal_ >> (numFracBits_ - r.numFracBits_)) * (OverflowType)r.rawVal_) >> r.numFracBits_);  
-		
-			// Change Q
-			numFracBits_ = r.numFracBits_;
-		} else { // numFracBits_ < r.numFracBits_	
-			// First number has smaller Q, so result is in that precision
-			rawVal_ = (BaseType)(((OverflowType)rawVal_ * ((OverflowType)r.rawVal_ >> (r.numFracBits_ - numFracBits_))) >> numFracBits_); 
-			// No need to change Q
-		}
+		BaseType rRawVal;
+		numFracBits_ = Align(r, rawVal_, rRawVal);
+		rawVal_ = (BaseType)(((OverflowType)rawVal_ * (OverflowType)rRawVal) >> numFracBits_);
 		return *this;
 	}
-	
+
 	/// \brief		Overlaod for '/=' operator.
 	/// \details	Uses intermediatary casting to OverflowType to prevent overflows.
-	FpS& operator /= (FpS r) { 
-
-		// Optimised for when numFracBits_ is the same for both 
-	
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers, shift right by Q 
-		
-			rawVal_ = (BaseType)((((OverflowType)rawVal_ << numFracBits_) / (OverflowType)r.rawVal_)); 
-		
-			// No need to change Q, both are the same
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			rawVal_ = (BaseType)(((((OverflowType)rawVal_ >> (numFracBits_ - r.numFracBits_)) << r.numFracBits_) / (OverflowType)r.rawVal_));  
-		
-			// Change Q 
-		
-			numFracBits_ = r.numFracBits_;
-		} else { // numFracBits_ < r.numFracBits_		
-			// First number has smaller Q, so result is in that precision
-			rawVal_ = (BaseType)(((OverflowType)rawVal_ << numFracBits_) / ((OverflowType)r.rawVal_ >> (r.numFracBits_ - numFracBits_))); 
-			// No need to change Q
-		}
+	FpS& operator /= (FpS r) {
+		BaseType rRawVal;
+		numFracBits_ = Align(r, rawVal_, rRawVal);
+		rawVal_ = (BaseType)(((OverflowType)rawVal_ << numFracBits_) / (OverflowType)rRawVal);
 		return *this;
 	}
-	
+
 	/// \brief		Overload for '%=' operator.
 	FpS& operator %= (FpS r) {
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers
-			rawVal_ = rawVal_ % r.rawVal_;
-			// No need to change Q, both are the same
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			rawVal_ = (rawVal_ >> (numFracBits_ - r.numFracBits_)) % r.rawVal_; 
-			// Change Q
-			numFracBits_ = r.numFracBits_;
-		} else { // numFracBits_ < r.numFracBits_		
-			// First number has smaller Q, so result is in that precision
-			rawVal_ = rawVal_ % (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-			// No need to change Q
-		}
+		BaseType rRawVal;
+		numFracBits_ = Align(r, rawVal_, rRawVal);
+		rawVal_ = rawVal_ % rRawVal;
 		return *this;
 	}
-	
+
 	//===============================================================================================//
 	//==================================== SIMPLE ARITHMETIC OPERATORS ==============================//
 	//===============================================================================================//	
@@ -245,98 +228,50 @@ class FpS {
 	
 	/// \brief		Overload for the '==' operator.
 	bool operator == (FpS r) const {
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers
-			return rawVal_ == r.rawVal_;
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			return (rawVal_ >> (numFracBits_ - r.numFracBits_)) == r.rawVal_; 
-		} else { // numFracBits_ < r.numFracBits_		
-			// First number has smaller Q, so result is in that precision
-			return rawVal_ == (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-		}
+		BaseType lRawVal;
+		BaseType rRawVal;
+		Align(r, lRawVal, rRawVal);
+		return lRawVal == rRawVal;
 	}
-	
+
 	/// \brief		Overload for the '!=' operator.
 	bool operator != (FpS r) const {
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers
-			return rawVal_ != r.rawVal_;
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			return (rawVal_ >> (numFracBits_ - r.numFracBits_)) != r.rawVal_; 
-		} else { // numFracBits_ < r.numFracBits_		
-			// First number has smaller Q, so result is in that precision
-			return rawVal_ != (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-		}
+		BaseType lRawVal;
+		BaseType rRawVal;
+		Align(r, lRawVal, rRawVal);
+		return lRawVal != rRawVal;
 	}
-	
+
 	/// \brief		Overload for the '<' operator.
 	bool operator < (FpS r) const {
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers
-			return rawVal_ < r.rawVal_;
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			return (rawVal_ >> (numFracBits_ - r.numFracBits_)) < r.rawVal_; 
-		} else { // numFracBits_ < r.numFracBits_		
-			// First number has smaller Q, so result is in that precision
-			return rawVal_ < (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-		}
+		BaseType lRawVal;
+		BaseType rRawVal;
+		Align(r, lRawVal, rRawVal);
+		return lRawVal < rRawVal;
 	}
 
 	/// \brief		Overload for the '>' operator.
 	bool operator > (FpS r) const {
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers
-			return rawVal_ > r.rawVal_;
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			return (rawVal_ >> (numFracBits_ - r.numFracBits_)) > r.rawVal_; 
-		} else { // numFracBits_ < r.numFracBits_		
-			// First number has smaller Q, so result is in that precision
-			return rawVal_ > (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-		}
+		BaseType lRawVal;
+		BaseType rRawVal;
+		Align(r, lRawVal, rRawVal);
+		return lRawVal > rRawVal;
 	}
-	
+
 	/// \brief		Overload for the '<=' operator.
 	bool operator <= (FpS r) const {
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers
-			return rawVal_ <= r.rawVal_;
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			return (rawVal_ >> (numFracBits_ - r.numFracBits_)) <= r.rawVal_; 
-		} else { // numFracBits_ < r.numFracBits_
-			// First number has smaller Q, so result is in that precision
-			return rawVal_ <= (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-		}
+		BaseType lRawVal;
+		BaseType rRawVal;
+		Align(r, lRawVal, rRawVal);
+		return lRawVal <= rRawVal;
 	}
-	
+
 	/// \brief		Overload for the '>=' operator.
 	bool operator >= (FpS r) const {
-		// Optimised for when numFracBits_ is the same for both
-		// operators (first if statement).
-		if(numFracBits_ == r.numFracBits_) {
-			// Q the same for both numbers
-			return rawVal_ >= r.rawVal_;
-		} else if(numFracBits_ > r.numFracBits_) {
-			// Second number has smaller Q, so result is in that precision
-			return (rawVal_ >> (numFracBits_ - r.numFracBits_)) >= r.rawVal_; 
-		} else { // numFracBits_ < r.numFracBits_		
-			// First number has smaller Q, so result is in that precision
-			return rawVal_ >= (r.rawVal_ >> (r.numFracBits_ - numFracBits_)); 
-		}
+		BaseType lRawVal;
+		BaseType rRawVal;
+		Align(r, lRawVal, rRawVal);
+		return lRawVal >= rRawVal;
 	}
 
 	//===============================================================================================//
@@ -391,10 +326,31 @@ class FpS {
     //====================================== STRING/STREAM RELATED ==================================//
     //===============================================================================================//
 
-	/// \brief		Converts the fixed-point number into a string representation, using a fixed-point->double->string
-	/// 				conversion process.
+	/// \brief		Converts the fixed-point number into a string with 6 decimal places (the same as
+	///				std::to_string(ToDouble()), but formatted directly from the raw value).
 	std::string ToString() const {
-		return std::to_string(ToDouble());
+		char buffer[32];
+		return std::string(buffer, ToChars(buffer, buffer + sizeof(buffer), 6).ptr);
+	}
+
+	/// \brief		Writes the number to [first, last) in decimal, without allocating or converting to a double.
+	/// \details	numDigits is the number of decimal places (rounded to nearest, ties to even, like printf()), or
+	///				exactDigits for the exact decimal expansion (at most numFracBits decimal places).
+	ToCharsResult ToChars(char* first, char* last, int numDigits = exactDigits) const {
+		return detail::RawToChars(first, last, rawVal_, (unsigned) numFracBits_, numDigits);
+	}
+
+	/// \brief		Parses a decimal number ([-]digits[.digits]) from [first, last) into value with numFracBits
+	///				fractional bits, rounding to the nearest representable number (ties to even), without going
+	///				through a double.
+	/// \details	Works like std::from_chars(), see FromCharsResult for the errors.
+	static FromCharsResult FromChars(const char* first, const char* last, FpS& value, uint8_t numFracBits) {
+		int64_t rawVal;
+		const FromCharsResult result = detail::CharsToRaw(first, last, (unsigned) numFracBits, sizeof(BaseType) * 8,
+														  rawVal);
+		if(result.ec == std::errc())
+			value = FromRaw((BaseType) rawVal, numFracBits);
+		return result;
 	}
 
     /// \brief      Overload so we can print to a ostream (e.g. std::cout).
@@ -405,6 +361,23 @@ class FpS {
 
 	private:
 
+	struct RawTag {};
+
+	/// \brief		Creates a number from a raw value (which, unlike the integer constructor, is valid for any num. of
+	///				fractional bits).
+	FpS(BaseType rawVal, uint8_t numFracBits, RawTag) :
+			rawVal_(rawVal),
+			numFracBits_(numFracBits) {}
+
+	/// \brief		Gets the raw values of this number and r, both in the lowest num. of fractional bits of the two.
+	/// \details	Branchless if MN_MFIXEDPOINT_FPS_BRANCHLESS is 1.
+	/// \returns	The num. of fractional bits of lRawVal and rRawVal.
+	uint8_t Align(FpS r, BaseType& lRawVal, BaseType& rRawVal) const {
+		lRawVal = rawVal_;
+		rRawVal = r.rawVal_;
+		return detail::FpSAlign<MN_MFIXEDPOINT_FPS_BRANCHLESS != 0>::Align(lRawVal, numFracBits_, rRawVal, r.numFracBits_);
+	}
+
 	/// \brief		The fixed-point number is stored in this basic data type.
 	BaseType rawVal_;			
 	
@@ -421,7 +394,7 @@ class FpS {
 using FpS8 = FpS<int8_t, int16_t>;
 using FpS16 = FpS<int16_t, int32_t>;
 using FpS32 = FpS<int32_t, int64_t>;
-using FpS64 = FpS<int64_t, int64_t>; // Not protected from overflow!
+using FpS64 = FpS<int64_t, Int128>; // Native __int128 where available, otherwise Int128Emulated
 
 } // namespace MFixedPoint
 } // namespace mn
@@ -0,0 +1,84 @@
+///
+/// \file 				FpSMath.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				Math functions for the FpS class.
+/// \details
+///		The algorithms are shared with FpFMath.hpp, only with the num. of fractional bits known at runtime.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPS_MATH_H
+#define MN_MFIXEDPOINT_FPS_MATH_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+
+// User includes
+#include "MFixedPoint/FpFMath.hpp"
+#include "MFixedPoint/FpS.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+//===============================================================================================//
+//========================================== SQUARE ROOTS =======================================//
+//===============================================================================================//
+
+/// \brief		Calculates sqrt(x). The result has the same num. of fractional bits as x.
+/// \details	Exact (rounded down). Returns 0 for negative numbers.
+template<class BaseType, class OverflowType>
+FpS<BaseType, OverflowType> Sqrt(FpS<BaseType, OverflowType> x) {
+	return FpS<BaseType, OverflowType>::FromRaw(
+			detail::SqrtRaw<BaseType, OverflowType>(x.GetRawVal(), x.GetNumFracBits()), x.GetNumFracBits());
+}
+
+/// \brief		Calculates 1/sqrt(x). The result has the same num. of fractional bits as x.
+/// \details	See the FpF version of RSqrt().
+/// \warning	x must be greater than 0.
+template<uint8_t numIterations, class BaseType, class OverflowType>
+FpS<BaseType, OverflowType> RSqrt(FpS<BaseType, OverflowType> x) {
+	return FpS<BaseType, OverflowType>::FromRaw(
+			detail::RSqrtRaw<BaseType, OverflowType, numIterations>(x.GetRawVal(), x.GetNumFracBits()),
+			x.GetNumFracBits());
+}
+
+/// \brief		Calculates 1/sqrt(x), using enough Newton-Raphson iterations for full precision.
+template<class BaseType, class OverflowType>
+FpS<BaseType, OverflowType> RSqrt(FpS<BaseType, OverflowType> x) {
+	return RSqrt<detail::RSqrtIterations<BaseType>::value>(x);
+}
+
+/// \brief		Calculates out[i] = sqrt(a[i]), for i = 0 to count - 1. out may be the same array as a.
+template<class BaseType, class OverflowType>
+void ArraySqrt(const FpS<BaseType, OverflowType>* a, FpS<BaseType, OverflowType>* out, std::size_t count) {
+	for(std::size_t i = 0; i < count; i++) {
+		out[i] = Sqrt(a[i]);
+	}
+}
+
+/// \brief		Calculates out[i] = 1/sqrt(a[i]), for i = 0 to count - 1. out may be the same array as a.
+/// \warning	All elements of a must be greater than 0.
+template<class BaseType, class OverflowType>
+void ArrayRSqrt(const FpS<BaseType, OverflowType>* a, FpS<BaseType, OverflowType>* out, std::size_t count) {
+	for(std::size_t i = 0; i < count; i++) {
+		out[i] = RSqrt(a[i]);
+	}
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPS_MATH_H
+
+// EOF
@@ -0,0 +1,284 @@
+///
+/// \file 				FpSSat.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				Saturating version of the FpS class.
+/// \details
+///		FpSSat behaves like FpS, except that results which do not fit in the BaseType are clamped to the
+///		largest/smallest representable number instead of wrapping around.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPS_SAT_H
+#define MN_MFIXEDPOINT_FPS_SAT_H
+
+// System includes
+#include <limits>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+// User includes
+#include "MFixedPoint/FpFSat.hpp"
+#include "MFixedPoint/FpS.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief		A saturating slow fixed-point number.
+/// \details	Same as FpS, except that addition, subtraction, multiplication, division, negation, shifts and
+///				the constructors clamp results that do not fit in the BaseType to the largest/smallest
+///				representable number, rather than wrapping around. As with FpS, the result of an operation
+///				between two numbers has the lowest num. of fractional bits of the two inputs.
+template <class BaseType, class OverflowType>
+class FpSSat {
+
+	public:
+
+	//===============================================================================================//
+	//================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+	//===============================================================================================//
+
+	/// \brief		Create a fixed-point value from a integer and a num. of fractional bits.
+	FpSSat(int32_t integer, uint8_t numFracBits) :
+			rawVal_(detail::SaturateCast<BaseType>((typename detail::SatWideType<BaseType>::type) integer *
+					((typename detail::SatWideType<BaseType>::type) 1 << numFracBits))),
+			numFracBits_(numFracBits) {}
+
+	/// \brief		Create a fixed-point value from a double and a num. of fractional bits.
+	FpSSat(double dbl, uint8_t numFracBits) :
+			rawVal_(detail::SaturateDoubleToRaw<BaseType>(dbl, numFracBits)),
+			numFracBits_(numFracBits) {}
+
+	/// \brief		Converts a wrapping FpS into a saturating FpSSat (the raw value is unchanged).
+	explicit FpSSat(FpS<BaseType, OverflowType> x) :
+			rawVal_(x.GetRawVal()),
+			numFracBits_(x.GetNumFracBits()) {}
+
+	/// \brief		Creates a fixed-point number directly from a raw value (memory representation) and a num. of
+	///				fractional bits.
+	static FpSSat FromRaw(BaseType rawVal, uint8_t numFracBits) {
+		return FpSSat(rawVal, numFracBits, RawTag());
+	}
+
+	//===============================================================================================//
+	//========================================= GETTERS/SETTERS =====================================//
+	//===============================================================================================//
+
+	/// \brief		Get the raw value (memory representation) of this fixed-point number,
+	BaseType GetRawVal() const {
+		return rawVal_;
+	}
+
+	/// \brief		Returns the number of fractional bits used in this fixed-point number.
+	uint8_t GetNumFracBits() const {
+		return numFracBits_;
+	}
+
+	//===============================================================================================//
+	//================================== COMPOUND ARITHMETIC OPERATORS ==============================//
+	//===============================================================================================//
+
+	/// \brief		Overload for '+=' operator.
+	/// \details	Result has the same num. frac bits as the lowest num. frac bits of the two inputs.
+	FpSSat& operator += (FpSSat r) {
+		BaseType rRawVal = AlignWith(r);
+		rawVal_ = detail::SaturatingAdd(rawVal_, rRawVal);
+		return *this;
+	}
+
+	/// \brief		Overload for '-=' operator.
+	/// \details	Result has the same num. frac bits as the lowest num. frac bits of the two inputs.
+	FpSSat& operator -= (FpSSat r) {
+		BaseType rRawVal = AlignWith(r);
+		rawVal_ = detail::SaturatingSubtract(rawVal_, rRawVal);
+		return *this;
+	}
+
+	/// \brief		Overload for '*=' operator.
+	/// \details	Result has the same num. frac bits as the lowest num. frac bits of the two inputs.
+	FpSSat& operator *= (FpSSat r) {
+		BaseType rRawVal = AlignWith(r);
+		rawVal_ = detail::SaturatingMultiply<BaseType, OverflowType>(rawVal_, rRawVal, numFracBits_);
+		return *this;
+	}
+
+	/// \brief		Overload for '/=' operator. Dividing by zero saturates towards the sign of this number.
+	/// \details	Result has the same num. frac bits as the lowest num. frac bits of the two inputs.
+	FpSSat& operator /= (FpSSat r) {
+		BaseType rRawVal = AlignWith(r);
+		rawVal_ = detail::SaturatingDivide<BaseType, OverflowType>(rawVal_, rRawVal, numFracBits_);
+		return *this;
+	}
+
+	/// \brief		Multiplies by 2^shift.
+	FpSSat& operator <<= (int shift) {
+		rawVal_ = detail::SaturatingShiftLeft<BaseType, OverflowType>(rawVal_, shift);
+		return *this;
+	}
+
+	/// \brief		Divides by 2^shift (rounds towards negative infinity).
+	FpSSat& operator >>= (int shift) {
+		rawVal_ = detail::SaturatingShiftLeft<BaseType, OverflowType>(rawVal_, -shift);
+		return *this;
+	}
+
+	//===============================================================================================//
+	//==================================== SIMPLE ARITHMETIC OPERATORS ==============================//
+	//===============================================================================================//
+
+	/// \brief		Overload for '-itself' operator. The most negative number saturates to the largest one.
+	FpSSat operator - () const {
+		return FromRaw(detail::SaturatingSubtract((BaseType) 0, rawVal_), numFracBits_);
+	}
+
+	FpSSat operator + (FpSSat r) const {
+		FpSSat x = *this;
+		x += r;
+		return x;
+	}
+
+	FpSSat operator - (FpSSat r) const {
+		FpSSat x = *this;
+		x -= r;
+		return x;
+	}
+
+	FpSSat operator * (FpSSat r) const {
+		FpSSat x = *this;
+		x *= r;
+		return x;
+	}
+
+	FpSSat operator / (FpSSat r) const {
+		FpSSat x = *this;
+		x /= r;
+		return x;
+	}
+
+	FpSSat operator << (int shift) const {
+		FpSSat x = *this;
+		x <<= shift;
+		return x;
+	}
+
+	FpSSat operator >> (int shift) const {
+		FpSSat x = *this;
+		x >>= shift;
+		return x;
+	}
+
+	//===============================================================================================//
+	//====================================== COMPARISON OVERLOADS ===================================//
+	//===============================================================================================//
+
+	bool operator == (FpSSat r) const { return Compare(r) == 0; }
+	bool operator != (FpSSat r) const { return Compare(r) != 0; }
+	bool operator < (FpSSat r) const { return Compare(r) < 0; }
+	bool operator > (FpSSat r) const { return Compare(r) > 0; }
+	bool operator <= (FpSSat r) const { return Compare(r) <= 0; }
+	bool operator >= (FpSSat r) const { return Compare(r) >= 0; }
+
+	//===============================================================================================//
+	//======================================= CONVERSION METHODS ====================================//
+	//===============================================================================================//
+
+	/// \brief		Converts the fixed-point number into an integer.
+	/// \details	Always rounds to negative infinity (66.3 becomes 66, -66.3 becomes -67).
+	template <class IntType>
+	IntType ToInt() const {
+		return (IntType)(rawVal_ >> numFracBits_);
+	}
+
+	/// \brief		Converts the fixed-point number to a float.
+	float ToFloat() const {
+		return (float)rawVal_ / (float)((uint64_t)1 << numFracBits_);
+	}
+
+	/// \brief		Converts the fixed-point number to a double.
+	double ToDouble() const {
+		return (double)rawVal_ / (double)((uint64_t)1 << numFracBits_);
+	}
+
+	/// \brief		Converts to the equivalent wrapping FpS (the raw value is unchanged).
+	FpS<BaseType, OverflowType> ToFpS() const {
+		return FpS<BaseType, OverflowType>::FromRaw(rawVal_, numFracBits_);
+	}
+
+	//===============================================================================================//
+	//====================================== STRING/STREAM RELATED ==================================//
+	//===============================================================================================//
+
+	/// \brief		Converts the fixed-point number into a string representation, using a fixed-point->double->string
+	/// 				conversion process.
+	std::string ToString() const {
+		return std::to_string(ToDouble());
+	}
+
+	/// \brief		Overload so we can print to a ostream (e.g. std::cout).
+	friend std::ostream& operator<<(std::ostream& stream, FpSSat obj) {
+		stream << obj.ToDouble();
+		return stream;
+	}
+
+	private:
+
+	struct RawTag {};
+
+	/// \brief		Creates a number from a raw value (which, unlike the integer constructor, is valid for any num. of
+	///				fractional bits).
+	FpSSat(BaseType rawVal, uint8_t numFracBits, RawTag) :
+			rawVal_(rawVal),
+			numFracBits_(numFracBits) {}
+
+	/// \brief		Shifts whichever of this number and r has the most fractional bits so that both have the
+	///				lowest num. of frac. bits of the two.
+	/// \returns	The raw value of r in the new num. of frac. bits (this number is updated in-place).
+	BaseType AlignWith(FpSSat r) {
+		const uint8_t numFracBits = numFracBits_ < r.numFracBits_ ? numFracBits_ : r.numFracBits_;
+		rawVal_ = (BaseType)(rawVal_ >> (numFracBits_ - numFracBits));
+		numFracBits_ = numFracBits;
+		return (BaseType)(r.rawVal_ >> (r.numFracBits_ - numFracBits));
+	}
+
+	/// \brief		Returns a negative number, zero or a positive number if this number is less than, equal to or
+	///				greater than r (compared at the lowest num. of frac. bits of the two).
+	int Compare(FpSSat r) const {
+		FpSSat x = *this;
+		BaseType rRawVal = x.AlignWith(r);
+		return (x.rawVal_ > rRawVal) - (x.rawVal_ < rRawVal);
+	}
+
+	/// \brief		The fixed-point number is stored in this basic data type.
+	BaseType rawVal_;
+
+	/// \brief		This stores the number of fractional bits (specified in the
+	///				constructor).
+	uint8_t numFracBits_;
+
+}; // class FpSSat
+
+//===============================================================================================//
+//========================================= SPECIALIZATIONS =====================================//
+//===============================================================================================//
+
+using FpSSat8 = FpSSat<int8_t, int16_t>;
+using FpSSat16 = FpSSat<int16_t, int32_t>;
+using FpSSat32 = FpSSat<int32_t, int64_t>;
+using FpSSat64 = FpSSat<int64_t, Int128>;
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPS_SAT_H
+
+// EOF
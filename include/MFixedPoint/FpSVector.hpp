@@ -0,0 +1,321 @@
+///
+/// \file 				FpSVector.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				A compact vector of FpS numbers which all have the same num. of fractional bits.
+/// \details
+///		A std::vector<FpS32> uses 8 bytes per element (the int32_t raw value plus the uint8_t num. of
+///		fractional bits, padded). FpSVector stores the num. of fractional bits once and the raw values
+///		contiguously, so it uses sizeof(BaseType) bytes per element and its bulk arithmetic runs as tight
+///		integer loops (the same SIMD kernels as the FpF array functions for FpSVector16/32).
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_FPS_VECTOR_H
+#define MN_MFIXEDPOINT_FPS_VECTOR_H
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+// User includes
+#include "MFixedPoint/FpFArray.hpp"
+#include "MFixedPoint/FpS.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+namespace detail {
+
+	/// \brief		Converts a raw value from one num. of fractional bits to another.
+	/// \details	Rounds towards negative infinity when bits are removed, and wraps around (like the FpS
+	///				operators) if the result does not fit in the BaseType when bits are added.
+	template <class BaseType>
+	BaseType RescaleRaw(BaseType rawVal, uint8_t fromNumFracBits, uint8_t toNumFracBits) {
+		typedef typename std::make_unsigned<BaseType>::type UnsignedType;
+		if(fromNumFracBits >= toNumFracBits)
+			return (BaseType)(rawVal >> (fromNumFracBits - toNumFracBits));
+		return (BaseType)((UnsignedType)rawVal << (toNumFracBits - fromNumFracBits));
+	}
+
+	/// \brief		Element-wise operation on two raw arrays which have different num. of fractional bits.
+	/// \details	a[i] is shifted right by aShift and b[i] by bShift (one of these is 0) so both are in
+	///				numFracBits. The shifts are loop invariant, so the loops can still be vectorized.
+	///				b[0] is used for every element with ArrayOp::Scale.
+	template <class BaseType, class OverflowType>
+	void MixedPrecisionArrayOp(ArrayOp op, const BaseType* a, uint8_t aShift, const BaseType* b, uint8_t bShift,
+							   BaseType* out, std::size_t count, uint8_t numFracBits) {
+		switch(op) {
+			case ArrayOp::Add:
+				for(std::size_t i = 0; i < count; i++)
+					out[i] = (BaseType)((a[i] >> aShift) + (b[i] >> bShift));
+				break;
+			case ArrayOp::Subtract:
+				for(std::size_t i = 0; i < count; i++)
+					out[i] = (BaseType)((a[i] >> aShift) - (b[i] >> bShift));
+				break;
+			case ArrayOp::Multiply:
+				for(std::size_t i = 0; i < count; i++)
+					out[i] = (BaseType)(((OverflowType)(BaseType)(a[i] >> aShift) * (BaseType)(b[i] >> bShift)) >> numFracBits);
+				break;
+			case ArrayOp::Scale: {
+				const OverflowType scale = (BaseType)(b[0] >> bShift);
+				for(std::size_t i = 0; i < count; i++)
+					out[i] = (BaseType)(((OverflowType)(BaseType)(a[i] >> aShift) * scale) >> numFracBits);
+				break;
+			}
+			case ArrayOp::Negate:
+				for(std::size_t i = 0; i < count; i++)
+					out[i] = (BaseType)-(a[i] >> aShift);
+				break;
+		}
+	}
+
+} // namespace detail
+
+/// \brief		A resizable array of FpS numbers which share one num. of fractional bits.
+/// \details	Element access returns a proxy (FpSVector::Reference) which converts to/from FpS. Assigning an FpS
+///				with a different num. of fractional bits to an element converts it to the vector's num. of
+///				fractional bits. As with FpS, the result of an operation between two vectors has the lowest num.
+///				of fractional bits of the two.
+template <class BaseType, class OverflowType>
+class FpSVector {
+
+	public:
+
+	typedef FpS<BaseType, OverflowType> ValueType;
+
+	/// \brief		Proxy for one element of an FpSVector.
+	class Reference {
+
+		public:
+
+		operator ValueType() const {
+			return ValueType::FromRaw(*rawVal_, numFracBits_);
+		}
+
+		/// \brief		Stores x, converted to the vector's num. of fractional bits.
+		Reference& operator = (ValueType x) {
+			*rawVal_ = detail::RescaleRaw(x.GetRawVal(), x.GetNumFracBits(), numFracBits_);
+			return *this;
+		}
+
+		Reference& operator = (const Reference& r) {
+			return *this = (ValueType) r;
+		}
+
+		Reference& operator += (ValueType x) { return *this = (ValueType) *this + x; }
+		Reference& operator -= (ValueType x) { return *this = (ValueType) *this - x; }
+		Reference& operator *= (ValueType x) { return *this = (ValueType) *this * x; }
+		Reference& operator /= (ValueType x) { return *this = (ValueType) *this / x; }
+
+		BaseType GetRawVal() const {
+			return *rawVal_;
+		}
+
+		uint8_t GetNumFracBits() const {
+			return numFracBits_;
+		}
+
+		double ToDouble() const {
+			return ((ValueType) *this).ToDouble();
+		}
+
+		private:
+
+		friend class FpSVector;
+
+		Reference(BaseType* rawVal, uint8_t numFracBits) :
+				rawVal_(rawVal),
+				numFracBits_(numFracBits) {}
+
+		BaseType* rawVal_;
+		uint8_t numFracBits_;
+	};
+
+	//===============================================================================================//
+	//================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+	//===============================================================================================//
+
+	/// \brief		Creates an empty vector whose elements have numFracBits fractional bits.
+	explicit FpSVector(uint8_t numFracBits) :
+			numFracBits_(numFracBits) {}
+
+	/// \brief		Creates a vector of size zeros.
+	FpSVector(std::size_t size, uint8_t numFracBits) :
+			rawVals_(size, 0),
+			numFracBits_(numFracBits) {}
+
+	/// \brief		Creates a vector of size copies of value (with the num. of fractional bits of value).
+	FpSVector(std::size_t size, ValueType value) :
+			rawVals_(size, value.GetRawVal()),
+			numFracBits_(value.GetNumFracBits()) {}
+
+	//===============================================================================================//
+	//========================================= GETTERS/SETTERS =====================================//
+	//===============================================================================================//
+
+	std::size_t size() const { return rawVals_.size(); }
+	bool empty() const { return rawVals_.empty(); }
+	void resize(std::size_t size) { rawVals_.resize(size, 0); }
+	void reserve(std::size_t capacity) { rawVals_.reserve(capacity); }
+	void clear() { rawVals_.clear(); }
+
+	/// \brief		Appends value, converted to the vector's num. of fractional bits.
+	void push_back(ValueType value) {
+		rawVals_.push_back(detail::RescaleRaw(value.GetRawVal(), value.GetNumFracBits(), numFracBits_));
+	}
+
+	Reference operator [] (std::size_t i) {
+		return Reference(&rawVals_[i], numFracBits_);
+	}
+
+	ValueType operator [] (std::size_t i) const {
+		return ValueType::FromRaw(rawVals_[i], numFracBits_);
+	}
+
+	/// \brief		The raw values (memory representation) of the elements.
+	BaseType* data() { return rawVals_.data(); }
+	const BaseType* data() const { return rawVals_.data(); }
+
+	uint8_t GetNumFracBits() const {
+		return numFracBits_;
+	}
+
+	/// \brief		Converts every element to numFracBits fractional bits.
+	void SetNumFracBits(uint8_t numFracBits) {
+		for(std::size_t i = 0; i < rawVals_.size(); i++)
+			rawVals_[i] = detail::RescaleRaw(rawVals_[i], numFracBits_, numFracBits);
+		numFracBits_ = numFracBits;
+	}
+
+	//===============================================================================================//
+	//================================== COMPOUND ARITHMETIC OPERATORS ==============================//
+	//===============================================================================================//
+
+	/// \brief		Element-wise addition. r must have at least as many elements as this vector.
+	/// \details	Result has the lowest num. frac bits of the two vectors.
+	FpSVector& operator += (const FpSVector& r) {
+		return RunOp(detail::ArrayOp::Add, r.data(), r.numFracBits_);
+	}
+
+	/// \brief		Element-wise subtraction. r must have at least as many elements as this vector.
+	/// \details	Result has the lowest num. frac bits of the two vectors.
+	FpSVector& operator -= (const FpSVector& r) {
+		return RunOp(detail::ArrayOp::Subtract, r.data(), r.numFracBits_);
+	}
+
+	/// \brief		Element-wise multiplication. r must have at least as many elements as this vector.
+	/// \details	Result has the lowest num. frac bits of the two vectors.
+	FpSVector& operator *= (const FpSVector& r) {
+		return RunOp(detail::ArrayOp::Multiply, r.data(), r.numFracBits_);
+	}
+
+	/// \brief		Multiplies every element by scale.
+	/// \details	Result has the lowest num. frac bits of the vector and scale.
+	FpSVector& operator *= (ValueType scale) {
+		const BaseType scaleRawVal = scale.GetRawVal();
+		return RunOp(detail::ArrayOp::Scale, &scaleRawVal, scale.GetNumFracBits());
+	}
+
+	/// \brief		Negates every element.
+	void Negate() {
+		RunOp(detail::ArrayOp::Negate, (const BaseType*) nullptr, numFracBits_);
+	}
+
+	//===============================================================================================//
+	//==================================== SIMPLE ARITHMETIC OPERATORS ==============================//
+	//===============================================================================================//
+
+	FpSVector operator + (const FpSVector& r) const {
+		FpSVector x = *this;
+		x += r;
+		return x;
+	}
+
+	FpSVector operator - (const FpSVector& r) const {
+		FpSVector x = *this;
+		x -= r;
+		return x;
+	}
+
+	FpSVector operator * (const FpSVector& r) const {
+		FpSVector x = *this;
+		x *= r;
+		return x;
+	}
+
+	FpSVector operator * (ValueType scale) const {
+		FpSVector x = *this;
+		x *= scale;
+		return x;
+	}
+
+	private:
+
+	/// \brief		Runs an element-wise operation in-place, with r holding raw values with rNumFracBits fractional
+	///				bits.
+	FpSVector& RunOp(detail::ArrayOp op, const BaseType* r, uint8_t rNumFracBits) {
+		if(rNumFracBits == numFracBits_) {
+			// The common case, runs the FpF array kernels (SIMD for 16 and 32-bit numbers)
+			detail::ArrayOpDispatch<BaseType, OverflowType>(op, data(), r, data(), size(), numFracBits_);
+			return *this;
+		}
+		const uint8_t numFracBits = numFracBits_ < rNumFracBits ? numFracBits_ : rNumFracBits;
+		detail::MixedPrecisionArrayOp<BaseType, OverflowType>(op, data(), (uint8_t)(numFracBits_ - numFracBits), r,
+															  (uint8_t)(rNumFracBits - numFracBits), data(), size(),
+															  numFracBits);
+		numFracBits_ = numFracBits;
+		return *this;
+	}
+
+	/// \brief		The raw values of the elements, all with numFracBits_ fractional bits.
+	std::vector<BaseType> rawVals_;
+
+	uint8_t numFracBits_;
+
+}; // class FpSVector
+
+/// \brief		Calculates the dot product sum(a[i]*b[i]) for i = 0 to a.size() - 1.
+/// \details	The raw products are accumulated in OverflowType and only shifted once at the end. The result has
+///				the lowest num. frac bits of the two vectors. b must have at least as many elements as a.
+template <class BaseType, class OverflowType>
+FpS<BaseType, OverflowType> DotProduct(const FpSVector<BaseType, OverflowType>& a,
+									   const FpSVector<BaseType, OverflowType>& b) {
+	const uint8_t numFracBits = a.GetNumFracBits() < b.GetNumFracBits() ? a.GetNumFracBits() : b.GetNumFracBits();
+	// The products have a.GetNumFracBits() + b.GetNumFracBits() fractional bits
+	const uint8_t shift = (uint8_t)(a.GetNumFracBits() + b.GetNumFracBits() - numFracBits);
+	const BaseType* aRaw = a.data();
+	const BaseType* bRaw = b.data();
+	OverflowType result = 0;
+	for(std::size_t i = 0; i < a.size(); i++)
+		result += (OverflowType) aRaw[i] * bRaw[i];
+	return FpS<BaseType, OverflowType>::FromRaw((BaseType)(result >> shift), numFracBits);
+}
+
+//===============================================================================================//
+//========================================= SPECIALIZATIONS =====================================//
+//===============================================================================================//
+
+using FpSVector8 = FpSVector<int8_t, int16_t>;
+using FpSVector16 = FpSVector<int16_t, int32_t>;
+using FpSVector32 = FpSVector<int32_t, int64_t>;
+using FpSVector64 = FpSVector<int64_t, Int128>;
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_FPS_VECTOR_H
+
+// EOF
@@ -0,0 +1,229 @@
+///
+/// \file 				Int128.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				128-bit signed integer used as the OverflowType of the 64-bit fixed-point types.
+/// \details
+///		Int128 is the compiler's native __int128 when it has one (GCC/Clang on 64-bit platforms, where a
+///		64x64->128 multiply is a single instruction), otherwise it is Int128Emulated, a portable
+///		implementation built from two uint64_t's. Define MN_MFIXEDPOINT_NO_NATIVE_INT128 to always use
+///		the emulated version.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_INT128_H
+#define MN_MFIXEDPOINT_INT128_H
+
+// System includes
+#include <stdint.h>
+#include <type_traits>
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      A portable 128-bit two's complement signed integer.
+/// \details    Only supports the operations that the fixed-point classes need from an OverflowType.
+class Int128Emulated {
+
+public:
+
+    //===============================================================================================//
+    //================================== CONSTRUCTORS/DESTRUCTORS ===================================//
+    //===============================================================================================//
+
+    Int128Emulated() = default;
+
+    /// \brief      Sign-extends a 64-bit integer.
+    Int128Emulated(int64_t value) :
+            hi_(value < 0 ? ~(uint64_t) 0 : 0),
+            lo_((uint64_t) value) {}
+
+    /// \brief      Creates a number from it's upper and lower 64 bits.
+    static Int128Emulated FromParts(uint64_t hi, uint64_t lo) {
+        Int128Emulated x;
+        x.hi_ = hi;
+        x.lo_ = lo;
+        return x;
+    }
+
+    //===============================================================================================//
+    //========================================= GETTERS/SETTERS =====================================//
+    //===============================================================================================//
+
+    uint64_t GetHigh() const {
+        return hi_;
+    }
+
+    uint64_t GetLow() const {
+        return lo_;
+    }
+
+    //===============================================================================================//
+    //======================================= ARITHMETIC OPERATORS ==================================//
+    //===============================================================================================//
+
+    Int128Emulated operator + (Int128Emulated r) const {
+        uint64_t lo = lo_ + r.lo_;
+        return FromParts(hi_ + r.hi_ + (lo < lo_ ? 1 : 0), lo);
+    }
+
+    Int128Emulated operator - () const {
+        return FromParts(~hi_ + (lo_ == 0 ? 1 : 0), ~lo_ + 1);
+    }
+
+    Int128Emulated operator - (Int128Emulated r) const {
+        return *this + -r;
+    }
+
+    /// \brief      Returns the lower 128 bits of the product (the same wrap-around behaviour as the
+    ///             native integer types).
+    Int128Emulated operator * (Int128Emulated r) const {
+        Int128Emulated x = MultiplyU64(lo_, r.lo_);
+        x.hi_ += hi_ * r.lo_ + lo_ * r.hi_;
+        return x;
+    }
+
+    /// \brief      Division, truncating towards zero like the native integer types.
+    Int128Emulated operator / (Int128Emulated r) const {
+        // Fast path when both numbers fit in 64 bits, which is the common case
+        if(FitsInInt64() && r.FitsInInt64() && !(lo_ == (uint64_t) INT64_MIN && r.lo_ == ~(uint64_t) 0))
+            return Int128Emulated((int64_t) lo_ / (int64_t) r.lo_);
+        Int128Emulated quotient;
+        Int128Emulated remainder;
+        DivideUnsigned(Abs(), r.Abs(), quotient, remainder);
+        return IsNegative() != r.IsNegative() ? -quotient : quotient;
+    }
+
+    /// \brief      Remainder, has the same sign as the dividend like the native integer types.
+    Int128Emulated operator % (Int128Emulated r) const {
+        if(FitsInInt64() && r.FitsInInt64() && !(lo_ == (uint64_t) INT64_MIN && r.lo_ == ~(uint64_t) 0))
+            return Int128Emulated((int64_t) lo_ % (int64_t) r.lo_);
+        Int128Emulated quotient;
+        Int128Emulated remainder;
+        DivideUnsigned(Abs(), r.Abs(), quotient, remainder);
+        return IsNegative() ? -remainder : remainder;
+    }
+
+    Int128Emulated operator << (int shift) const {
+        if(shift == 0)
+            return *this;
+        if(shift >= 64)
+            return FromParts(lo_ << (shift - 64), 0);
+        return FromParts((hi_ << shift) | (lo_ >> (64 - shift)), lo_ << shift);
+    }
+
+    /// \brief      Arithmetic (sign-extending) right shift, rounds towards negative infinity.
+    Int128Emulated operator >> (int shift) const {
+        const uint64_t signExtension = IsNegative() ? ~(uint64_t) 0 : 0;
+        if(shift == 0)
+            return *this;
+        if(shift >= 64)
+            return FromParts(signExtension, (uint64_t) ((int64_t) hi_ >> (shift - 64)));
+        return FromParts((uint64_t) ((int64_t) hi_ >> shift), (lo_ >> shift) | (hi_ << (64 - shift)));
+    }
+
+    Int128Emulated& operator += (Int128Emulated r) { return *this = *this + r; }
+    Int128Emulated& operator -= (Int128Emulated r) { return *this = *this - r; }
+    Int128Emulated& operator *= (Int128Emulated r) { return *this = *this * r; }
+    Int128Emulated& operator /= (Int128Emulated r) { return *this = *this / r; }
+    Int128Emulated& operator %= (Int128Emulated r) { return *this = *this % r; }
+    Int128Emulated& operator <<= (int shift) { return *this = *this << shift; }
+    Int128Emulated& operator >>= (int shift) { return *this = *this >> shift; }
+
+    //===============================================================================================//
+    //====================================== COMPARISON OPERATORS ===================================//
+    //===============================================================================================//
+
+    bool operator == (Int128Emulated r) const { return hi_ == r.hi_ && lo_ == r.lo_; }
+    bool operator != (Int128Emulated r) const { return !(*this == r); }
+    bool operator < (Int128Emulated r) const {
+        return hi_ == r.hi_ ? lo_ < r.lo_ : (int64_t) hi_ < (int64_t) r.hi_;
+    }
+    bool operator > (Int128Emulated r) const { return r < *this; }
+    bool operator <= (Int128Emulated r) const { return !(r < *this); }
+    bool operator >= (Int128Emulated r) const { return !(*this < r); }
+
+    //===============================================================================================//
+    //======================================= CONVERSION METHODS ====================================//
+    //===============================================================================================//
+
+    /// \brief      Truncates to the lower bits, like a cast between native integer types.
+    template<class IntType, class = typename std::enable_if<std::is_integral<IntType>::value>::type>
+    explicit operator IntType() const {
+        return (IntType) (int64_t) lo_;
+    }
+
+private:
+
+    bool IsNegative() const {
+        return (int64_t) hi_ < 0;
+    }
+
+    bool FitsInInt64() const {
+        return hi_ == (IsNegative() ? ~(uint64_t) 0 : 0) && ((int64_t) lo_ < 0) == IsNegative();
+    }
+
+    Int128Emulated Abs() const {
+        return IsNegative() ? -*this : *this;
+    }
+
+    /// \brief      Full 64x64->128 bit unsigned multiply, built from 32-bit halves.
+    static Int128Emulated MultiplyU64(uint64_t a, uint64_t b) {
+        const uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+        const uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+        const uint64_t loLo = aLo * bLo;
+        const uint64_t hiLo = aHi * bLo;
+        const uint64_t loHi = aLo * bHi;
+        const uint64_t hiHi = aHi * bHi;
+        const uint64_t middle = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+        return FromParts(hiHi + (hiLo >> 32) + (middle >> 32), (middle << 32) | (loLo & 0xFFFFFFFF));
+    }
+
+    /// \brief      Unsigned shift-subtract long division. Both inputs are treated as unsigned.
+    static void DivideUnsigned(Int128Emulated n, Int128Emulated d, Int128Emulated& quotient,
+                               Int128Emulated& remainder) {
+        quotient = Int128Emulated(0);
+        remainder = Int128Emulated(0);
+        for(int bit = 127; bit >= 0; bit--) {
+            remainder = FromParts((remainder.hi_ << 1) | (remainder.lo_ >> 63), remainder.lo_ << 1);
+            remainder.lo_ |= (bit >= 64 ? n.hi_ >> (bit - 64) : n.lo_ >> bit) & 1;
+            const bool remainderGreaterOrEqual = remainder.hi_ != d.hi_ ? remainder.hi_ > d.hi_ : remainder.lo_ >= d.lo_;
+            if(remainderGreaterOrEqual) {
+                remainder = remainder - d;
+                if(bit >= 64)
+                    quotient.hi_ |= (uint64_t) 1 << (bit - 64);
+                else
+                    quotient.lo_ |= (uint64_t) 1 << bit;
+            }
+        }
+    }
+
+    /// \brief      The upper 64 bits (including the sign bit).
+    uint64_t hi_;
+
+    /// \brief      The lower 64 bits.
+    uint64_t lo_;
+};
+
+#if defined(__SIZEOF_INT128__) && !defined(MN_MFIXEDPOINT_NO_NATIVE_INT128)
+    /// \brief      The native 128-bit integer (__extension__ stops -pedantic from complaining about it).
+    __extension__ typedef __int128 Int128;
+#else
+    typedef Int128Emulated Int128;
+#endif
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_INT128_H
+
+// EOF
@@ -0,0 +1,272 @@
+///
+/// \file 				Rounding.hpp
+/// \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+/// \edited 			n/a
+/// \created			2026-10-16
+/// \last-modified		2026-10-16
+/// \brief 				Multiplication, division and precision conversion with a selectable rounding mode.
+/// \details
+///		The operators of FpF and FpS always round by truncating (a right-shift rounds towards negative infinity,
+///		integer division rounds towards zero), which biases long chains of calculations. The functions in here
+///		take the rounding mode as a template parameter.
+///		See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef __cplusplus
+    #error Please build with C++ compiler
+#endif
+
+#ifndef MN_MFIXEDPOINT_ROUNDING_H
+#define MN_MFIXEDPOINT_ROUNDING_H
+
+// System includes
+#include <stdint.h>
+#include <type_traits>
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFMath.hpp"
+#include "MFixedPoint/FpS.hpp"
+
+namespace mn {
+namespace MFixedPoint {
+
+/// \brief      How to round when fractional bits are discarded.
+enum class RoundingMode {
+    Truncate,   ///< The same as the FpF and FpS operators. Right-shifts (e.g. multiplication) round towards
+                ///< negative infinity, division rounds towards zero.
+    HalfUp,     ///< Round to nearest, ties round towards positive infinity.
+    HalfEven,   ///< Round to nearest, ties round to the nearest even number (unbiased).
+    Stochastic, ///< Round up with a probability equal to the discarded fraction (unbiased on average).
+                ///< Uses a per-thread xorshift random number generator.
+};
+
+namespace detail {
+
+    /// \brief      The state of the per-thread xorshift random number generator used for stochastic rounding.
+    inline uint64_t& StochasticRoundingState() {
+        static thread_local uint64_t state = 0x9E3779B97F4A7C15;
+        return state;
+    }
+
+    /// \brief      Returns the next 64-bit random number from the xorshift64 generator.
+    inline uint64_t NextRandom() {
+        uint64_t& x = StochasticRoundingState();
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        return x;
+    }
+
+    /// \brief      Returns the number of bits needed to represent x, where x is non-negative.
+    /// \details    Works for all integer types up to 128 bits (including Int128).
+    template<class IntType>
+    int BitLength(IntType x) {
+        if(sizeof(IntType) > 8) {
+            const uint64_t high = (uint64_t) (x >> (sizeof(IntType) > 8 ? 64 : 0));
+            if(high != 0)
+                return 128 - CountLeadingZeros(high);
+        }
+        return 64 - CountLeadingZeros((uint64_t) x);
+    }
+
+    /// \brief      Calculates x / 2^shift, rounded according to mode.
+    /// \details    shift must be less than 64. Scales up with multiplies, as left shifting a negative number is
+    ///             undefined behaviour.
+    template<RoundingMode mode, class IntType>
+    IntType RoundShiftRight(IntType x, int shift) {
+        if(shift <= 0)
+            return (IntType) (x * ((IntType) 1 << -shift));
+        const IntType quotient = x >> shift;
+        if(mode == RoundingMode::Truncate)
+            return quotient;
+        // The discarded bits, always in [0, 2^shift)
+        const IntType remainder = (IntType) (x - (IntType) (quotient * ((IntType) 1 << shift)));
+        const IntType half = (IntType) 1 << (shift - 1);
+        bool roundUp;
+        if(mode == RoundingMode::HalfUp)
+            roundUp = remainder >= half;
+        else if(mode == RoundingMode::HalfEven)
+            roundUp = (remainder > half) | ((remainder == half) & (bool) ((int64_t) quotient & 1));
+        else
+            roundUp = (uint64_t) remainder > (NextRandom() >> (64 - shift));
+        return (IntType) (quotient + (IntType) (int64_t) roundUp);
+    }
+
+    /// \brief      Calculates numerator / denominator, rounded according to mode.
+    template<RoundingMode mode, class IntType>
+    IntType RoundDivide(IntType numerator, IntType denominator) {
+        IntType quotient = numerator / denominator;
+        if(mode == RoundingMode::Truncate)
+            return quotient;
+        IntType remainder = (IntType) (numerator - (IntType) (quotient * denominator));
+        // Convert to rounding towards negative infinity, so that remainder/denominator is in [0, 1)
+        if(remainder != (IntType) 0 && ((remainder < (IntType) 0) != (denominator < (IntType) 0))) {
+            quotient -= (IntType) 1;
+            remainder += denominator;
+        }
+        IntType absRemainder = remainder < (IntType) 0 ? (IntType) -remainder : remainder;
+        IntType absDenominator = denominator < (IntType) 0 ? (IntType) -denominator : denominator;
+        bool roundUp;
+        if(mode == RoundingMode::HalfUp) {
+            roundUp = (IntType) (absRemainder + absRemainder) >= absDenominator;
+        } else if(mode == RoundingMode::HalfEven) {
+            const IntType twiceRemainder = (IntType) (absRemainder + absRemainder);
+            roundUp = (twiceRemainder > absDenominator) |
+                    ((twiceRemainder == absDenominator) & (bool) ((int64_t) quotient & 1));
+        } else {
+            // Only the top 32 bits of the denominator are needed to pick a random threshold
+            const int shift = BitLength(absDenominator) - 32;
+            if(shift > 0) {
+                absRemainder = absRemainder >> shift;
+                absDenominator = absDenominator >> shift;
+            }
+            const uint64_t threshold = ((NextRandom() >> 32) * (uint64_t) absDenominator) >> 32;
+            roundUp = (uint64_t) absRemainder > threshold;
+        }
+        return (IntType) (quotient + (IntType) (int64_t) roundUp);
+    }
+
+    /// \brief      Gives the template parameters of a FpF type.
+    template<class FpFType>
+    struct FpFTraits;
+
+    template<class BaseTypeT, class OverflowTypeT, uint8_t numFracBitsT>
+    struct FpFTraits<FpF<BaseTypeT, OverflowTypeT, numFracBitsT>> {
+        typedef BaseTypeT BaseType;
+        typedef OverflowTypeT OverflowType;
+        static constexpr uint8_t numFracBits = numFracBitsT;
+    };
+
+    /// \brief      The wider of two integer types.
+    template<class A, class B>
+    struct WiderType {
+        typedef typename std::conditional<(sizeof(A) >= sizeof(B)), A, B>::type type;
+    };
+
+    /// \brief      Gives the template parameters of a FpS type.
+    template<class FpSType>
+    struct FpSTraits;
+
+    template<class BaseTypeT, class OverflowTypeT>
+    struct FpSTraits<FpS<BaseTypeT, OverflowTypeT>> {
+        typedef BaseTypeT BaseType;
+        typedef OverflowTypeT OverflowType;
+    };
+
+} // namespace detail
+
+/// \brief      Seeds the random number generator used by RoundingMode::Stochastic (for the calling thread).
+/// \details    seed must not be 0.
+inline void SetStochasticRoundingSeed(uint64_t seed) {
+    detail::StochasticRoundingState() = seed;
+}
+
+//===============================================================================================//
+//=============================================== FpF ===========================================//
+//===============================================================================================//
+
+/// \brief      Calculates a * b, rounding the discarded fractional bits according to mode.
+template<RoundingMode mode, class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> Multiply(FpF<BaseType, OverflowType, numFracBits> a,
+                                                  FpF<BaseType, OverflowType, numFracBits> b) {
+    return FpF<BaseType, OverflowType, numFracBits>::FromRaw((BaseType) detail::RoundShiftRight<mode>(
+            (OverflowType) ((OverflowType) a.GetRawVal() * (OverflowType) b.GetRawVal()), numFracBits));
+}
+
+/// \brief      Calculates a / b, rounded according to mode.
+template<RoundingMode mode, class BaseType, class OverflowType, uint8_t numFracBits>
+FpF<BaseType, OverflowType, numFracBits> Divide(FpF<BaseType, OverflowType, numFracBits> a,
+                                                FpF<BaseType, OverflowType, numFracBits> b) {
+    return FpF<BaseType, OverflowType, numFracBits>::FromRaw((BaseType) detail::RoundDivide<mode>(
+            (OverflowType) ((OverflowType) a.GetRawVal() * ((OverflowType) 1 << numFracBits)),
+            (OverflowType) b.GetRawVal()));
+}
+
+/// \brief      Converts x to another FpF type (e.g. one with less fractional bits and/or a narrower BaseType),
+///             rounding the discarded fractional bits according to mode.
+/// \details    The rounding is done in the wider of the two OverflowTypes, so widening is exact. The result
+///             wraps-around if the number does not fit in the new BaseType.
+/// \tparam     OutType     The FpF type to convert to, e.g. FpF16<8>.
+template<class OutType, RoundingMode mode = RoundingMode::Truncate, class BaseType, class OverflowType, uint8_t numFracBits>
+OutType ConvertTo(FpF<BaseType, OverflowType, numFracBits> x) {
+    typedef typename detail::FpFTraits<OutType>::BaseType OutBaseType;
+    typedef typename detail::WiderType<OverflowType, typename detail::FpFTraits<OutType>::OverflowType>::type WideType;
+    const int shift = (int) numFracBits - (int) detail::FpFTraits<OutType>::numFracBits;
+    return OutType::FromRaw((OutBaseType) detail::RoundShiftRight<mode>((WideType) x.GetRawVal(), shift));
+}
+
+//===============================================================================================//
+//=============================================== FpS ===========================================//
+//===============================================================================================//
+
+/// \brief      Calculates a * b, rounding the discarded fractional bits according to mode.
+/// \details    The result has the lowest num. of fractional bits of the two inputs. Unlike the '*' operator, when
+///             the num. of fractional bits are different the full product is calculated before rounding, so
+///             only one rounding step occurs.
+template<RoundingMode mode, class BaseType, class OverflowType>
+FpS<BaseType, OverflowType> Multiply(FpS<BaseType, OverflowType> a, FpS<BaseType, OverflowType> b) {
+    const uint8_t numFracBits = a.GetNumFracBits() < b.GetNumFracBits() ? a.GetNumFracBits() : b.GetNumFracBits();
+    const OverflowType product = (OverflowType) ((OverflowType) a.GetRawVal() * (OverflowType) b.GetRawVal());
+    const int shift = a.GetNumFracBits() + b.GetNumFracBits() - numFracBits;
+    return FpS<BaseType, OverflowType>::FromRaw((BaseType) detail::RoundShiftRight<mode>(product, shift), numFracBits);
+}
+
+/// \brief      Calculates a / b, rounded according to mode.
+/// \details    The result has the lowest num. of fractional bits of the two inputs.
+template<RoundingMode mode, class BaseType, class OverflowType>
+FpS<BaseType, OverflowType> Divide(FpS<BaseType, OverflowType> a, FpS<BaseType, OverflowType> b) {
+    const uint8_t numFracBits = a.GetNumFracBits() < b.GetNumFracBits() ? a.GetNumFracBits() : b.GetNumFracBits();
+    // a/b * 2^numFracBits = (a * 2^b.numFracBits) / (b * 2^(a.numFracBits - numFracBits))
+    const OverflowType numerator = (OverflowType) ((OverflowType) a.GetRawVal() *
+                                                   ((OverflowType) 1 << b.GetNumFracBits()));
+    const OverflowType denominator = (OverflowType) ((OverflowType) b.GetRawVal() *
+                                                     ((OverflowType) 1 << (a.GetNumFracBits() - numFracBits)));
+    return FpS<BaseType, OverflowType>::FromRaw((BaseType) detail::RoundDivide<mode>(numerator, denominator), numFracBits);
+}
+
+/// \brief      Calculates a + b, rounding the number with the most fractional bits according to mode when it
+///             is aligned to the other.
+/// \details    The result has the lowest num. of fractional bits of the two inputs.
+template<RoundingMode mode, class BaseType, class OverflowType>
+FpS<BaseType, OverflowType> Add(FpS<BaseType, OverflowType> a, FpS<BaseType, OverflowType> b) {
+    const uint8_t numFracBits = a.GetNumFracBits() < b.GetNumFracBits() ? a.GetNumFracBits() : b.GetNumFracBits();
+    const BaseType aRawVal = detail::RoundShiftRight<mode>(a.GetRawVal(), a.GetNumFracBits() - numFracBits);
+    const BaseType bRawVal = detail::RoundShiftRight<mode>(b.GetRawVal(), b.GetNumFracBits() - numFracBits);
+    return FpS<BaseType, OverflowType>::FromRaw((BaseType) (aRawVal + bRawVal), numFracBits);
+}
+
+/// \brief      Calculates a - b, rounding the number with the most fractional bits according to mode when it
+///             is aligned to the other.
+/// \details    The result has the lowest num. of fractional bits of the two inputs.
+template<RoundingMode mode, class BaseType, class OverflowType>
+FpS<BaseType, OverflowType> Subtract(FpS<BaseType, OverflowType> a, FpS<BaseType, OverflowType> b) {
+    const uint8_t numFracBits = a.GetNumFracBits() < b.GetNumFracBits() ? a.GetNumFracBits() : b.GetNumFracBits();
+    const BaseType aRawVal = detail::RoundShiftRight<mode>(a.GetRawVal(), a.GetNumFracBits() - numFracBits);
+    const BaseType bRawVal = detail::RoundShiftRight<mode>(b.GetRawVal(), b.GetNumFracBits() - numFracBits);
+    return FpS<BaseType, OverflowType>::FromRaw((BaseType) (aRawVal - bRawVal), numFracBits);
+}
+
+/// \brief      Converts x to numFracBits fractional bits (and optionally another FpS type with a narrower
+///             BaseType), rounding the discarded fractional bits according to mode.
+/// \details    The rounding is done in the wider of the two OverflowTypes, so widening is exact. The result
+///             wraps-around if the number does not fit in the new BaseType.
+/// \tparam     OutType     The FpS type to convert to, e.g. FpS16.
+template<class OutType, RoundingMode mode = RoundingMode::Truncate, class BaseType, class OverflowType>
+OutType ConvertTo(FpS<BaseType, OverflowType> x, uint8_t numFracBits) {
+    typedef typename detail::FpSTraits<OutType>::BaseType OutBaseType;
+    typedef typename detail::WiderType<OverflowType, typename detail::FpSTraits<OutType>::OverflowType>::type WideType;
+    const int shift = (int) x.GetNumFracBits() - (int) numFracBits;
+    return OutType::FromRaw((OutBaseType) detail::RoundShiftRight<mode>((WideType) x.GetRawVal(), shift),
+                            numFracBits);
+}
+
+} // namespace MFixedPoint
+} // namespace mn
+
+#endif // #ifndef MN_MFIXEDPOINT_ROUNDING_H
+
+// EOF
@@ -0,0 +1,124 @@
+//!
+//! \file 				BlockFpTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Unit tests for BlockFp.
+//! \details
+//!		See README.rst in root dir for more info.
+
+// System includes
+#include <stdint.h>
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/BlockFp.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	template <class Block>
+	Block BlockFromDoubles(const double* values, uint8_t numFracBits) {
+		std::vector<typename Block::FpSType> fpS;
+		for(std::size_t i = 0; i < Block::blockSize; i++)
+			fpS.push_back(typename Block::FpSType(values[i], numFracBits));
+		return Block::FromFpS(fpS.data());
+	}
+
+} // namespace
+
+MTEST_GROUP(BlockFpTests) {
+
+	MTEST(FpSRoundTripIsExactTest) {
+		std::vector<FpS32> values;
+		for(int i = 0; i < 8; i++)
+			values.push_back(FpS32::FromRaw((i - 4) * 123457, 12));
+		auto block = BlockFp32<8>::FromFpS(values.data());
+		for(int i = 0; i < 8; i++) {
+			CHECK_EQUAL(block.ToDouble(i), values[i].ToDouble());
+			CHECK_EQUAL(block.ToFpS(i).ToDouble(), values[i].ToDouble());
+		}
+	}
+
+	MTEST(FromFpSIsNormalisedTest) {
+		FpS16 values[4] = { FpS16(0.25, 8), FpS16(-0.125, 12), FpS16(0.0, 4), FpS16(0.0625, 10) };
+		auto block = BlockFp16<4>::FromFpS(values);
+		// 0.25 is the largest, so it is shifted up to use all 15 magnitude bits
+		CHECK_EQUAL(block.GetMantissa(0), 1 << 14);
+		CHECK_EQUAL(block.GetExponent(), -16);
+		CHECK_EQUAL(block.ToDouble(1), -0.125);
+		CHECK_EQUAL(block.ToDouble(2), 0.0);
+		CHECK_EQUAL(block.ToDouble(3), 0.0625);
+	}
+
+	MTEST(NormaliseTest) {
+		const int32_t mantissas[4] = { 3, -5, 0, 1 };
+		auto block = BlockFp32<4>::FromRaw(mantissas, 0);
+		block.Normalise();
+		// -5 needs 4 bits (with the sign), leaving 28 bits of headroom
+		CHECK_EQUAL(block.GetExponent(), -28);
+		CHECK_EQUAL(block.GetMantissa(1), -5 * (1 << 28));
+		CHECK_EQUAL(block.ToDouble(0), 3.0);
+
+		const int32_t zeroMantissas[4] = { 0, 0, 0, 0 };
+		auto zeros = BlockFp32<4>::FromRaw(zeroMantissas, 5);
+		zeros.Normalise();
+		CHECK_EQUAL(zeros.GetExponent(), BlockFp32<4>::zeroExponent);
+	}
+
+	MTEST(AddAndSubtractTest) {
+		const double aDbl[4] = { 1.5, -2.25, 1000.0, 0.001 };
+		const double bDbl[4] = { 0.5, 2.25, 1000.0, -100.0 };
+		auto a = BlockFromDoubles<BlockFp32<4>>(aDbl, 16);
+		auto b = BlockFromDoubles<BlockFp32<4>>(bDbl, 16);
+		auto sum = a + b; // 1000 + 1000 overflows the normalised mantissas, so the exponent goes up
+		auto diff = a - b;
+		for(int i = 0; i < 4; i++) {
+			CHECK_CLOSE(sum.ToDouble(i), aDbl[i] + bDbl[i], 0.0001);
+			CHECK_CLOSE(diff.ToDouble(i), aDbl[i] - bDbl[i], 0.0001);
+		}
+		CHECK_EQUAL((a - a).ToDouble(2), 0.0);
+	}
+
+	MTEST(MultiplyTest) {
+		const double aDbl[4] = { 1.5, -2.25, -1.0, 0.001 };
+		const double bDbl[4] = { 0.5, 2.0, -1.0, -100.0 };
+		auto a = BlockFromDoubles<BlockFp32<4>>(aDbl, 20);
+		auto b = BlockFromDoubles<BlockFp32<4>>(bDbl, 20);
+		auto product = a * b;
+		for(int i = 0; i < 4; i++)
+			CHECK_CLOSE(product.ToDouble(i), aDbl[i] * bDbl[i], 0.0001);
+
+		// -1 * -1 with both mantissas at the minimum value
+		const int16_t minMantissas[2] = { INT16_MIN, INT16_MIN };
+		auto minBlock = BlockFp16<2>::FromRaw(minMantissas, -15);
+		CHECK_EQUAL((minBlock * minBlock).ToDouble(0), 1.0);
+	}
+
+	MTEST(MultiplyAccumulateTest) {
+		const double xDbl[4] = { 0.1, 0.2, 0.3, 0.4 };
+		const double hDbl[4] = { 2.0, -1.0, 0.5, 0.25 };
+		auto x = BlockFromDoubles<BlockFp64<4>>(xDbl, 40);
+		auto h = BlockFromDoubles<BlockFp64<4>>(hDbl, 40);
+		BlockFp64<4> acc;
+		for(int n = 0; n < 3; n++)
+			acc.MultiplyAccumulate(x, h);
+		for(int i = 0; i < 4; i++)
+			CHECK_CLOSE(acc.ToDouble(i), 3*xDbl[i]*hDbl[i], 1e-9);
+	}
+
+	MTEST(DynamicRangeTest) {
+		// Much smaller than the LSB of an FpS32 with 16 fractional bits
+		const double tinyDbl[2] = { 1e-9, -3e-9 };
+		FpS64 tinyFpS[2] = { FpS64(tinyDbl[0], 62), FpS64(tinyDbl[1], 62) };
+		auto tiny = BlockFp64<2>::FromFpS(tinyFpS);
+		auto squared = tiny * tiny;
+		CHECK_CLOSE(squared.ToDouble(0) / 1e-18, 1.0, 1e-6);
+		CHECK_CLOSE(squared.ToDouble(1) / 9e-18, 1.0, 1e-6);
+	}
+}
@@ -0,0 +1,153 @@
+//!
+//! \file 				BiquadCascadeTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the biquad cascade.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cmath>
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/BiquadCascade.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Low-pass biquad coefficients (from the Audio EQ Cookbook), b0, b1, b2, a1, a2.
+	void LowPass(double cutoff, double q, double* coefficients) {
+		const double w = 2.0 * M_PI * cutoff;
+		const double alpha = std::sin(w) / (2.0 * q);
+		const double a0 = 1.0 + alpha;
+		coefficients[0] = (1.0 - std::cos(w)) / 2.0 / a0;
+		coefficients[1] = (1.0 - std::cos(w)) / a0;
+		coefficients[2] = (1.0 - std::cos(w)) / 2.0 / a0;
+		coefficients[3] = -2.0 * std::cos(w) / a0;
+		coefficients[4] = (1.0 - alpha) / a0;
+	}
+
+	template<class Cascade>
+	typename Cascade::Coefficients ToCoefficients(const double* c) {
+		typedef typename Cascade::FpFType FpType;
+		typename Cascade::Coefficients coefficients;
+		coefficients.b0 = FpType(c[0]);
+		coefficients.b1 = FpType(c[1]);
+		coefficients.b2 = FpType(c[2]);
+		coefficients.a1 = FpType(c[3]);
+		coefficients.a2 = FpType(c[4]);
+		return coefficients;
+	}
+
+	/// \brief		Returns the mean output of a resonant low-pass filter, long after a step input returns to 0.
+	template<bool errorFeedback>
+	double ZeroInputMean() {
+		typedef BiquadCascade<FpF16<12>, 1, 1, errorFeedback> Cascade;
+		double c[5];
+		LowPass(0.01, 5.0, c);
+		typename Cascade::Coefficients coefficients = ToCoefficients<Cascade>(c);
+		Cascade cascade(&coefficients);
+		double sum = 0.0;
+		for(int n = 0; n < 20000; n++) {
+			FpF16<12> y = cascade.Process(n < 100 ? FpF16<12>(1) : FpF16<12>(0));
+			if(n >= 15000)
+				sum += y.ToDouble();
+		}
+		return sum / 5000;
+	}
+
+}
+
+MTEST_GROUP(BiquadCascadeTests) {
+
+	MTEST(PassThroughTest) {
+		BiquadCascade<FpF32<28>, 3> cascade;
+		CHECK_EQUAL(cascade.Process(FpF32<28>(1.25)), FpF32<28>(1.25));
+		CHECK_EQUAL(cascade.Process(FpF32<28>(-0.5)), FpF32<28>(-0.5));
+		CHECK_EQUAL(cascade.GetCoefficients(2).b0, FpF32<28>(1));
+	}
+
+	MTEST(MatchesDoubleReferenceTest) {
+		typedef BiquadCascade<FpF32<28>, 2> Cascade;
+		double c[2][5];
+		LowPass(0.05, 0.707, c[0]);
+		LowPass(0.1, 1.5, c[1]);
+		Cascade::Coefficients coefficients[2] = { ToCoefficients<Cascade>(c[0]), ToCoefficients<Cascade>(c[1]) };
+		Cascade cascade(coefficients);
+
+		double state[3][2] = { { 0, 0 }, { 0, 0 }, { 0, 0 } };
+		double maxError = 0.0;
+		for(int n = 0; n < 2000; n++) {
+			const double x = 0.5 * std::sin(0.03 * n) + 0.25 * std::sin(0.9 * n);
+			double signal = FpF32<28>(x).ToDouble();
+			const double y = cascade.Process(FpF32<28>(x)).ToDouble();
+			for(int s = 0; s < 2; s++) {
+				const double out = c[s][0] * signal + c[s][1] * state[s][0] + c[s][2] * state[s][1] -
+								   c[s][3] * state[s + 1][0] - c[s][4] * state[s + 1][1];
+				state[s][1] = state[s][0];
+				state[s][0] = signal;
+				signal = out;
+			}
+			state[2][1] = state[2][0];
+			state[2][0] = signal;
+			maxError = std::fmax(maxError, std::fabs(y - signal));
+		}
+		CHECK(maxError < 1e-6);
+	}
+
+	MTEST(ErrorFeedbackRemovesLimitCycleTest) {
+		// Truncation leaves the resonant filter stuck at a DC offset of hundreds of LSBs
+		CHECK(std::fabs(ZeroInputMean<false>()) > 100.0 / 4096);
+		CHECK_EQUAL(ZeroInputMean<true>(), 0.0);
+	}
+
+	MTEST(InterleavedChannelsTest) {
+		// 6 channels, so the SIMD kernel processes 4 and the portable loop the rest
+		typedef BiquadCascade<FpF32<24>, 2, 6, true> Cascade6;
+		typedef BiquadCascade<FpF32<24>, 2, 1, true> Cascade1;
+		double c[5];
+		LowPass(0.07, 2.0, c);
+		Cascade6::Coefficients coefficients6[2] = { ToCoefficients<Cascade6>(c), ToCoefficients<Cascade6>(c) };
+		Cascade1::Coefficients coefficients1[2] = { ToCoefficients<Cascade1>(c), ToCoefficients<Cascade1>(c) };
+
+		const std::size_t numFrames = 100;
+		std::vector<FpF32<24>> in(numFrames * 6), out(numFrames * 6);
+		for(std::size_t i = 0; i < in.size(); i++)
+			in[i] = FpF32<24>(std::sin(0.1 * (double) i) * (double) (i % 6 + 1));
+
+		const SimdIsa isas[] = { SimdIsa::Scalar, SimdIsa::Sse41, SimdIsa::Avx2, SimdIsa::Avx512 };
+		for(SimdIsa isa : isas) {
+			SetSimdIsa(isa);
+			Cascade6 cascade6(coefficients6);
+			std::vector<Cascade1> cascades1(6, Cascade1(coefficients1));
+			cascade6.Process(in.data(), out.data(), numFrames);
+
+			bool passed = true;
+			for(std::size_t n = 0; n < numFrames; n++) {
+				for(std::size_t ch = 0; ch < 6; ch++)
+					passed &= cascades1[ch].Process(in[n*6 + ch]) == out[n*6 + ch];
+			}
+			CHECK(passed);
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+	}
+
+	MTEST(FpF64Test) {
+		typedef BiquadCascade<FpF64<48>, 1, 1, true> Cascade;
+		double c[5];
+		LowPass(0.1, 0.707, c);
+		Cascade::Coefficients coefficients = ToCoefficients<Cascade>(c);
+		Cascade cascade(&coefficients);
+		FpF64<48> y;
+		for(int n = 0; n < 500; n++)
+			y = cascade.Process(FpF64<48>(1));
+		CHECK_CLOSE(y.ToDouble(), 1.0, 1e-9);
+	}
+}
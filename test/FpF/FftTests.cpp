@@ -0,0 +1,211 @@
+//!
+//! \file 				FftTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the FFT functions.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/Fft.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Calculates the DFT of x with doubles, the slow way.
+	void Dft(const std::vector<double>& xRe, const std::vector<double>& xIm, std::vector<double>& re, std::vector<double>& im) {
+		const std::size_t size = xRe.size();
+		re.assign(size, 0.0);
+		im.assign(size, 0.0);
+		for(std::size_t k = 0; k < size; k++) {
+			for(std::size_t n = 0; n < size; n++) {
+				const double angle = -2.0 * M_PI * (double) ((n * k) % size) / (double) size;
+				re[k] += xRe[n] * std::cos(angle) - xIm[n] * std::sin(angle);
+				im[k] += xRe[n] * std::sin(angle) + xIm[n] * std::cos(angle);
+			}
+		}
+	}
+
+	/// \brief		Returns the largest error of the FFT of random FpF numbers compared to a double DFT, relative to
+	///				the largest output.
+	template<std::size_t size, class FpType>
+	double FftRelativeError(double amplitude) {
+		std::vector<FpType> re(size), im(size);
+		std::vector<double> xRe(size), xIm(size);
+		std::srand(size);
+		for(std::size_t n = 0; n < size; n++) {
+			re[n] = FpType(amplitude * ((double) std::rand() / RAND_MAX * 2.0 - 1.0));
+			im[n] = FpType(amplitude * ((double) std::rand() / RAND_MAX * 2.0 - 1.0));
+			xRe[n] = re[n].ToDouble();
+			xIm[n] = im[n].ToDouble();
+		}
+		std::vector<double> expectedRe, expectedIm;
+		Dft(xRe, xIm, expectedRe, expectedIm);
+
+		const int exponent = Fft<size>(re.data(), im.data());
+		double maxError = 0.0, maxValue = 0.0;
+		for(std::size_t k = 0; k < size; k++) {
+			maxError = std::fmax(maxError, std::fabs(std::ldexp(re[k].ToDouble(), exponent) - expectedRe[k]));
+			maxError = std::fmax(maxError, std::fabs(std::ldexp(im[k].ToDouble(), exponent) - expectedIm[k]));
+			maxValue = std::fmax(maxValue, std::fmax(std::fabs(expectedRe[k]), std::fabs(expectedIm[k])));
+		}
+		return maxError / maxValue;
+	}
+
+	/// \brief		Returns true if the FFT of random FpF32 numbers is exactly the same with every SIMD ISA.
+	template<std::size_t size>
+	bool SimdMatchesScalar() {
+		std::vector<FpF32<16>> inRe(size), inIm(size);
+		std::srand(size);
+		for(std::size_t n = 0; n < size; n++) {
+			inRe[n] = FpF32<16>::FromRaw(std::rand() - RAND_MAX / 2);
+			inIm[n] = FpF32<16>::FromRaw(std::rand() / 1024 - RAND_MAX / 2048);
+		}
+		SetSimdIsa(SimdIsa::Scalar);
+		std::vector<FpF32<16>> expectedRe(inRe), expectedIm(inIm);
+		const int expectedExponent = Fft<size>(expectedRe.data(), expectedIm.data());
+
+		bool passed = true;
+		const SimdIsa isas[] = { SimdIsa::Sse41, SimdIsa::Avx2, SimdIsa::Avx512 };
+		for(SimdIsa isa : isas) {
+			SetSimdIsa(isa);
+			std::vector<FpF32<16>> re(inRe), im(inIm);
+			passed &= Fft<size>(re.data(), im.data()) == expectedExponent && re == expectedRe && im == expectedIm;
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+		return passed;
+	}
+
+}
+
+MTEST_GROUP(FftTests) {
+
+	MTEST(ImpulseTest) {
+		std::vector<FpF32<16>> re(16, FpF32<16>(0)), im(16, FpF32<16>(0));
+		re[0] = FpF32<16>(0.5);
+		const int exponent = Fft<16>(re.data(), im.data());
+		CHECK_EQUAL(exponent, 0);
+		bool passed = true;
+		for(std::size_t k = 0; k < 16; k++)
+			passed &= re[k] == FpF32<16>(0.5) && im[k] == FpF32<16>(0);
+		CHECK(passed);
+	}
+
+	MTEST(MatchesDoubleDftTest) {
+		// Odd and even powers of 4, so with and without a radix-2 stage
+		CHECK((FftRelativeError<2, FpF32<24>>(1.0) < 1e-7));
+		CHECK((FftRelativeError<4, FpF32<24>>(1.0) < 1e-7));
+		CHECK((FftRelativeError<8, FpF32<24>>(1.0) < 1e-7));
+		CHECK((FftRelativeError<64, FpF32<24>>(1.0) < 1e-7));
+		CHECK((FftRelativeError<512, FpF32<24>>(1.0) < 1e-7));
+		CHECK((FftRelativeError<256, FpF16<12>>(1.0) < 5e-3));
+		CHECK((FftRelativeError<128, FpF64<40>>(1.0) < 1e-11));
+	}
+
+	MTEST(FullScaleDoesNotOverflowTest) {
+		// The largest possible values, which need a shift in every stage
+		CHECK((FftRelativeError<1024, FpF32<16>>(32767.0) < 5e-7));
+		std::vector<FpF32<16>> re(256, FpF32<16>::FromRaw(INT32_MAX)), im(256, FpF32<16>::FromRaw(INT32_MIN));
+		const int exponent = Fft<256>(re.data(), im.data());
+		CHECK_CLOSE(std::ldexp(re[0].ToDouble(), exponent), 256.0 * 32768.0, 1.0);
+		CHECK_CLOSE(std::ldexp(im[0].ToDouble(), exponent), -256.0 * 32768.0, 1.0);
+		CHECK_CLOSE(std::ldexp(re[1].ToDouble(), exponent), 0.0, 1.0);
+	}
+
+	MTEST(SmallValuesAreNotScaledTest) {
+		// Values with plenty of headroom are transformed without losing any bits
+		std::vector<FpF32<16>> re(64), im(64);
+		for(std::size_t n = 0; n < 64; n++) {
+			re[n] = FpF32<16>((int32_t) (n % 5));
+			im[n] = FpF32<16>(-(int32_t) (n % 3));
+		}
+		CHECK_EQUAL(Fft<64>(re.data(), im.data()), 0);
+		CHECK_EQUAL(re[0], FpF32<16>(126));
+		CHECK_EQUAL(im[0], FpF32<16>(-63));
+	}
+
+	MTEST(SimdMatchesScalarTest) {
+		// Odd and even log2 sizes, so every AVX2 kernel is used
+		CHECK(SimdMatchesScalar<8>());
+		CHECK(SimdMatchesScalar<16>());
+		CHECK(SimdMatchesScalar<32>());
+		CHECK(SimdMatchesScalar<64>());
+		CHECK(SimdMatchesScalar<128>());
+		CHECK(SimdMatchesScalar<256>());
+		CHECK(SimdMatchesScalar<2048>());
+	}
+
+	MTEST(InverseRoundTripTest) {
+		std::vector<FpF32<20>> re(1024), im(1024), original(1024);
+		for(std::size_t n = 0; n < 1024; n++) {
+			re[n] = original[n] = FpF32<20>(std::sin(0.05 * n) + 0.3 * std::cos(0.7 * n));
+			im[n] = FpF32<20>(0);
+		}
+		const int exponent = Fft<1024>(re.data(), im.data());
+		const int inverseExponent = InverseFft<1024>(re.data(), im.data());
+		double maxError = 0.0;
+		for(std::size_t n = 0; n < 1024; n++) {
+			maxError = std::fmax(maxError, std::fabs(std::ldexp(re[n].ToDouble(), exponent + inverseExponent) - original[n].ToDouble()));
+			maxError = std::fmax(maxError, std::fabs(std::ldexp(im[n].ToDouble(), exponent + inverseExponent)));
+		}
+		CHECK(maxError < 1e-4);
+	}
+
+	MTEST(RealFftTest) {
+		std::vector<FpF32<24>> in(256), re(129), im(129), complexRe(256), complexIm(256, FpF32<24>(0));
+		for(std::size_t n = 0; n < 256; n++)
+			in[n] = complexRe[n] = FpF32<24>(0.9 * std::sin(0.3 * n) - 0.5 * std::cos(1.9 * n + 0.2));
+		const int exponent = RealFft<256>(in.data(), re.data(), im.data());
+		const int complexExponent = Fft<256>(complexRe.data(), complexIm.data());
+		double maxError = 0.0;
+		for(std::size_t k = 0; k <= 128; k++) {
+			maxError = std::fmax(maxError, std::fabs(std::ldexp(re[k].ToDouble(), exponent) -
+													 std::ldexp(complexRe[k].ToDouble(), complexExponent)));
+			maxError = std::fmax(maxError, std::fabs(std::ldexp(im[k].ToDouble(), exponent) -
+													 std::ldexp(complexIm[k].ToDouble(), complexExponent)));
+		}
+		CHECK(maxError < 1e-4);
+
+		std::vector<FpF16<8>> in4(4), re4(3), im4(3);
+		in4[0] = FpF16<8>(1); in4[1] = FpF16<8>(2); in4[2] = FpF16<8>(3); in4[3] = FpF16<8>(4);
+		const int exponent4 = RealFft<4>(in4.data(), re4.data(), im4.data());
+		CHECK_EQUAL(std::ldexp(re4[0].ToDouble(), exponent4), 10.0);
+		CHECK_EQUAL(std::ldexp(re4[1].ToDouble(), exponent4), -2.0);
+		CHECK_EQUAL(std::ldexp(im4[1].ToDouble(), exponent4), 2.0);
+		CHECK_EQUAL(std::ldexp(re4[2].ToDouble(), exponent4), -2.0);
+		CHECK_EQUAL(std::ldexp(im4[2].ToDouble(), exponent4), 0.0);
+	}
+
+	MTEST(BlockFpTest) {
+		std::vector<FpS32> reValues, imValues;
+		for(std::size_t n = 0; n < 64; n++) {
+			reValues.push_back(FpS32(std::cos(2.0 * M_PI * 3.0 * n / 64.0), 20));
+			imValues.push_back(FpS32(0.0, 12));
+		}
+		BlockFp32<64> re = BlockFp32<64>::FromFpS(reValues.data());
+		BlockFp32<64> im = BlockFp32<64>::FromFpS(imValues.data());
+		Fft(re, im);
+		// A cosine at bin 3 has peaks of size/2 at bins 3 and 61
+		CHECK_CLOSE(re.ToDouble(3), 32.0, 1e-4);
+		CHECK_CLOSE(re.ToDouble(61), 32.0, 1e-4);
+		CHECK_CLOSE(re.ToDouble(10), 0.0, 1e-4);
+		CHECK_CLOSE(im.ToDouble(3), 0.0, 1e-4);
+
+		InverseFft(re, im);
+		double maxError = 0.0;
+		for(std::size_t n = 0; n < 64; n++)
+			maxError = std::fmax(maxError, std::fabs(re.ToDouble(n) - reValues[n].ToDouble()) + std::fabs(im.ToDouble(n)));
+		CHECK(maxError < 1e-5);
+	}
+}
@@ -0,0 +1,98 @@
+//!
+//! \file 				FirFilterTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the FIR filter.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FirFilter.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Checks the filter against a direct-form MultiplyAccumulate() over the input history, for every
+	///				instruction set supported by the CPU, processing one sample at a time and in blocks.
+	template<class FpType, std::size_t numTaps>
+	bool MatchesDirectForm(double range) {
+		std::vector<FpType> h(numTaps), x(3*numTaps + 5), history(numTaps);
+		for(std::size_t i = 0; i < numTaps; i++)
+			h[i] = FpType((double)((i * 7) % numTaps) / numTaps - 0.5);
+		for(std::size_t i = 0; i < x.size(); i++)
+			x[i] = FpType(range * ((double)((i * 13) % 29) / 29 - 0.5));
+
+		bool passed = true;
+		SimdIsa isas[] = { SimdIsa::Scalar, SimdIsa::Sse41, SimdIsa::Avx2, SimdIsa::Avx512 };
+		for(SimdIsa isa : isas) {
+			SetSimdIsa(isa);
+			FirFilter<FpType, numTaps> filter(h.data());
+			for(std::size_t n = 0; n < x.size(); n++) {
+				// history[k] = x[n - k]
+				for(std::size_t k = 0; k < numTaps; k++)
+					history[k] = n >= k ? x[n - k] : FpType(0);
+				passed &= filter.Process(x[n]) == DotProduct(h.data(), history.data(), numTaps);
+			}
+
+			// In blocks which are not a multiple of the filter's block size
+			std::vector<FpType> blockOut(x.size());
+			FirFilter<FpType, numTaps> blockFilter(h.data());
+			for(std::size_t n = 0; n < x.size(); n += 45) {
+				const std::size_t count = x.size() - n < 45 ? x.size() - n : 45;
+				blockFilter.Process(x.data() + n, blockOut.data() + n, count);
+			}
+			filter.Reset();
+			for(std::size_t n = 0; n < x.size(); n++)
+				passed &= filter.Process(x[n]) == blockOut[n];
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+		return passed;
+	}
+
+}
+
+MTEST_GROUP(FirFilterTests) {
+
+	MTEST(ImpulseResponseTest) {
+		FpF32<16> h[] = { FpF32<16>(0.5), FpF32<16>(-0.25), FpF32<16>(0.125) };
+		FirFilter<FpF32<16>, 3> filter(h);
+		CHECK_EQUAL(filter.Process(FpF32<16>(1)), h[0]);
+		CHECK_EQUAL(filter.Process(FpF32<16>(0)), h[1]);
+		CHECK_EQUAL(filter.Process(FpF32<16>(0)), h[2]);
+		CHECK_EQUAL(filter.Process(FpF32<16>(0)), FpF32<16>(0));
+		CHECK_EQUAL(filter.GetCoefficient(1), h[1]);
+	}
+
+	MTEST(MovingAverageTest) {
+		std::vector<FpF32<16>> h(8, FpF32<16>(0.125));
+		FirFilter<FpF32<16>, 8> filter(h.data());
+		std::vector<FpF32<16>> in(20, FpF32<16>(3.0)), out(20);
+		filter.Process(in.data(), out.data(), in.size());
+		CHECK_CLOSE(out[0].ToDouble(), 0.375, 1e-9);
+		CHECK_CLOSE(out[19].ToDouble(), 3.0, 1e-9);
+		filter.Reset();
+		CHECK_CLOSE(filter.Process(FpF32<16>(1.0)).ToDouble(), 0.125, 1e-9);
+	}
+
+	MTEST(FpF32MatchesDirectFormTest) {
+		CHECK((MatchesDirectForm<FpF32<16>, 16>(100.0)));
+		CHECK((MatchesDirectForm<FpF32<20>, 37>(10.0)));
+	}
+
+	MTEST(FpF16MatchesDirectFormTest) {
+		CHECK((MatchesDirectForm<FpF16<12>, 41>(1.0)));
+	}
+
+	MTEST(FpF64MatchesDirectFormTest) {
+		CHECK((MatchesDirectForm<FpF64<32>, 5>(1000.0)));
+	}
+}
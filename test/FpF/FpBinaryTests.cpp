@@ -0,0 +1,236 @@
+//!
+//! \file 				FpBinaryTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the binary file format for FpF and FpS arrays.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpBinary.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Writes values to a buffer which is aligned for any BaseType.
+	std::vector<uint64_t> Write(const FpF32<16>* values, std::size_t count, std::size_t& size) {
+		size = WriteFpBinary(nullptr, 0, values, count);
+		std::vector<uint64_t> buffer((size + 7) / 8);
+		WriteFpBinary(buffer.data(), size, values, count);
+		return buffer;
+	}
+
+	std::vector<FpF32<16>> RandomFpF(std::size_t count) {
+		std::vector<FpF32<16>> values(count);
+		for(FpF32<16>& x : values)
+			x = FpF32<16>::FromRaw((int32_t) ((uint64_t) std::rand() * 2654435761u));
+		return values;
+	}
+
+}
+
+MTEST_GROUP(FpBinaryTests) {
+
+	MTEST(FpFTest) {
+		std::srand(1);
+		const std::vector<FpF32<16>> values = RandomFpF(1000);
+		std::vector<uint8_t> buffer(64 + 4000);
+		CHECK_EQUAL(WriteFpBinary(nullptr, 0, values.data(), values.size()), 64u + 4000u);
+		// Nothing is written if the buffer is too small
+		CHECK_EQUAL(WriteFpBinary(buffer.data(), buffer.size() - 1, values.data(), values.size()), 64u + 4000u);
+		CHECK_EQUAL(buffer[0], 0);
+		WriteFpBinary(buffer.data(), buffer.size(), values.data(), values.size());
+		CHECK_EQUAL(std::memcmp(buffer.data(), "MFPB", 4), 0);
+		CHECK_EQUAL(buffer[8], 4);
+		CHECK_EQUAL(buffer[9], 16);
+		CHECK_EQUAL(std::memcmp(buffer.data() + 64, values.data(), 4000), 0);
+
+		// In place
+		std::vector<uint64_t> aligned((buffer.size() + 7) / 8);
+		std::memcpy(aligned.data(), buffer.data(), buffer.size());
+		FpFSpan<FpF32<16>> span;
+		CHECK((ViewFpBinary(aligned.data(), buffer.size(), span) == FpBinaryError::None));
+		CHECK_EQUAL(span.size(), values.size());
+		CHECK_EQUAL((const void*) span.data(), (const void*) ((const uint8_t*) aligned.data() + 64));
+		bool passed = true;
+		for(std::size_t i = 0; i < values.size(); i++)
+			passed &= span[i] == values[i];
+		CHECK(passed);
+
+		// Copied
+		std::vector<FpF32<16>> read;
+		CHECK((ReadFpBinary(buffer.data(), buffer.size(), read) == FpBinaryError::None));
+		CHECK((read == values));
+
+		// Empty
+		std::size_t size;
+		const std::vector<uint64_t> empty = Write(values.data(), 0, size);
+		CHECK_EQUAL(size, 64u);
+		CHECK((ViewFpBinary(empty.data(), size, span) == FpBinaryError::None));
+		CHECK(span.empty());
+	}
+
+	MTEST(FpSTest) {
+		// Each block has the lowest num. of fractional bits in it
+		const FpS32 values[] = { FpS32(1.5, 8), FpS32(-2.25, 4), FpS32(0.125, 12), FpS32(3, 0), FpS32(-0.75, 10),
+								 FpS32(0.0625, 16), FpS32(7.5, 20) };
+		std::size_t size = WriteFpBinary(nullptr, 0, values, 7, 3);
+		CHECK_EQUAL(size, 64u + 28u);
+		std::vector<uint64_t> buffer(size / 8 + 1);
+		WriteFpBinary(buffer.data(), size, values, 7, 3);
+		FpSBlockSpan<int32_t, int64_t> span;
+		CHECK((ViewFpBinary(buffer.data(), size, span) == FpBinaryError::None));
+		CHECK_EQUAL(span.size(), 7u);
+		CHECK_EQUAL(span.GetBlockSize(), 3u);
+		CHECK_EQUAL(span.GetNumBlocks(), 3u);
+		CHECK_EQUAL(span.GetNumFracBits(0), 4);
+		CHECK_EQUAL(span.GetNumFracBits(1), 0);
+		CHECK_EQUAL(span.GetNumFracBits(2), 20);
+		CHECK_EQUAL(span[0].GetRawVal(), 24);
+		CHECK_EQUAL(span[0].GetNumFracBits(), 4);
+		CHECK_EQUAL(span[1].ToDouble(), -2.25);
+		CHECK_EQUAL(span[2].ToDouble(), 0.125);
+		CHECK_EQUAL(span[3].ToDouble(), 3.0);
+		// Rounded towards negative infinity
+		CHECK_EQUAL(span[4].ToDouble(), -1.0);
+		CHECK_EQUAL(span[5].ToDouble(), 0.0);
+		CHECK_EQUAL(span[6].ToDouble(), 7.5);
+		CHECK_EQUAL(span[6].GetNumFracBits(), 20);
+
+		std::vector<FpS32> read;
+		CHECK((ReadFpBinary(buffer.data(), size, read) == FpBinaryError::None));
+		CHECK_EQUAL(read.size(), 7u);
+		for(std::size_t i = 0; i < read.size(); i++) {
+			CHECK_EQUAL(read[i].GetRawVal(), span[i].GetRawVal());
+			CHECK_EQUAL(read[i].GetNumFracBits(), span[i].GetNumFracBits());
+		}
+
+		// A FpSVector is stored without any loss
+		FpSVector32 vector(600, 12);
+		for(std::size_t i = 0; i < vector.size(); i++)
+			vector[i] = FpS32((double) i / 8.0 - 30.0, 12);
+		size = WriteFpBinary(nullptr, 0, vector);
+		CHECK_EQUAL(size, 64u + 2400u);
+		std::vector<uint64_t> vectorBuffer(size / 8);
+		WriteFpBinary(vectorBuffer.data(), size, vector);
+		CHECK((ViewFpBinary(vectorBuffer.data(), size, span) == FpBinaryError::None));
+		CHECK_EQUAL(span.GetNumBlocks(), 3u);
+		CHECK_EQUAL(std::memcmp(span.data(), vector.data(), 2400), 0);
+		CHECK_EQUAL(span[599].GetNumFracBits(), 12);
+	}
+
+	MTEST(ErrorsTest) {
+		std::srand(2);
+		const std::vector<FpF32<16>> values = RandomFpF(10);
+		std::size_t size;
+		std::vector<uint64_t> buffer = Write(values.data(), values.size(), size);
+		uint8_t* const bytes = (uint8_t*) buffer.data();
+		FpFSpan<FpF32<16>> span;
+		std::vector<FpF32<16>> read;
+
+		CHECK((ViewFpBinary(bytes, 31, span) == FpBinaryError::Truncated));
+		CHECK((ViewFpBinary(bytes, size - 1, span) == FpBinaryError::Truncated));
+		CHECK((ReadFpBinary(bytes, size - 1, read) == FpBinaryError::Truncated));
+		FpFSpan<FpF32<15>> wrongNumFracBits;
+		CHECK((ViewFpBinary(bytes, size, wrongNumFracBits) == FpBinaryError::TypeMismatch));
+		FpFSpan<FpF16<16>> wrongBaseType;
+		CHECK((ViewFpBinary(bytes, size, wrongBaseType) == FpBinaryError::TypeMismatch));
+		FpSBlockSpan<int32_t, int64_t> wrongKind;
+		CHECK((ViewFpBinary(bytes, size, wrongKind) == FpBinaryError::TypeMismatch));
+
+		// A corrupt count can't make the raw values go past the end
+		bytes[23] = 0x80;
+		CHECK((ViewFpBinary(bytes, size, span) == FpBinaryError::Truncated));
+		bytes[23] = 0;
+		bytes[4] = 2;
+		CHECK((ViewFpBinary(bytes, size, span) == FpBinaryError::UnsupportedVersion));
+		bytes[4] = 1;
+		bytes[0] = 'X';
+		CHECK((ViewFpBinary(bytes, size, span) == FpBinaryError::BadMagic));
+		bytes[0] = 'M';
+		CHECK(span.empty());
+
+		// Misaligned data can only be copied
+		std::vector<uint8_t> shifted(size + 1);
+		std::memcpy(shifted.data() + 1, bytes, size);
+		CHECK((ViewFpBinary(shifted.data() + 1, size, span) == FpBinaryError::Misaligned));
+		CHECK((ReadFpBinary(shifted.data() + 1, size, read) == FpBinaryError::None));
+		CHECK((read == values));
+
+		// So can data in the other byte order, which is byte swapped
+		bytes[7] = !bytes[7];
+		for(std::size_t i = 0; i < values.size(); i++)
+			std::reverse(bytes + 64 + 4 * i, bytes + 64 + 4 * i + 4);
+		CHECK((ViewFpBinary(bytes, size, span) == FpBinaryError::ForeignEndianness));
+		read.clear();
+		CHECK((ReadFpBinary(bytes, size, read) == FpBinaryError::None));
+		CHECK((read == values));
+
+		// Blocks with as many fractional bits as BaseType has bits are rejected
+		const FpS32 fpsValues[] = { FpS32(1.5, 8), FpS32(-2.25, 4), FpS32(0.125, 12) };
+		size = WriteFpBinary(nullptr, 0, fpsValues, 3, 2);
+		std::vector<uint64_t> fpsBuffer((size + 7) / 8);
+		uint8_t* const fpsBytes = (uint8_t*) fpsBuffer.data();
+		WriteFpBinary(fpsBytes, size, fpsValues, 3, 2);
+		FpSBlockSpan<int32_t, int64_t> fpsSpan;
+		std::vector<FpS32> fpsRead;
+		fpsBytes[33] = 32;
+		CHECK((ViewFpBinary(fpsBytes, size, fpsSpan) == FpBinaryError::Corrupt));
+		fpsBytes[33] = 200;
+		CHECK((ReadFpBinary(fpsBytes, size, fpsRead) == FpBinaryError::Corrupt));
+		fpsBytes[33] = 31;
+		CHECK((ViewFpBinary(fpsBytes, size, fpsSpan) == FpBinaryError::None));
+		CHECK_EQUAL(fpsSpan[2].GetNumFracBits(), 31);
+		fpsBytes[12] = 0;
+		CHECK((ReadFpBinary(fpsBytes, size, fpsRead) == FpBinaryError::Corrupt));
+		CHECK(fpsRead.empty());
+
+		// Block sizes which can't be read back aren't written
+		CHECK_EQUAL(WriteFpBinary(fpsBytes, size, fpsValues, 3, 0), 0u);
+		CHECK((SaveFpBinary("FpBinaryTests.bin", fpsValues, 3, 0) == FpBinaryError::InvalidBlockSize));
+		if(sizeof(std::size_t) > 4)
+			CHECK_EQUAL(WriteFpBinary(nullptr, 0, fpsValues, 3, (std::size_t) UINT32_MAX + 1), 0u);
+	}
+
+	MTEST(FileTest) {
+		std::srand(3);
+		const std::vector<FpF32<16>> values = RandomFpF(5000);
+		const char* const path = "FpBinaryTests.bin";
+		CHECK((SaveFpBinary(path, values.data(), values.size()) == FpBinaryError::None));
+		{
+			MappedFile file;
+			CHECK((file.Open(path) == FpBinaryError::None));
+			CHECK_EQUAL(file.size(), 64u + 20000u);
+			FpFSpan<FpF32<16>> span;
+			CHECK((ViewFpBinary(file.data(), file.size(), span) == FpBinaryError::None));
+			CHECK(std::equal(span.begin(), span.end(), values.begin()));
+		}
+
+		const FpS16 fpsValues[] = { FpS16(1.5, 4), FpS16(-3.0, 2) };
+		CHECK((SaveFpBinary(path, fpsValues, 2) == FpBinaryError::None));
+		MappedFile file;
+		CHECK((file.Open(path) == FpBinaryError::None));
+		FpSBlockSpan<int16_t, int32_t> span;
+		CHECK((ViewFpBinary(file.data(), file.size(), span) == FpBinaryError::None));
+		CHECK_EQUAL(span[0].ToDouble(), 1.5);
+		CHECK_EQUAL(span[1].ToDouble(), -3.0);
+		file.Close();
+		std::remove(path);
+
+		CHECK((file.Open("FpBinaryTestsMissing.bin") == FpBinaryError::IoError));
+		CHECK((SaveFpBinary("no/such/dir/FpBinaryTests.bin", values.data(), 1) == FpBinaryError::IoError));
+	}
+}
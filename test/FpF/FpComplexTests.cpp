@@ -0,0 +1,147 @@
+//!
+//! \file 				FpComplexTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the FpComplex class and complex array functions.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpComplex.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	template<class BaseType>
+	BaseType RandomRaw() {
+		return (BaseType) ((uint64_t) std::rand() * 2654435761u);
+	}
+
+	/// \brief		Returns true if the complex array functions give the same results as the FpComplex methods,
+	///				for every SIMD ISA.
+	template<class FpFType>
+	bool ArraysMatchMethods(std::size_t count) {
+		typedef FpComplex<FpFType> Complex;
+		typedef decltype(FpFType().GetRawVal()) BaseType;
+		std::vector<Complex> a(count), b(count), out(count);
+		std::vector<FpFType> magnitudes(count);
+		std::srand(count);
+		for(std::size_t i = 0; i < count; i++) {
+			// Random raw values over the whole range, except that Conj() can't negate b's min. value
+			const BaseType bIm = RandomRaw<BaseType>();
+			a[i] = Complex(FpFType::FromRaw(RandomRaw<BaseType>()), FpFType::FromRaw(RandomRaw<BaseType>()));
+			b[i] = Complex(FpFType::FromRaw(RandomRaw<BaseType>()),
+						   FpFType::FromRaw(bIm == std::numeric_limits<BaseType>::min() ? 0 : bIm));
+		}
+
+		bool passed = true;
+		const SimdIsa isas[] = { SimdIsa::Scalar, SimdIsa::Sse41, SimdIsa::Avx2, SimdIsa::Avx512 };
+		for(SimdIsa isa : isas) {
+			SetSimdIsa(isa);
+			ArrayComplexMultiply(a.data(), b.data(), out.data(), count);
+			for(std::size_t i = 0; i < count; i++)
+				passed &= out[i] == a[i] * b[i];
+			ArrayComplexMultiplyConj(a.data(), b.data(), out.data(), count);
+			for(std::size_t i = 0; i < count; i++)
+				passed &= out[i] == a[i] * b[i].Conj();
+			ArrayMagnitudeSquared(a.data(), magnitudes.data(), count);
+			for(std::size_t i = 0; i < count; i++)
+				passed &= magnitudes[i] == a[i].MagnitudeSquared();
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+		return passed;
+	}
+
+}
+
+MTEST_GROUP(FpComplexTests) {
+
+	MTEST(ArithmeticTest) {
+		FpComplex<FpF32<16>> a(FpF32<16>(1.5), FpF32<16>(-2.0));
+		FpComplex<FpF32<16>> b(FpF32<16>(0.5), FpF32<16>(4.0));
+		CHECK_EQUAL((a + b).GetReal(), FpF32<16>(2.0));
+		CHECK_EQUAL((a + b).GetImag(), FpF32<16>(2.0));
+		CHECK_EQUAL((a - b).GetImag(), FpF32<16>(-6.0));
+		CHECK((-a == FpComplex<FpF32<16>>(FpF32<16>(-1.5), FpF32<16>(2.0))));
+		CHECK((a.Conj() == FpComplex<FpF32<16>>(FpF32<16>(1.5), FpF32<16>(2.0))));
+		// (1.5 - 2i)(0.5 + 4i) = 0.75 + 8 + (6 - 1)i
+		CHECK((a * b == FpComplex<FpF32<16>>(FpF32<16>(8.75), FpF32<16>(5.0))));
+		CHECK((a * FpF32<16>(2.0) == FpComplex<FpF32<16>>(FpF32<16>(3.0), FpF32<16>(-4.0))));
+		CHECK_EQUAL(a.MagnitudeSquared(), FpF32<16>(6.25));
+
+		a *= b;
+		CHECK_EQUAL(a.GetReal(), FpF32<16>(8.75));
+		a -= b;
+		a += FpComplex<FpF32<16>>(FpF32<16>(1.0));
+		CHECK((a == FpComplex<FpF32<16>>(FpF32<16>(9.25), FpF32<16>(1.0))));
+	}
+
+	MTEST(MultiplyShiftsOnceTest) {
+		// Shifting each product of the imaginary part separately would truncate twice: (-1 LSB) + 0 instead of 0
+		typedef FpF16<15> Q15;
+		FpComplex<Q15> a(Q15::FromRaw(1), Q15::FromRaw(1));
+		FpComplex<Q15> b(Q15::FromRaw(16384), Q15::FromRaw(-16384));
+		const FpComplex<Q15> product = a * b;
+		CHECK_EQUAL(product.GetReal().GetRawVal(), 1);
+		CHECK_EQUAL(product.GetImag().GetRawVal(), 0);
+		CHECK_EQUAL((a.GetReal() * b.GetImag() + a.GetImag() * b.GetReal()).GetRawVal(), -1);
+	}
+
+	MTEST(ConstexprTest) {
+		constexpr FpComplex<FpF32<16>> a(FpF32<16>(2.0), FpF32<16>(3.0));
+		constexpr FpComplex<FpF32<16>> product = a * a.Conj();
+		static_assert(product.GetReal().GetRawVal() == 13 << 16, "product should be calculated at compile time");
+		CHECK_EQUAL(product.GetImag(), FpF32<16>(0));
+	}
+
+	MTEST(MultiplyGaussTest) {
+		std::srand(1);
+		bool passed = true;
+		for(int i = 0; i < 1000; i++) {
+			// Components less than half the max. value, so the sums cannot overflow
+			FpComplex<FpF32<20>> a(FpF32<20>::FromRaw(std::rand() / 2 - RAND_MAX / 4), FpF32<20>::FromRaw(std::rand() / 2));
+			FpComplex<FpF32<20>> b(FpF32<20>::FromRaw(-std::rand() / 2), FpF32<20>::FromRaw(std::rand() / 2 - RAND_MAX / 4));
+			passed &= MultiplyGauss(a, b) == a * b;
+			FpComplex<FpF64<40>> c(FpF64<40>(1.25), FpF64<40>(-3.5)), d(FpF64<40>(-0.75), FpF64<40>(2.0));
+			passed &= MultiplyGauss(c, d) == c * d;
+		}
+		CHECK(passed);
+	}
+
+	MTEST(ArraysMatchMethodsTest) {
+		// Counts which aren't multiples of the SIMD widths, so the scalar tails are used too
+		CHECK(ArraysMatchMethods<FpF16<15>>(1003));
+		CHECK(ArraysMatchMethods<FpF16<8>>(37));
+		CHECK(ArraysMatchMethods<FpF32<16>>(1003));
+		CHECK(ArraysMatchMethods<FpF32<31>>(6));
+		CHECK(ArraysMatchMethods<FpF64<32>>(10));
+	}
+
+	MTEST(MultiplyConjMinValueTest) {
+		// Conj() of the min. value wraps around, but ArrayComplexMultiplyConj() doesn't negate anything
+		typedef FpF16<15> Q15;
+		FpComplex<Q15> a(Q15::FromRaw(0), Q15::FromRaw(16384));
+		FpComplex<Q15> b(Q15::FromRaw(0), Q15::FromRaw(INT16_MIN));
+		std::vector<FpComplex<Q15>> as(16, a), bs(16, b), out(16);
+		const SimdIsa isas[] = { SimdIsa::Scalar, SimdIsa::Avx2 };
+		for(SimdIsa isa : isas) {
+			SetSimdIsa(isa);
+			ArrayComplexMultiplyConj(as.data(), bs.data(), out.data(), 16);
+			// 0.5i * conj(-i) = 0.5i * i = -0.5
+			CHECK_EQUAL(out[15].GetReal().GetRawVal(), -16384);
+			CHECK_EQUAL(out[15].GetImag().GetRawVal(), 0);
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+	}
+}
@@ -0,0 +1,83 @@
+//!
+//! \file 				FpFArrayTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the element-wise FpF array functions.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpFArray.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Checks every array function against the equivalent FpF operator, for every instruction set
+	///				supported by the CPU. 37 elements makes sure the scalar tail is exercised.
+	template<class FpType>
+	bool ArrayFunctionsMatchOperators(double range) {
+		const std::size_t count = 37;
+		std::vector<FpType> a(count), b(count), out(count);
+		for(std::size_t i = 0; i < count; i++) {
+			a[i] = FpType(range * ((double)((i * 7) % count) / count - 0.5));
+			b[i] = FpType(range * ((double)((i * 13) % count) / count - 0.5));
+		}
+		FpType scale(-0.75);
+
+		bool passed = true;
+		SimdIsa isas[] = { SimdIsa::Scalar, SimdIsa::Sse41, SimdIsa::Avx2, SimdIsa::Avx512 };
+		for(SimdIsa isa : isas) {
+			SetSimdIsa(isa);
+			ArrayAdd(a.data(), b.data(), out.data(), count);
+			for(std::size_t i = 0; i < count; i++) passed &= out[i] == a[i] + b[i];
+			ArraySubtract(a.data(), b.data(), out.data(), count);
+			for(std::size_t i = 0; i < count; i++) passed &= out[i] == a[i] - b[i];
+			ArrayMultiply(a.data(), b.data(), out.data(), count);
+			for(std::size_t i = 0; i < count; i++) passed &= out[i] == a[i] * b[i];
+			ArrayScale(a.data(), scale, out.data(), count);
+			for(std::size_t i = 0; i < count; i++) passed &= out[i] == a[i] * scale;
+			ArrayNegate(a.data(), out.data(), count);
+			for(std::size_t i = 0; i < count; i++) passed &= out[i] == -a[i];
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+		return passed;
+	}
+
+}
+
+MTEST_GROUP(FpFArrayTests) {
+
+	MTEST(FpF32) {
+		CHECK(ArrayFunctionsMatchOperators<FpF32<16>>(200.0));
+		CHECK(ArrayFunctionsMatchOperators<FpF32<0>>(1000.0));
+		CHECK(ArrayFunctionsMatchOperators<FpF32<30>>(1.9));
+	}
+
+	MTEST(FpF16) {
+		CHECK(ArrayFunctionsMatchOperators<FpF16<8>>(100.0));
+		CHECK(ArrayFunctionsMatchOperators<FpF16<0>>(100.0));
+		CHECK(ArrayFunctionsMatchOperators<FpF16<15>>(1.9));
+	}
+
+	MTEST(ScalarOnlyTypes) {
+		CHECK(ArrayFunctionsMatchOperators<FpF8<4>>(6.0));
+		CHECK(ArrayFunctionsMatchOperators<FpF64<24>>(1000.0));
+	}
+
+	MTEST(InPlace) {
+		FpF32<16> a[] = { FpF32<16>(1.0), FpF32<16>(2.0), FpF32<16>(-3.0) };
+		ArrayScale(a, FpF32<16>(0.5), a, 3);
+		CHECK_CLOSE(a[0].ToDouble(), 0.5, 1e-9);
+		CHECK_CLOSE(a[1].ToDouble(), 1.0, 1e-9);
+		CHECK_CLOSE(a[2].ToDouble(), -1.5, 1e-9);
+	}
+}
@@ -0,0 +1,63 @@
+//!
+//! \file 				FpFBatchOperations.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the FpF batch (array) operations.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpFBatchOperations) {
+
+	MTEST(FromRaw) {
+		auto fp1 = FpF32<8>::FromRaw(3 << 8);
+		CHECK_EQUAL(fp1.GetRawVal(), 3 << 8);
+		CHECK_CLOSE(fp1.ToDouble(), 3.0, 1e-9);
+	}
+
+	MTEST(DotProduct) {
+		FpF32<16> a[] = { FpF32<16>(1.5), FpF32<16>(-2.25), FpF32<16>(3.0) };
+		FpF32<16> b[] = { FpF32<16>(2.0), FpF32<16>(4.0), FpF32<16>(-0.5) };
+		auto result = DotProduct(a, b, 3);
+		CHECK_CLOSE(result.ToDouble(), 1.5*2.0 - 2.25*4.0 - 3.0*0.5, 1e-4);
+	}
+
+	MTEST(DotProductZeroLength) {
+		FpF32<16> a[] = { FpF32<16>(1.5) };
+		auto result = DotProduct(a, a, 0);
+		CHECK_EQUAL(result.GetRawVal(), 0);
+	}
+
+	MTEST(MultiplyAccumulateAddsToAcc) {
+		FpF32<16> a[] = { FpF32<16>(0.5), FpF32<16>(0.25) };
+		FpF32<16> b[] = { FpF32<16>(4.0), FpF32<16>(8.0) };
+		auto result = MultiplyAccumulate(FpF32<16>(10.0), a, b, 2);
+		CHECK_CLOSE(result.ToDouble(), 14.0, 1e-4);
+	}
+
+	MTEST(MultiplyAccumulateOnlyTruncatesOnce) {
+		// Each product is 2^-16 * 0.5 = 2^-17, which truncates to 0 when multiplied with
+		// the '*' operator, but the sum of 4 of them is exactly representable
+		FpF32<16> a[4];
+		FpF32<16> b[4];
+		for(int i = 0; i < 4; i++) {
+			a[i] = FpF32<16>::FromRaw(1);
+			b[i] = FpF32<16>(0.5);
+		}
+		FpF32<16> perElement(0);
+		for(int i = 0; i < 4; i++) {
+			perElement += a[i] * b[i];
+		}
+		CHECK_EQUAL(perElement.GetRawVal(), 0);
+		CHECK_EQUAL(DotProduct(a, b, 4).GetRawVal(), 2);
+	}
+}
@@ -0,0 +1,59 @@
+//!
+//! \file 				FpFConstexprTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the compile-time (constexpr) features of the FpF class.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	// These are all evaluated at compile time, a failure is a compile error
+	constexpr FpF32<16> pi(3.14159265);
+	static_assert(pi.GetRawVal() == 205887, "FpF(double) is not constexpr.");
+	static_assert(FpF32<16>(-3).GetRawVal() == -3 * 65536, "FpF(int32_t) is not constexpr.");
+	static_assert(FpF32<16>::FromRaw(65536) == FpF32<16>(1), "FromRaw() is not constexpr.");
+	static_assert((pi + FpF32<16>(1)).GetRawVal() == 205887 + 65536, "'+' is not constexpr.");
+	static_assert((pi - pi).GetRawVal() == 0, "'-' is not constexpr.");
+	static_assert((FpF32<16>(1.5) * FpF32<16>(-2.0)) == FpF32<16>(-3.0), "'*' is not constexpr.");
+	static_assert((FpF32<16>(3.0) / FpF32<16>(2.0)) == FpF32<16>(1.5), "'/' is not constexpr.");
+	static_assert((FpF32<16>(-3.0) / FpF32<16>(2.0)) == FpF32<16>(-1.5), "'/' of a negative number is not constexpr.");
+	static_assert((FpF32<16>(-1.5) * 2) == -3, "Integer overloads are not constexpr.");
+	static_assert(FpF32<16>(2.5) > FpF32<16>(2.0) && FpF32<16>(2.5) <= 3, "Comparisons are not constexpr.");
+	static_assert(FpF32<16>(-2.5).ToInt<int32_t>() == -3, "ToInt() is not constexpr.");
+	static_assert(FpF32<16>(0.25).ToDouble() == 0.25, "ToDouble() is not constexpr.");
+	static_assert(FpF64<40>(1.5).GetRawVal() == 3LL << 39, "FpF64 is not constexpr.");
+	static_assert(DoubleToRawFix32<8>(1.5) == 384, "DoubleToRawFix32() is not constexpr.");
+	static_assert(FloatToRawFix32<8>(-1.5f) == -384, "FloatToRawFix32() is not constexpr.");
+
+	// User-defined literals
+	static_assert((1.5_q16).GetRawVal() == 3 << 15, "_q16 literal is not constexpr.");
+	static_assert((-0.5_q8).GetRawVal() == -128, "_q8 literal is not constexpr.");
+	static_assert((2_q24).GetRawVal() == 2 << 24, "Integer _q24 literal is not constexpr.");
+
+	/// \brief		A table of coefficients built at compile time.
+	constexpr FpF32<16> coefficients[] = { 0.25_q16, 0.5_q16, 0.25_q16 };
+	static_assert((coefficients[0] + coefficients[1] + coefficients[2]) == 1, "Table is not constexpr.");
+}
+
+MTEST_GROUP(FpFConstexprTests) {
+
+	MTEST(ConstexprValuesMatchRuntimeValues) {
+		volatile double piDbl = 3.14159265;
+		CHECK_EQUAL(pi.GetRawVal(), FpF32<16>(piDbl).GetRawVal());
+		CHECK_EQUAL((1.5_q16 * 2.0_q16).ToDouble(), 3.0);
+		CHECK_EQUAL((0.1_q28).GetRawVal(), FpF32<28>(0.1).GetRawVal());
+		CHECK_EQUAL((3_q12).ToDouble(), 3.0);
+		CHECK_EQUAL(coefficients[1].ToDouble(), 0.5);
+	}
+}
@@ -0,0 +1,164 @@
+//!
+//! \file 				FpFConvertTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the float/double to FpF conversion functions.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpFConvert.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Special values, values on and next to every rounding and saturation boundary of FpF32<16>, and
+	///				random bit patterns (so every exponent is covered).
+	template<class FloatType>
+	std::vector<FloatType> TestValues() {
+		typedef std::numeric_limits<FloatType> Limits;
+		const double lsb = 1.0 / 65536.0;
+		std::vector<FloatType> values = {
+			0, (FloatType) -0.0, Limits::infinity(), -Limits::infinity(), Limits::quiet_NaN(), Limits::denorm_min(),
+			-Limits::denorm_min(), Limits::max(), -Limits::max(), (FloatType) 32768.0, (FloatType) -32768.0,
+			(FloatType) (32768.0 - 0.5 * lsb), (FloatType) (-32768.0 - 0.5 * lsb), (FloatType) (-32768.0 - lsb),
+			(FloatType) (32768.0 - lsb), (FloatType) 1e30, (FloatType) -1e30,
+		};
+		std::srand(1);
+		for(int i = 0; i < 20000; i++) {
+			// Multiples of a quarter LSB, so there are lots of ties
+			values.push_back((FloatType) ((std::rand() % 4000000 - 2000000) * 0.25 * lsb));
+			values.push_back((FloatType) ((std::rand() - RAND_MAX / 2) / (double) RAND_MAX * 70000.0));
+			FloatType random;
+			const uint64_t bits = ((uint64_t) std::rand() << 42) ^ ((uint64_t) std::rand() << 21) ^ std::rand();
+			std::memcpy(&random, &bits, sizeof(random));
+			values.push_back(random);
+		}
+		return values;
+	}
+
+	/// \brief		Rounds x * 2^16 according to mode with long double arithmetic and saturates it to an int32_t.
+	template<RoundingMode mode>
+	int32_t Reference(long double x) {
+		const long double scaled = std::ldexp(x, 16);
+		if(std::isnan(scaled))
+			return 0;
+		long double rounded;
+		if(mode == RoundingMode::Truncate)
+			rounded = std::trunc(scaled);
+		else if(mode == RoundingMode::HalfUp)
+			rounded = std::floor(scaled + 0.5L);
+		else
+			rounded = std::floor(scaled + 0.5L) - (std::floor(scaled + 0.5L) - scaled == 0.5L &&
+												   std::fmod(std::floor(scaled + 0.5L), 2.0L) != 0);
+		return rounded > INT32_MAX ? INT32_MAX : (rounded < INT32_MIN ? INT32_MIN : (int32_t) rounded);
+	}
+
+	/// \brief		Checks ArrayFromFloat() against the reference with every instruction set.
+	template<RoundingMode mode, class FloatType>
+	bool MatchesReference() {
+		const std::vector<FloatType> values = TestValues<FloatType>();
+		std::vector<FpF32<16>> out(values.size());
+		bool passed = true;
+		for(int isa = (int) SimdIsa::Scalar; isa <= (int) SimdIsa::Avx512; isa++) {
+			SetSimdIsa((SimdIsa) isa);
+			ArrayFromFloat<mode>(values.data(), out.data(), values.size());
+			for(std::size_t i = 0; i < values.size(); i++)
+				passed &= out[i].GetRawVal() == Reference<mode>(values[i]);
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+		return passed;
+	}
+
+}
+
+MTEST_GROUP(FpFConvertTests) {
+
+	MTEST(FromFloatTest) {
+		CHECK_EQUAL(FromFloat<FpF32<16>>(1.5f), FpF32<16>(1.5));
+		// 2.5 and 3.5 LSBs
+		CHECK_EQUAL(FromFloat<FpF32<0>>(2.5f).GetRawVal(), 2);
+		CHECK_EQUAL(FromFloat<FpF32<0>>(3.5).GetRawVal(), 4);
+		CHECK_EQUAL((FromFloat<FpF32<0>, RoundingMode::HalfUp>(-2.5f).GetRawVal()), -2);
+		CHECK_EQUAL((FromFloat<FpF32<0>, RoundingMode::HalfUp>(2.5).GetRawVal()), 3);
+		CHECK_EQUAL((FromFloat<FpF32<0>, RoundingMode::Truncate>(-2.75f).GetRawVal()), -2);
+		CHECK_EQUAL((FromFloat<FpF32<8>, RoundingMode::Truncate>(-2.75f)), FpF32<8>(-2.75f));
+		// Saturation
+		CHECK_EQUAL(FromFloat<FpF16<8>>(1000.0f).GetRawVal(), INT16_MAX);
+		CHECK_EQUAL(FromFloat<FpF16<8>>(-1000.0).GetRawVal(), INT16_MIN);
+		CHECK_EQUAL(FromFloat<FpF32<16>>(std::numeric_limits<float>::infinity()).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL(FromFloat<FpF32<16>>(std::numeric_limits<double>::quiet_NaN()).GetRawVal(), 0);
+		CHECK_EQUAL(FromFloat<FpF64<32>>(1e300).GetRawVal(), INT64_MAX);
+		// More fractional bits than a float has mantissa bits
+		CHECK_EQUAL(FromFloat<FpF64<40>>(-0.25f).GetRawVal(), -((int64_t) 1 << 38));
+	}
+
+	MTEST(FloatArrayTest) {
+		CHECK((MatchesReference<RoundingMode::Truncate, float>()));
+		CHECK((MatchesReference<RoundingMode::HalfUp, float>()));
+		CHECK((MatchesReference<RoundingMode::HalfEven, float>()));
+	}
+
+	MTEST(DoubleArrayTest) {
+		CHECK((MatchesReference<RoundingMode::Truncate, double>()));
+		CHECK((MatchesReference<RoundingMode::HalfUp, double>()));
+		CHECK((MatchesReference<RoundingMode::HalfEven, double>()));
+	}
+
+	MTEST(UncheckedAndStochasticTest) {
+		// In range numbers give the same results without the saturation checks
+		const float values[] = { 1.5f, -2.25f, 0.0f, 32767.0f, -32768.0f, 1e-20f, 3.0f / 65536.0f };
+		FpF32<16> saturated[7], unchecked[7];
+		ArrayFromFloat(values, saturated, 7);
+		ArrayFromFloat<RoundingMode::HalfEven, OverflowMode::Unchecked>(values, unchecked, 7);
+		for(int i = 0; i < 7; i++)
+			CHECK_EQUAL(unchecked[i], saturated[i]);
+
+		// A quarter of an LSB rounds up a quarter of the time
+		std::vector<float> quarters(10000, 0.25f / 65536.0f);
+		std::vector<FpF32<16>> out(quarters.size());
+		ArrayFromFloat<RoundingMode::Stochastic>(quarters.data(), out.data(), quarters.size());
+		int numRoundedUp = 0;
+		for(const FpF32<16>& x : out)
+			numRoundedUp += x.GetRawVal();
+		CHECK(numRoundedUp > 2300 && numRoundedUp < 2700);
+	}
+
+	MTEST(ToFloatTest) {
+		std::srand(2);
+		std::vector<FpF32<16>> values(1003);
+		for(FpF32<16>& x : values)
+			x = FpF32<16>::FromRaw((int32_t) ((uint64_t) std::rand() * 2654435761u));
+		std::vector<float> floats(values.size());
+		std::vector<double> doubles(values.size());
+		for(int isa = (int) SimdIsa::Scalar; isa <= (int) SimdIsa::Avx512; isa++) {
+			SetSimdIsa((SimdIsa) isa);
+			ArrayToFloat(values.data(), floats.data(), values.size());
+			ArrayToFloat(values.data(), doubles.data(), values.size());
+			bool passed = true;
+			for(std::size_t i = 0; i < values.size(); i++)
+				passed &= floats[i] == values[i].ToFloat() && doubles[i] == values[i].ToDouble();
+			CHECK(passed);
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+
+		const FpF16<8> small[] = { FpF16<8>(1.5), FpF16<8>(-0.00390625) };
+		float smallFloats[2];
+		ArrayToFloat(small, smallFloats, 2);
+		CHECK_EQUAL(smallFloats[0], 1.5f);
+		CHECK_EQUAL(smallFloats[1], -0.00390625f);
+	}
+}
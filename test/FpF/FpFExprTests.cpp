@@ -0,0 +1,82 @@
+//!
+//! \file 				FpFExprTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the fused FpF expression templates.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cstdlib>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpFExpr.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpFExprTests) {
+
+	MTEST(SumOfProductsShiftsOnceTest) {
+		// Each product is 0.75 LSBs, which FpF's '*' operator truncates to 0
+		typedef FpF32<16> Q16;
+		const Q16 a = Q16::FromRaw(3), b(0.25);
+		const Q16 fused = Lazy(a) * b + Lazy(a) * b + Lazy(a) * b + Lazy(a) * b;
+		CHECK_EQUAL(fused.GetRawVal(), 3);
+		CHECK_EQUAL((a * b + a * b + a * b + a * b).GetRawVal(), 0);
+	}
+
+	MTEST(MatchesWideReferenceTest) {
+		std::srand(1);
+		bool passed = true;
+		for(int i = 0; i < 1000; i++) {
+			const FpF32<20> a = FpF32<20>::FromRaw(std::rand() - RAND_MAX / 2), b = FpF32<20>::FromRaw(std::rand() / 4);
+			const FpF32<20> c = FpF32<20>::FromRaw(-std::rand() / 2), d = FpF32<20>::FromRaw(std::rand() / 8);
+			const FpF32<20> e = FpF32<20>::FromRaw(std::rand() / 2), f = FpF32<20>::FromRaw(std::rand() - RAND_MAX / 2);
+			const int64_t wide = (int64_t) a.GetRawVal() * b.GetRawVal() + (int64_t) c.GetRawVal() * d.GetRawVal() -
+								 (int64_t) e.GetRawVal() * f.GetRawVal();
+			const FpF32<20> fused = Lazy(a) * b + Lazy(c) * d - Lazy(e) * f;
+			passed &= fused.GetRawVal() == (int32_t) (wide >> 20);
+		}
+		CHECK(passed);
+	}
+
+	MTEST(MixedPrecisionTermsTest) {
+		typedef FpF32<16> Q16;
+		const Q16 a(1.5), b(-2.25), c(0.125);
+		// Terms without a product are aligned to the products' precision
+		CHECK_EQUAL((Q16) (Lazy(a) * b + c), Q16(-3.25));
+		CHECK_EQUAL((Q16) (c - Lazy(a) * b), Q16(3.5));
+		CHECK_EQUAL((Q16) (Lazy(a) + b), Q16(-0.75));
+		CHECK_EQUAL((Q16) -(Lazy(a) * b), Q16(3.375));
+		// (a + b) * c is a sum at numFracBits multiplied by c
+		CHECK_EQUAL((Q16) ((Lazy(a) + b) * c), Q16(-0.09375));
+		// A product of a product is narrowed first
+		CHECK_EQUAL((Lazy(a) * b * c).Eval(), a * b * c);
+		const auto expr = Lazy(a) * a;
+		Q16 d = Q16(1.0);
+		d += expr;
+		CHECK_EQUAL(d, Q16(3.25));
+	}
+
+	MTEST(OtherWidthsTest) {
+		// Each product is half an LSB
+		const FpF16<8> a = FpF16<8>::FromRaw(1), b(0.5);
+		CHECK_EQUAL((Lazy(a) * b + Lazy(a) * b).Eval().GetRawVal(), 1);
+		CHECK_EQUAL((a * b + a * b).GetRawVal(), 0);
+		const FpF64<32> c = FpF64<32>::FromRaw(1), d(0.5);
+		CHECK((((FpF64<32>) (Lazy(c) * d + Lazy(c) * d)).GetRawVal() == 1));
+		CHECK(((Lazy(FpF64<32>(2.5)) * FpF64<32>(-4.0) - FpF64<32>(1.0)).Eval() == FpF64<32>(-11.0)));
+	}
+
+	MTEST(ConstexprTest) {
+		constexpr FpF32<16> a(1.5), b(2.0), c(-0.5), d(3.0);
+		constexpr FpF32<16> result = Lazy(a) * b + Lazy(c) * d;
+		static_assert(result.GetRawVal() == 3 << 15, "expression should be evaluated at compile time");
+		CHECK_EQUAL(result, FpF32<16>(1.5));
+	}
+}
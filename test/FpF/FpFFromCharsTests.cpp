@@ -0,0 +1,190 @@
+//!
+//! \file 				FpFFromCharsTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on FromChars() for FpF and FpS numbers and on ParseColumn().
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpFParse.hpp"
+#include "MFixedPoint/FpS.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Parses the whole string, returns the raw value (or -1 if it didn't parse or wasn't all used).
+	template<class FpType>
+	int64_t ParseRaw(const char* str) {
+		FpType value(0);
+		const FromCharsResult result = FpType::FromChars(str, str + std::strlen(str), value);
+		if(result.ec != std::errc() || *result.ptr != '\0')
+			return -1;
+		return value.GetRawVal();
+	}
+
+	/// \brief		Checks that every number formatted with ToChars() parses back to the same raw value.
+	template<class FpType, class RawType>
+	bool RoundTrips(int count) {
+		bool passed = true;
+		for(int i = 0; i < count; i++) {
+			const RawType raw = (RawType) (((uint64_t) std::rand() << 40) ^ ((uint64_t) std::rand() << 16) ^ std::rand());
+			char buffer[128];
+			const ToCharsResult written = FpType::FromRaw(raw).ToChars(buffer, buffer + sizeof(buffer));
+			FpType value(0);
+			const FromCharsResult result = FpType::FromChars(buffer, written.ptr, value);
+			passed &= result.ec == std::errc() && result.ptr == written.ptr && value.GetRawVal() == raw;
+		}
+		return passed;
+	}
+
+}
+
+MTEST_GROUP(FpFFromCharsTests) {
+
+	MTEST(ParseTest) {
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("34"), 34 << 16);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("-2.75"), -(11 << 14));
+		CHECK_EQUAL(ParseRaw<FpF32<16>>(".5"), 1 << 15);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("5."), 5 << 16);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("-32768"), INT32_MIN);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("32767.99999"), INT32_MAX);
+		CHECK_EQUAL(ParseRaw<FpF8<4>>("-0.0625"), -1);
+		CHECK_EQUAL(ParseRaw<FpF64<0>>("-9223372036854775808"), INT64_MIN);
+		// More fractional bits than a double has mantissa bits
+		CHECK_EQUAL(ParseRaw<FpF64<60>>("0.000000000000000000867361737988403547205962240695953369140625"), 1);
+		CHECK_EQUAL(ParseRaw<FpF64<32>>("2147483647.99999999976716935634613037109375"), INT64_MAX);
+
+		std::srand(1);
+		CHECK((RoundTrips<FpF32<16>, int32_t>(10000)));
+		CHECK((RoundTrips<FpF16<15>, int16_t>(10000)));
+		CHECK((RoundTrips<FpF64<33>, int64_t>(10000)));
+		CHECK((RoundTrips<FpF64<60>, int64_t>(10000)));
+	}
+
+	MTEST(RoundingTest) {
+		// 2^-16 = 0.0000152587890625, so these are 0.5 and 1.5 LSBs, which round to even
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("0.00000762939453125"), 0);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("0.00002288818359375"), 2);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("-0.00002288818359375"), -2);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("0.0000076293945312501"), 1);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("0.0000076293945312499"), 0);
+		CHECK_EQUAL(ParseRaw<FpF32<0>>("2.5"), 2);
+		CHECK_EQUAL(ParseRaw<FpF32<0>>("3.5"), 4);
+		CHECK_EQUAL(ParseRaw<FpF32<0>>("-1.5"), -2);
+		CHECK_EQUAL(ParseRaw<FpF32<0>>("-0.5"), 0);
+		// Rounding up carries into the integer part
+		CHECK_EQUAL(ParseRaw<FpF32<16>>("1.999999"), 2 << 16);
+		// Digits past the first 72 decimal places still break ties
+		const std::string tie = "0." + std::string(5, '0') + "762939453125" + std::string(70, '0');
+		CHECK_EQUAL(ParseRaw<FpF32<16>>(tie.c_str()), 0);
+		CHECK_EQUAL(ParseRaw<FpF32<16>>((tie + "1").c_str()), 1);
+	}
+
+	MTEST(ErrorsTest) {
+		const char* const inputs[] = { "", "-", ".", "-.", "abc", "+1", " 1" };
+		for(const char* input : inputs) {
+			FpF32<16> value(7);
+			const FromCharsResult result = FpF32<16>::FromChars(input, input + std::strlen(input), value);
+			CHECK_EQUAL(result.ptr, input);
+			CHECK((result.ec == std::errc::invalid_argument));
+			CHECK_EQUAL(value, FpF32<16>(7));
+		}
+
+		const char* const outOfRange[] = { "32768", "-32768.00001", "99999999999999999999999.5" };
+		for(const char* input : outOfRange) {
+			FpF32<16> value(7);
+			const FromCharsResult result = FpF32<16>::FromChars(input, input + std::strlen(input), value);
+			CHECK_EQUAL(result.ptr, input + std::strlen(input));
+			CHECK((result.ec == std::errc::result_out_of_range));
+			CHECK_EQUAL(value, FpF32<16>(7));
+		}
+
+		// Parsing stops at the first character which isn't part of the number (there are no exponents)
+		const char* const input = "1.5e3";
+		FpF32<16> value(0);
+		const FromCharsResult result = FpF32<16>::FromChars(input, input + 5, value);
+		CHECK_EQUAL(result.ptr, input + 3);
+		CHECK_EQUAL(value, FpF32<16>(1.5));
+	}
+
+	MTEST(FpSTest) {
+		FpS32 value(0, 0);
+		const char* const input = "-1.0625";
+		const FromCharsResult result = FpS32::FromChars(input, input + 7, value, 4);
+		CHECK((result.ec == std::errc()));
+		CHECK_EQUAL(value.GetRawVal(), -17);
+		CHECK_EQUAL(value.GetNumFracBits(), 4);
+		FpS64 wide(0, 0);
+		const char* const small = "0.0009765625";
+		FpS64::FromChars(small, small + 12, wide, 30);
+		CHECK_EQUAL(wide.GetRawVal(), (int64_t) 1 << 20);
+	}
+
+	MTEST(ParseColumnTest) {
+		// Random numbers of all lengths (so both the SIMD kernel and the fallback are used), with every separator
+		std::srand(2);
+		std::string csv;
+		std::vector<int32_t> expected;
+		for(int i = 0; i < 5000; i++) {
+			std::string number = std::rand() % 2 ? "-" : "";
+			const int numIntDigits = std::rand() % 5, numFracDigits = std::rand() % 12;
+			for(int j = 0; j < numIntDigits; j++)
+				number += (char) ('0' + std::rand() % 10);
+			number += '.';
+			for(int j = 0; j < numFracDigits || (numIntDigits == 0 && j == 0); j++)
+				number += (char) ('0' + std::rand() % 10);
+			expected.push_back((int32_t) ParseRaw<FpF32<16>>(number.c_str()));
+			const int separator = std::rand() % 3;
+			csv += number + (separator == 0 ? "," : (separator == 1 ? "\n" : "\r\n"));
+		}
+
+		for(int isa = (int) SimdIsa::Scalar; isa <= (int) SimdIsa::Avx512; isa++) {
+			SetSimdIsa((SimdIsa) isa);
+			std::vector<FpF32<16>> values(expected.size() + 1);
+			const ParseColumnResult result = ParseColumn(csv.data(), csv.data() + csv.size(), values.data(),
+														 values.size());
+			CHECK((result.ec == std::errc()));
+			CHECK_EQUAL(result.ptr, csv.data() + csv.size());
+			CHECK_EQUAL(result.count, expected.size());
+			bool passed = true;
+			for(std::size_t i = 0; i < expected.size(); i++)
+				passed &= values[i].GetRawVal() == expected[i];
+			CHECK(passed);
+
+			// Stops when values is full, at the start of the next number
+			const char* const column = "1,2\n3.25\r\n4";
+			const ParseColumnResult full = ParseColumn(column, column + 11, values.data(), 3);
+			CHECK((full.ec == std::errc()));
+			CHECK_EQUAL(full.count, 3u);
+			CHECK_EQUAL(full.ptr, column + 10);
+			CHECK_EQUAL(values[2], FpF32<16>(3.25));
+
+			// Stops at a number which can't be parsed
+			const std::string bad = "1.5,2.5,3x,4.25,5.125,6";
+			const ParseColumnResult badResult = ParseColumn(bad.data(), bad.data() + bad.size(), values.data(), 4);
+			CHECK((badResult.ec == std::errc::invalid_argument));
+			CHECK_EQUAL(badResult.count, 2u);
+			CHECK_EQUAL(badResult.ptr, bad.data() + 8);
+			const std::string big = "1.5,-99999.0,2.5,3.5,4.5,5.5";
+			const ParseColumnResult bigResult = ParseColumn(big.data(), big.data() + big.size(), values.data(), 6);
+			CHECK((bigResult.ec == std::errc::result_out_of_range));
+			CHECK_EQUAL(bigResult.count, 1u);
+			CHECK_EQUAL(bigResult.ptr, big.data() + 4);
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+	}
+}
@@ -0,0 +1,212 @@
+//!
+//! \file 				FpFMathTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the FpF math functions.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cmath>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpFMath.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Returns the largest difference (in LSBs) between FastDivide() and the '/' operator over a
+	///				range of inputs.
+	template<class FpType>
+	int64_t MaxFastDivideErrorLsb(double maxValue) {
+		int64_t maxError = 0;
+		for(int i = -50; i <= 50; i++) {
+			for(int j = -50; j <= 50; j++) {
+				if(j == 0)
+					continue;
+				FpType a(maxValue * i / 50.0);
+				FpType b(maxValue * j / 50.0 + 0.01);
+				if(b.GetRawVal() == 0)
+					continue;
+				int64_t error = std::llabs((int64_t)FastDivide(a, b).GetRawVal() - (int64_t)(a / b).GetRawVal());
+				if(error > maxError)
+					maxError = error;
+			}
+		}
+		return maxError;
+	}
+
+}
+
+MTEST_GROUP(FpFMathTests) {
+
+	MTEST(ReciprocalPositive) {
+		CHECK_CLOSE(Reciprocal(FpF32<16>(4.0)).ToDouble(), 0.25, 1e-4);
+		FpF32<16> b(0.3);
+		CHECK_CLOSE(Reciprocal(b).ToDouble(), 1.0/b.ToDouble(), 1e-4);
+		CHECK_CLOSE(Reciprocal(FpF32<16>(3000.0)).ToDouble(), 1.0/3000.0, 1e-4);
+	}
+
+	MTEST(ReciprocalNegative) {
+		CHECK_CLOSE(Reciprocal(FpF32<16>(-7.0)).ToDouble(), -1.0/7.0, 1e-4);
+	}
+
+	MTEST(ReciprocalOtherWidths) {
+		CHECK_CLOSE(Reciprocal(FpF8<4>(2.5)).ToDouble(), 0.4, 1.0/16);
+		CHECK_CLOSE(Reciprocal(FpF16<10>(-3.0)).ToDouble(), -1.0/3.0, 1.0/1024);
+		CHECK_CLOSE(Reciprocal(FpF64<32>(12345.678)).ToDouble(), 1.0/12345.678, 1e-9);
+	}
+
+	MTEST(ReciprocalIterationsImprovePrecision) {
+		FpF32<24> b(1.37);
+		double exact = 1.0/1.37;
+		double error0 = std::fabs(Reciprocal<0>(b).ToDouble() - exact);
+		double error1 = std::fabs(Reciprocal<1>(b).ToDouble() - exact);
+		double error2 = std::fabs(Reciprocal<2>(b).ToDouble() - exact);
+		CHECK(error0 < 1.0/512);
+		CHECK(error1 < error0);
+		CHECK(error2 <= 2.0/(1 << 24));
+	}
+
+	MTEST(FastDivideMatchesDivisionOperator) {
+		CHECK(MaxFastDivideErrorLsb<FpF32<16>>(1000.0) <= 1);
+		CHECK(MaxFastDivideErrorLsb<FpF32<8>>(100000.0) <= 1);
+		CHECK(MaxFastDivideErrorLsb<FpF16<8>>(100.0) <= 1);
+		CHECK(MaxFastDivideErrorLsb<FpF64<32>>(100000.0) <= 1);
+	}
+
+	MTEST(FastDivideSigns) {
+		CHECK_CLOSE(FastDivide(FpF32<16>(3.2), FpF32<16>(0.6)).ToDouble(), 3.2/0.6, 1e-4);
+		CHECK_CLOSE(FastDivide(FpF32<16>(-3.2), FpF32<16>(0.6)).ToDouble(), -3.2/0.6, 1e-4);
+		CHECK_CLOSE(FastDivide(FpF32<16>(3.2), FpF32<16>(-0.6)).ToDouble(), -3.2/0.6, 1e-4);
+		CHECK_CLOSE(FastDivide(FpF32<16>(-3.2), FpF32<16>(-0.6)).ToDouble(), 3.2/0.6, 1e-4);
+	}
+
+	MTEST(ArrayFastDivide) {
+		FpF32<16> a[] = { FpF32<16>(1.0), FpF32<16>(-2.5), FpF32<16>(100.0), FpF32<16>(0.0) };
+		FpF32<16> out[4];
+		ArrayFastDivide(a, FpF32<16>(-0.5), out, 4);
+		for(int i = 0; i < 4; i++) {
+			CHECK_EQUAL(out[i].GetRawVal(), FastDivide(a[i], FpF32<16>(-0.5)).GetRawVal());
+		}
+		CHECK_CLOSE(out[2].ToDouble(), -200.0, 1e-4);
+		// The same precision as FastDivide() with the same num. of iterations
+		ArrayFastDivide<0>(a, FpF32<16>(0.3), out, 4);
+		for(int i = 0; i < 4; i++) {
+			CHECK_EQUAL(out[i].GetRawVal(), FastDivide<0>(a[i], FpF32<16>(0.3)).GetRawVal());
+		}
+	}
+
+	MTEST(SinCosMaxError) {
+		double maxSinError = 0.0;
+		double maxCosError = 0.0;
+		for(int i = -5000; i <= 5000; i++) {
+			FpF32<24> x(i * 0.0013);
+			double xDouble = x.ToDouble();
+			FpF32<24> s, c;
+			SinCos(x, s, c);
+			maxSinError = std::fmax(maxSinError, std::fabs(Sin(x).ToDouble() - std::sin(xDouble)));
+			maxCosError = std::fmax(maxCosError, std::fabs(Cos(x).ToDouble() - std::cos(xDouble)));
+			CHECK_EQUAL(s.GetRawVal(), Sin(x).GetRawVal());
+			CHECK_EQUAL(c.GetRawVal(), Cos(x).GetRawVal());
+		}
+		CHECK(maxSinError < 4.8e-6);
+		CHECK(maxCosError < 4.8e-6);
+	}
+
+	MTEST(SinTableSize) {
+		double maxError64 = 0.0;
+		double maxError1024 = 0.0;
+		for(int i = 0; i < 1000; i++) {
+			FpF32<28> x(i * 0.00629);
+			maxError64 = std::fmax(maxError64, std::fabs(Sin<64>(x).ToDouble() - std::sin(x.ToDouble())));
+			maxError1024 = std::fmax(maxError1024, std::fabs(Sin<1024>(x).ToDouble() - std::sin(x.ToDouble())));
+		}
+		CHECK(maxError64 < 7.6e-5);
+		CHECK(maxError1024 < 3.0e-7);
+	}
+
+	MTEST(SinKeyAngles) {
+		CHECK_EQUAL(Sin(FpF32<16>(0.0)).GetRawVal(), 0);
+		CHECK_EQUAL(Cos(FpF32<16>(0.0)).GetRawVal(), 1 << 16);
+		CHECK_CLOSE(Sin(FpF32<16>(1.5707963)).ToDouble(), 1.0, 1e-4);
+		CHECK_CLOSE(Sin(FpF32<16>(-1.5707963)).ToDouble(), -1.0, 1e-4);
+		CHECK_CLOSE(Sin(FpF32<16>(3.14159265)).ToDouble(), 0.0, 1e-4);
+	}
+
+	MTEST(SinLargeAngles) {
+		FpF32<8> x(1000.0);
+		CHECK_CLOSE(Sin(x).ToDouble(), std::sin(x.ToDouble()), 0.01);
+		FpF64<32> y(-123456.0);
+		CHECK_CLOSE(Cos(y).ToDouble(), std::cos(y.ToDouble()), 1e-4);
+	}
+
+	MTEST(SinOtherWidths) {
+		// sin = 1.0 is clamped to the largest value FpF8<7> and FpF16<15> can represent
+		CHECK_EQUAL(Sin(FpF8<5>(1.5707963)).GetRawVal(), 32);
+		CHECK_EQUAL(Cos(FpF16<15>(0.0)).GetRawVal(), INT16_MAX);
+		CHECK_CLOSE(Sin(FpF16<12>(0.5)).ToDouble(), std::sin(0.5), 1.0/4096);
+		CHECK_CLOSE(Sin(FpF64<40>(0.5)).ToDouble(), std::sin(0.5), 5e-6);
+	}
+	MTEST(SqrtExact) {
+		CHECK_EQUAL(Sqrt(FpF32<16>(4.0)).GetRawVal(), 2 << 16);
+		CHECK_EQUAL(Sqrt(FpF32<16>(0.25)).GetRawVal(), 1 << 15);
+		CHECK_EQUAL(Sqrt(FpF16<8>(9.0)).GetRawVal(), 3 << 8);
+		CHECK_EQUAL(Sqrt(FpF8<4>(4.0)).GetRawVal(), 2 << 4);
+		CHECK_EQUAL(Sqrt(FpF64<32>(1.0e6)).ToDouble(), 1000.0);
+		CHECK_EQUAL(Sqrt(FpF32<16>(0.0)).GetRawVal(), 0);
+		// Negative numbers give 0
+		CHECK_EQUAL(Sqrt(FpF32<16>(-4.0)).GetRawVal(), 0);
+	}
+
+	MTEST(SqrtAllWidths) {
+		CHECK_CLOSE(Sqrt(FpF8<4>(2.0)).ToDouble(), std::sqrt(2.0), 1.0/16);
+		CHECK_CLOSE(Sqrt(FpF16<12>(2.0)).ToDouble(), std::sqrt(2.0), 1.0/4096);
+		CHECK_CLOSE(Sqrt(FpF32<16>(12345.678)).ToDouble(), std::sqrt(12345.678), 1.0/65536);
+		CHECK_CLOSE(Sqrt(FpF64<40>(2.0)).ToDouble(), std::sqrt(2.0), 1e-11);
+		// Rounds down, so squaring the result never gives more than the input
+		FpF32<16> x(7.77);
+		FpF32<16> root = Sqrt(x);
+		CHECK((root * root).GetRawVal() <= x.GetRawVal());
+	}
+
+	MTEST(RSqrtAllWidths) {
+		CHECK_EQUAL(RSqrt(FpF32<16>(4.0)).ToDouble(), 0.5);
+		CHECK_CLOSE(RSqrt(FpF8<4>(2.0)).ToDouble(), 1.0/std::sqrt(2.0), 2.0/16);
+		CHECK_CLOSE(RSqrt(FpF16<12>(3.0)).ToDouble(), 1.0/std::sqrt(3.0), 2.0/4096);
+		FpF32<16> small(0.01);
+		CHECK_CLOSE(RSqrt(small).ToDouble(), 1.0/std::sqrt(small.ToDouble()), 2.0/65536);
+		CHECK_CLOSE(RSqrt(FpF32<24>(100.0)).ToDouble(), 1.0/std::sqrt(100.0), 2.0/(1 << 24));
+		CHECK_CLOSE(RSqrt(FpF64<40>(5.0)).ToDouble(), 1.0/std::sqrt(5.0), 1e-11);
+	}
+
+	MTEST(RSqrtAcrossRange) {
+		double maxErrorLsb = 0.0;
+		for(int64_t raw = 1; raw < INT32_MAX; raw = raw * 3 / 2 + 1) {
+			FpF32<16> x = FpF32<16>::FromRaw((int32_t) raw);
+			double expected = 1.0/std::sqrt(x.ToDouble());
+			if(expected > 32767.0)
+				continue;
+			maxErrorLsb = std::fmax(maxErrorLsb, std::fabs(RSqrt(x).ToDouble() - expected) * 65536.0);
+		}
+		CHECK(maxErrorLsb <= 1.0);
+	}
+
+	MTEST(ArraySqrtAndRSqrt) {
+		FpF32<16> a[4] = { FpF32<16>(1.0), FpF32<16>(4.0), FpF32<16>(16.0), FpF32<16>(64.0) };
+		FpF32<16> roots[4];
+		FpF32<16> rRoots[4];
+		ArraySqrt(a, roots, 4);
+		ArrayRSqrt(a, rRoots, 4);
+		for(int i = 0; i < 4; i++) {
+			CHECK_EQUAL(roots[i].ToDouble(), (double) (1 << i));
+			CHECK_CLOSE(rRoots[i].ToDouble(), 1.0/(1 << i), 2.0/65536);
+		}
+	}
+}
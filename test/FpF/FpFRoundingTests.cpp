@@ -0,0 +1,94 @@
+//!
+//! \file 				FpFRoundingTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the FpF rounding mode functions.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/Rounding.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpFRoundingTests) {
+
+	MTEST(MultiplyRoundingModes) {
+		// Raw values, with 4 fractional bits the products are 1.5, 2.5 and -2.5 LSBs
+		FpF32<4> a = FpF32<4>::FromRaw(3);
+		FpF32<4> b = FpF32<4>::FromRaw(5);
+		FpF32<4> c = FpF32<4>::FromRaw(-5);
+		FpF32<4> half = FpF32<4>::FromRaw(8);
+
+		CHECK_EQUAL(Multiply<RoundingMode::Truncate>(a, half).GetRawVal(), 1);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfUp>(a, half).GetRawVal(), 2);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfEven>(a, half).GetRawVal(), 2);
+
+		CHECK_EQUAL(Multiply<RoundingMode::Truncate>(b, half).GetRawVal(), 2);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfUp>(b, half).GetRawVal(), 3);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfEven>(b, half).GetRawVal(), 2);
+
+		CHECK_EQUAL(Multiply<RoundingMode::Truncate>(c, half).GetRawVal(), -3);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfUp>(c, half).GetRawVal(), -2);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfEven>(c, half).GetRawVal(), -2);
+
+		// Truncate is the same as the '*' operator
+		CHECK_EQUAL(Multiply<RoundingMode::Truncate>(FpF32<16>(1.37), FpF32<16>(-2.91)).GetRawVal(),
+				(FpF32<16>(1.37) * FpF32<16>(-2.91)).GetRawVal());
+	}
+
+	MTEST(DivideRoundingModes) {
+		CHECK_EQUAL(Divide<RoundingMode::Truncate>(FpF32<0>(5), FpF32<0>(2)).GetRawVal(), 2);
+		CHECK_EQUAL(Divide<RoundingMode::HalfUp>(FpF32<0>(5), FpF32<0>(2)).GetRawVal(), 3);
+		CHECK_EQUAL(Divide<RoundingMode::HalfEven>(FpF32<0>(5), FpF32<0>(2)).GetRawVal(), 2);
+		CHECK_EQUAL(Divide<RoundingMode::HalfEven>(FpF32<0>(7), FpF32<0>(2)).GetRawVal(), 4);
+
+		CHECK_EQUAL(Divide<RoundingMode::Truncate>(FpF32<0>(-7), FpF32<0>(2)).GetRawVal(), -3);
+		CHECK_EQUAL(Divide<RoundingMode::HalfUp>(FpF32<0>(-7), FpF32<0>(2)).GetRawVal(), -3);
+		CHECK_EQUAL(Divide<RoundingMode::HalfEven>(FpF32<0>(-7), FpF32<0>(2)).GetRawVal(), -4);
+		CHECK_EQUAL(Divide<RoundingMode::HalfEven>(FpF32<0>(7), FpF32<0>(-2)).GetRawVal(), -4);
+		CHECK_EQUAL(Divide<RoundingMode::HalfUp>(FpF32<0>(-8), FpF32<0>(3)).GetRawVal(), -3);
+
+		CHECK_EQUAL(Divide<RoundingMode::HalfEven>(FpF64<0>(7), FpF64<0>(2)).GetRawVal(), 4);
+		CHECK_EQUAL(Divide<RoundingMode::HalfUp>(FpF16<0>(5), FpF16<0>(2)).GetRawVal(), 3);
+	}
+
+	MTEST(StochasticRoundingIsUnbiased) {
+		SetStochasticRoundingSeed(12345);
+		// 0.25 LSBs and 1/3 LSBs
+		FpF32<4> a = FpF32<4>::FromRaw(4);
+		FpF32<4> b = FpF32<4>::FromRaw(1);
+		int64_t multiplySum = 0;
+		int64_t divideSum = 0;
+		const int numSamples = 10000;
+		for(int i = 0; i < numSamples; i++) {
+			int32_t product = Multiply<RoundingMode::Stochastic>(a, b).GetRawVal();
+			CHECK(product == 0 || product == 1);
+			multiplySum += product;
+			divideSum += Divide<RoundingMode::Stochastic>(FpF32<0>(1), FpF32<0>(3)).GetRawVal();
+		}
+		CHECK_CLOSE((double) multiplySum / numSamples, 0.25, 0.02);
+		CHECK_CLOSE((double) divideSum / numSamples, 1.0/3.0, 0.02);
+	}
+
+	MTEST(ConvertTo) {
+		// 1.5 and 2.5 LSBs of a FpF16<8>
+		FpF32<16> a = FpF32<16>::FromRaw(0x180);
+		FpF32<16> b = FpF32<16>::FromRaw(0x280);
+		CHECK_EQUAL(ConvertTo<FpF16<8>>(a).GetRawVal(), 1);
+		CHECK_EQUAL((ConvertTo<FpF16<8>, RoundingMode::HalfEven>(a).GetRawVal()), 2);
+		CHECK_EQUAL((ConvertTo<FpF16<8>, RoundingMode::HalfEven>(b).GetRawVal()), 2);
+		CHECK_EQUAL((ConvertTo<FpF16<8>, RoundingMode::HalfUp>(b).GetRawVal()), 3);
+		// More fractional bits is exact
+		CHECK_EQUAL(ConvertTo<FpF32<20>>(FpF32<16>(1.5)).ToDouble(), 1.5);
+		CHECK_EQUAL((ConvertTo<FpF64<40>, RoundingMode::HalfEven>(FpF32<16>(-1.5)).ToDouble()), -1.5);
+		// Widening to a type with a wider OverflowType
+		CHECK_EQUAL(ConvertTo<FpF64<40>>(FpF16<8>(1.5)).ToDouble(), 1.5);
+		CHECK_EQUAL((ConvertTo<FpF64<56>, RoundingMode::HalfEven>(FpF16<8>(-100.25)).ToDouble()), -100.25);
+	}
+}
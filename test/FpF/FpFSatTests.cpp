@@ -0,0 +1,95 @@
+//!
+//! \file 				FpFSatTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the saturating FpFSat class.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpFSat.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpFSatTests) {
+
+	MTEST(ArithmeticInRangeMatchesFpF) {
+		FpFSat32<16> a(3.5);
+		FpFSat32<16> b(-1.25);
+		CHECK_EQUAL((a + b).ToDouble(), 2.25);
+		CHECK_EQUAL((a - b).ToDouble(), 4.75);
+		CHECK_EQUAL((a * b).ToDouble(), -4.375);
+		CHECK_CLOSE((a / b).ToDouble(), -2.8, 1.0/65536);
+		CHECK_EQUAL((a * b).GetRawVal(), (FpF32<16>(3.5) * FpF32<16>(-1.25)).GetRawVal());
+	}
+
+	MTEST(AdditionSaturates) {
+		FpFSat16<8> a(100.0);
+		CHECK_EQUAL((a + a).GetRawVal(), INT16_MAX);
+		CHECK_EQUAL((-a - a).GetRawVal(), INT16_MIN);
+		FpFSat32<16> max = FpFSat32<16>::Max();
+		CHECK_EQUAL((max + FpFSat32<16>(1)).GetRawVal(), INT32_MAX);
+		FpFSat32<16> x(30000.0);
+		x += FpFSat32<16>(30000.0);
+		CHECK_EQUAL(x.GetRawVal(), INT32_MAX);
+	}
+
+	MTEST(SubtractionSaturates) {
+		FpFSat8<4> a(7.0);
+		FpFSat8<4> b(-7.0);
+		CHECK_EQUAL((b - a).GetRawVal(), INT8_MIN);
+		CHECK_EQUAL((a - b).GetRawVal(), INT8_MAX);
+	}
+
+	MTEST(MultiplicationSaturates) {
+		FpFSat32<16> a(1000.0);
+		CHECK_EQUAL((a * a).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((a * -a).GetRawVal(), INT32_MIN);
+		FpFSat64<32> b(3.0e6);
+		CHECK(((b * b).GetRawVal()) == INT64_MAX);
+		CHECK_EQUAL((a * 1000000).GetRawVal(), INT32_MAX);
+	}
+
+	MTEST(DivisionSaturates) {
+		FpFSat32<16> a(1000.0);
+		FpFSat32<16> small(0.001);
+		CHECK_EQUAL((a / small).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((-a / small).GetRawVal(), INT32_MIN);
+		CHECK_EQUAL((a / FpFSat32<16>(0)).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((-a / FpFSat32<16>(0)).GetRawVal(), INT32_MIN);
+		CHECK_EQUAL((FpFSat32<16>::Min() / -1).GetRawVal(), INT32_MAX);
+	}
+
+	MTEST(NegationSaturates) {
+		CHECK_EQUAL((-FpFSat32<16>::Min()).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((-FpFSat32<16>(2.5)).ToDouble(), -2.5);
+	}
+
+	MTEST(ShiftsSaturate) {
+		FpFSat32<16> a(3.0);
+		CHECK_EQUAL((a << 2).ToDouble(), 12.0);
+		CHECK_EQUAL((a >> 1).ToDouble(), 1.5);
+		CHECK_EQUAL((a << 14).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((-a << 100).GetRawVal(), INT32_MIN);
+		CHECK_EQUAL((FpFSat32<16>(0) << 100).GetRawVal(), 0);
+	}
+
+	MTEST(ConstructorsSaturate) {
+		CHECK_EQUAL(FpFSat16<8>(1000.0).GetRawVal(), INT16_MAX);
+		CHECK_EQUAL(FpFSat16<8>(-1000.0).GetRawVal(), INT16_MIN);
+		CHECK_EQUAL(FpFSat16<8>(1000).GetRawVal(), INT16_MAX);
+		CHECK_EQUAL(FpFSat8<4>((int8_t) -100).GetRawVal(), INT8_MIN);
+	}
+
+	MTEST(ConversionToAndFromFpF) {
+		FpF32<16> a(1.5);
+		FpFSat32<16> b(a);
+		CHECK_EQUAL(b.ToDouble(), 1.5);
+		CHECK_EQUAL(b.ToFpF().GetRawVal(), a.GetRawVal());
+	}
+}
@@ -0,0 +1,132 @@
+//!
+//! \file 				FpFToCharsTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on ToChars() and ArrayToChars() for FpF and FpS numbers.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpF.hpp"
+#include "MFixedPoint/FpS.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	template<class FpType>
+	std::string ToCharsString(FpType value, int numDigits = exactDigits) {
+		char buffer[128];
+		const ToCharsResult result = value.ToChars(buffer, buffer + sizeof(buffer), numDigits);
+		return std::string(buffer, result.ptr);
+	}
+
+	/// \brief		printf() formats doubles exactly (rounding ties to even), and these numbers are exact doubles.
+	std::string Printf(double value, int numDigits) {
+		char buffer[128];
+		std::snprintf(buffer, sizeof(buffer), "%.*f", numDigits, value);
+		return buffer;
+	}
+
+}
+
+MTEST_GROUP(FpFToCharsTests) {
+
+	MTEST(ExactDigitsTest) {
+		CHECK_EQUAL(ToCharsString(FpF32<16>(34)), "34");
+		CHECK_EQUAL(ToCharsString(FpF32<16>(34.0625)), "34.0625");
+		CHECK_EQUAL(ToCharsString(FpF32<16>(-0.5)), "-0.5");
+		CHECK_EQUAL(ToCharsString(FpF32<16>::FromRaw(1)), "0.0000152587890625");
+		CHECK_EQUAL(ToCharsString(FpF32<16>::FromRaw(INT32_MIN)), "-32768");
+		CHECK_EQUAL(ToCharsString(FpF8<4>::FromRaw(-1)), "-0.0625");
+		CHECK_EQUAL(ToCharsString(FpF32<0>(-123456)), "-123456");
+		// More fractional bits than a double has mantissa bits
+		CHECK_EQUAL(ToCharsString(FpF64<60>::FromRaw(1)),
+					"0.000000000000000000867361737988403547205962240695953369140625");
+		CHECK_EQUAL(ToCharsString(FpF64<0>::FromRaw(INT64_MIN)), "-9223372036854775808");
+		CHECK_EQUAL(ToCharsString(FpF64<32>::FromRaw(INT64_MAX)), "2147483647.99999999976716935634613037109375");
+	}
+
+	MTEST(NumDigitsTest) {
+		CHECK_EQUAL(ToCharsString(FpF32<16>(34), 2), "34.00");
+		CHECK_EQUAL(ToCharsString(FpF32<16>(1.5), 0), "2");
+		CHECK_EQUAL(ToCharsString(FpF32<16>(2.5), 0), "2");
+		CHECK_EQUAL(ToCharsString(FpF32<16>(-9.96875), 1), "-10.0");
+		CHECK_EQUAL(ToCharsString(FpF32<16>(0.125), 2), "0.12");
+		CHECK_EQUAL(ToCharsString(FpF32<16>(0.375), 2), "0.38");
+		CHECK_EQUAL(ToCharsString(FpF32<4>(0.5), 20), "0.50000000000000000000");
+		CHECK_EQUAL(ToCharsString(FpF32<0>(7), 2), "7.00");
+
+		// Matches printf() for random raw values and numbers of decimal places
+		std::srand(1);
+		bool passed = true;
+		for(int i = 0; i < 10000; i++) {
+			const int32_t raw = (int32_t) ((uint64_t) std::rand() * 2654435761u);
+			const int numDigits = i % 12;
+			passed &= ToCharsString(FpF32<16>::FromRaw(raw), numDigits) == Printf(raw / 65536.0, numDigits);
+			passed &= ToCharsString(FpF32<27>::FromRaw(raw), numDigits) == Printf(raw / 134217728.0, numDigits);
+			passed &= ToCharsString(FpF16<15>::FromRaw((int16_t) raw), numDigits) ==
+					  Printf((int16_t) raw / 32768.0, numDigits);
+		}
+		CHECK(passed);
+	}
+
+	MTEST(ToStringTest) {
+		// ToString() has the same output as std::to_string(ToDouble())
+		std::srand(2);
+		bool passed = true;
+		for(int i = 0; i < 1000; i++) {
+			const int32_t raw = (int32_t) ((uint64_t) std::rand() * 2654435761u);
+			passed &= FpF32<20>::FromRaw(raw).ToString() == std::to_string(FpF32<20>::FromRaw(raw).ToDouble());
+			passed &= FpS32::FromRaw(raw, 12).ToString() == std::to_string(FpS32::FromRaw(raw, 12).ToDouble());
+		}
+		CHECK(passed);
+	}
+
+	MTEST(FpSTest) {
+		CHECK_EQUAL(ToCharsString(FpS32(-2.75, 8)), "-2.75");
+		CHECK_EQUAL(ToCharsString(FpS32(-2.75, 8), 1), "-2.8");
+		CHECK_EQUAL(ToCharsString(FpS64(1.0 / 1024.0, 40)), "0.0009765625");
+	}
+
+	MTEST(BufferTooSmallTest) {
+		char buffer[8];
+		ToCharsResult result = FpF32<16>(-12.5).ToChars(buffer, buffer + 4);
+		CHECK_EQUAL(result.ptr, buffer + 4);
+		CHECK((result.ec == std::errc::value_too_large));
+		result = FpF32<16>(-12.5).ToChars(buffer, buffer + 4, 0);
+		CHECK((result.ec == std::errc()));
+		CHECK_EQUAL(std::string(buffer, result.ptr), "-12");
+	}
+
+	MTEST(ArrayToCharsTest) {
+		const FpF32<16> values[] = { FpF32<16>(1.5), FpF32<16>(-0.25), FpF32<16>(100) };
+		char buffer[32];
+		ToCharsResult result = ArrayToChars(values, 3, buffer, buffer + sizeof(buffer));
+		CHECK((result.ec == std::errc()));
+		CHECK_EQUAL(std::string(buffer, result.ptr), "1.5,-0.25,100");
+		result = ArrayToChars(values, 3, buffer, buffer + sizeof(buffer), '\n', 2);
+		CHECK_EQUAL(std::string(buffer, result.ptr), "1.50\n-0.25\n100.00");
+
+		// Only the numbers which fit completely (with their separator) are written
+		result = ArrayToChars(values, 3, buffer, buffer + 10);
+		CHECK((result.ec == std::errc::value_too_large));
+		CHECK_EQUAL(std::string(buffer, result.ptr), "1.5,-0.25,");
+		result = ArrayToChars(values, 3, buffer, buffer + 9);
+		CHECK_EQUAL(std::string(buffer, result.ptr), "1.5,");
+
+		const FpS32 fpsValues[] = { FpS32(0.5, 4), FpS32(3, 0) };
+		result = ArrayToChars(fpsValues, 2, buffer, buffer + sizeof(buffer), ';');
+		CHECK_EQUAL(std::string(buffer, result.ptr), "0.5;3");
+	}
+}
@@ -74,6 +74,30 @@ MTEST_GROUP(FpFArithmeticTests) {
 		CHECK_CLOSE(fp3.ToDouble(), 40.0, 0.1);		
 	}
 
+	MTEST(FpF64FullPrecisionMultiplication) {
+		// Q32.32, raw product is approx. 2^88, which overflows an int64_t intermediary
+		FpF64<32> fp1(123456.75);
+		FpF64<32> fp2(-7890.125);
+		auto fp3 = fp1 * fp2;
+		CHECK_CLOSE(fp3.ToDouble(), 123456.75 * -7890.125, 1e-6);
+		// Exact, both inputs and the result are representable
+		CHECK_EQUAL(fp3.GetRawVal(), FpF64<32>(123456.75 * -7890.125).GetRawVal());
+	}
+
+	MTEST(FpF64FullPrecisionDivision) {
+		FpF64<32> fp1(-1000000.5);
+		FpF64<32> fp2(0.25);
+		auto fp3 = fp1 / fp2;
+		CHECK_EQUAL(fp3.GetRawVal(), FpF64<32>(-4000002.0).GetRawVal());
+	}
+
+	MTEST(EmulatedInt128OverflowType) {
+		FpF<int64_t, Int128Emulated, 32> fp1(123456.75);
+		FpF<int64_t, Int128Emulated, 32> fp2(-7890.125);
+		CHECK_CLOSE((fp1 * fp2).ToDouble(), 123456.75 * -7890.125, 1e-6);
+		CHECK_CLOSE((fp1 / fp2).ToDouble(), 123456.75 / -7890.125, 1e-6);
+	}
+
 	MTEST(PositiveDivisionTest)	{
 		FpF32<12> fp1(3.2);
 		FpF32<12> fp2(0.6);		
@@ -0,0 +1,128 @@
+//!
+//! \file 				FpMatrixTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the FpMatrix class and MatrixMultiply().
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cstdlib>
+#include <vector>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpMatrix.hpp"
+
+using namespace mn::MFixedPoint;
+
+namespace {
+
+	/// \brief		Returns true if MatrixMultiply() gives the same results as accumulating each element in
+	///				OverflowType and shifting once, for every SIMD ISA.
+	template<class FpFType, class OverflowType>
+	bool MatrixMultiplyMatchesReference(std::size_t numRows, std::size_t numInner, std::size_t numCols, int numFracBits) {
+		std::vector<FpFType> a(numRows * numInner), b(numInner * numCols), out(numRows * numCols);
+		std::srand(numRows * numInner * numCols);
+		for(std::size_t i = 0; i < a.size(); i++)
+			a[i] = FpFType::FromRaw(std::rand() % 2000001 - 1000000);
+		for(std::size_t i = 0; i < b.size(); i++)
+			b[i] = FpFType::FromRaw(std::rand() % 2000001 - 1000000);
+
+		bool passed = true;
+		const SimdIsa isas[] = { SimdIsa::Scalar, SimdIsa::Avx2, SimdIsa::Avx512 };
+		for(SimdIsa isa : isas) {
+			SetSimdIsa(isa);
+			MatrixMultiply(a.data(), b.data(), out.data(), numRows, numInner, numCols);
+			for(std::size_t i = 0; i < numRows; i++) {
+				for(std::size_t j = 0; j < numCols; j++) {
+					OverflowType sum = 0;
+					for(std::size_t k = 0; k < numInner; k++)
+						sum += (OverflowType) a[i * numInner + k].GetRawVal() * b[k * numCols + j].GetRawVal();
+					passed &= out[i * numCols + j].GetRawVal() == (decltype(out[0].GetRawVal())) (sum >> numFracBits);
+				}
+			}
+		}
+		SetSimdIsa(SimdIsa::Avx512);
+		return passed;
+	}
+
+}
+
+MTEST_GROUP(FpMatrixTests) {
+
+	MTEST(ArithmeticTest) {
+		typedef FpMatrix<FpF32<16>, 2, 2> Matrix;
+		const Matrix a({ FpF32<16>(1.0), FpF32<16>(2.0), FpF32<16>(3.0), FpF32<16>(4.0) });
+		const Matrix b({ FpF32<16>(0.5), FpF32<16>(-1.0), FpF32<16>(1.5), FpF32<16>(2.0) });
+		CHECK((a + b == Matrix({ FpF32<16>(1.5), FpF32<16>(1.0), FpF32<16>(4.5), FpF32<16>(6.0) })));
+		CHECK((a - b == Matrix({ FpF32<16>(0.5), FpF32<16>(3.0), FpF32<16>(1.5), FpF32<16>(2.0) })));
+		CHECK((-a == a * FpF32<16>(-1.0)));
+		// [1 2; 3 4] * [0.5 -1; 1.5 2] = [3.5 3; 7.5 5]
+		CHECK((a * b == Matrix({ FpF32<16>(3.5), FpF32<16>(3.0), FpF32<16>(7.5), FpF32<16>(5.0) })));
+		CHECK((a * Matrix::Identity() == a));
+		CHECK((a * Matrix::Zero() == Matrix::Zero()));
+		CHECK_EQUAL(a(1, 0), FpF32<16>(3.0));
+		CHECK_EQUAL(a.Transpose()(1, 0), FpF32<16>(2.0));
+
+		Matrix c = a;
+		c(0, 1) = FpF32<16>(5.0);
+		c += b;
+		c -= a;
+		CHECK_EQUAL(c(0, 1), FpF32<16>(2.0));
+		CHECK((c != b));
+	}
+
+	MTEST(NonSquareAndVectorTest) {
+		const FpMatrix<FpF32<16>, 2, 3> a({ FpF32<16>(1.0), FpF32<16>(0.0), FpF32<16>(2.0),
+											FpF32<16>(0.0), FpF32<16>(-1.0), FpF32<16>(0.5) });
+		const FpVec<FpF32<16>, 3> v({ FpF32<16>(2.0), FpF32<16>(3.0), FpF32<16>(4.0) });
+		const FpVec<FpF32<16>, 2> product = a * v;
+		CHECK_EQUAL(product[0], FpF32<16>(10.0));
+		CHECK_EQUAL(product[1], FpF32<16>(-1.0));
+		CHECK_EQUAL(Dot(v, v), FpF32<16>(29.0));
+		CHECK_EQUAL((a.Transpose() * a)(2, 2), FpF32<16>(4.25));
+	}
+
+	MTEST(ConstexprTest) {
+		typedef FpMatrix<FpF32<16>, 3, 3> Matrix;
+		constexpr Matrix rotation({ FpF32<16>(0.0), FpF32<16>(-1.0), FpF32<16>(0.0),
+									FpF32<16>(1.0), FpF32<16>(0.0), FpF32<16>(0.0),
+									FpF32<16>(0.0), FpF32<16>(0.0), FpF32<16>(1.0) });
+		constexpr Matrix product = rotation * rotation.Transpose();
+		static_assert(product == Matrix::Identity(), "product should be calculated at compile time");
+		constexpr FpVec<FpF32<16>, 3> v = rotation * FpVec<FpF32<16>, 3>({ FpF32<16>(1.0), FpF32<16>(2.0), FpF32<16>(3.0) });
+		static_assert(v[0] == FpF32<16>(-2.0) && v[1] == FpF32<16>(1.0), "product should be calculated at compile time");
+		CHECK_EQUAL(v[2], FpF32<16>(3.0));
+	}
+
+	MTEST(ProductShiftsOnceTest) {
+		// Each product is 0.75 LSBs, which FpF's '*' operator truncates to 0
+		typedef FpF32<16> Q16;
+		const FpVec<Q16, 4> a({ Q16::FromRaw(3), Q16::FromRaw(3), Q16::FromRaw(3), Q16::FromRaw(3) });
+		const FpVec<Q16, 4> b({ Q16(0.25), Q16(0.25), Q16(0.25), Q16(0.25) });
+		CHECK_EQUAL(Dot(a, b).GetRawVal(), 3);
+		CHECK_EQUAL((a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]).GetRawVal(), 0);
+	}
+
+	MTEST(MatrixMultiplyTest) {
+		// Sizes which aren't multiples of the AVX2 tile or the blocks
+		CHECK((MatrixMultiplyMatchesReference<FpF32<16>, int64_t>(7, 5, 3, 16)));
+		CHECK((MatrixMultiplyMatchesReference<FpF32<16>, int64_t>(70, 300, 261, 16)));
+		CHECK((MatrixMultiplyMatchesReference<FpF32<24>, int64_t>(64, 64, 64, 24)));
+		CHECK((MatrixMultiplyMatchesReference<FpF64<32>, Int128>(9, 17, 10, 32)));
+
+		// Matches the fixed-size product
+		typedef FpMatrix<FpF32<16>, 3, 3> Matrix;
+		const Matrix a({ FpF32<16>(0.1), FpF32<16>(-2.5), FpF32<16>(3.0), FpF32<16>(1.25), FpF32<16>(0.0),
+						 FpF32<16>(-7.0), FpF32<16>(0.3), FpF32<16>(0.7), FpF32<16>(1.1) });
+		const Matrix product = a * a;
+		Matrix out;
+		MatrixMultiply(a.Data(), a.Data(), out.Data(), 3, 3, 3);
+		CHECK((out == product));
+	}
+}
@@ -0,0 +1,106 @@
+//!
+//! \file 				FpQTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-17
+//! \last-modified		2026-10-17
+//! \brief 				Performs unit tests on the FpQ class.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cstdlib>
+#include <type_traits>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpQ.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpQTests) {
+
+	MTEST(FormatsTest) {
+		const FpQ<8, 8> a(1.5);
+		const FpQ<4, 12> b(-0.25);
+		CHECK((std::is_same<decltype(a * b), FpQ<12, 20>>::value));
+		CHECK((std::is_same<decltype(a + b), FpQ<9, 12>>::value));
+		CHECK((std::is_same<decltype(a - b), FpQ<9, 12>>::value));
+		CHECK((std::is_same<decltype(-a), FpQ<9, 8>>::value));
+		CHECK((std::is_same<FpQ<8, 0>::BaseType, int8_t>::value));
+		CHECK((std::is_same<FpQ<8, 8>::BaseType, int16_t>::value));
+		CHECK((std::is_same<FpQ<12, 20>::BaseType, int32_t>::value));
+		CHECK((std::is_same<FpQ<9, 24>::BaseType, int64_t>::value));
+		CHECK_EQUAL(sizeof(FpQ<4, 12>), 2u);
+	}
+
+	MTEST(ArithmeticTest) {
+		const FpQ<8, 8> a(1.5);
+		const FpQ<4, 12> b(-0.25);
+		CHECK_EQUAL((a * b).ToDouble(), -0.375);
+		CHECK_EQUAL((a + b).ToDouble(), 1.25);
+		CHECK_EQUAL((a - b).ToDouble(), 1.75);
+		CHECK_EQUAL((b - a).ToDouble(), -1.75);
+		CHECK_EQUAL((-a).ToDouble(), -1.5);
+		CHECK_EQUAL(((a + b) * (a - b)).ToDouble(), 1.25 * 1.75);
+		CHECK_EQUAL((FpQ<16, 0>(-7).ToInt<int>()), -7);
+		CHECK_EQUAL((FpQ<16, 4>(-7.5).ToInt<int>()), -8);
+	}
+
+	MTEST(NoOverflowTest) {
+		// The extreme values of each format, which would overflow FpF arithmetic
+		const FpQ<8, 8> min = FpQ<8, 8>::FromRaw(INT16_MIN), max = FpQ<8, 8>::FromRaw(INT16_MAX);
+		const FpQ<4, 12> minB = FpQ<4, 12>::FromRaw(INT16_MIN);
+		CHECK_EQUAL((min * minB).ToDouble(), -128.0 * -8.0);
+		CHECK_EQUAL((min * min).ToDouble(), 16384.0);
+		CHECK_EQUAL((max + max).ToDouble(), 2.0 * INT16_MAX / 256.0);
+		CHECK_EQUAL((min - max).ToDouble(), (INT16_MIN - INT16_MAX) / 256.0);
+		CHECK_EQUAL((-min).ToDouble(), 128.0);
+
+		std::srand(1);
+		bool passed = true;
+		for(int i = 0; i < 1000; i++) {
+			const FpQ<12, 20> x = FpQ<12, 20>::FromRaw((int32_t) ((uint64_t) std::rand() * 2654435761u));
+			const FpQ<3, 13> y = FpQ<3, 13>::FromRaw((int16_t) std::rand());
+			passed &= (x * y).ToDouble() == x.ToDouble() * y.ToDouble();
+			passed &= (x - y).ToDouble() == x.ToDouble() - y.ToDouble();
+		}
+		CHECK(passed);
+	}
+
+	MTEST(ConversionTest) {
+		// Widening conversions are implicit and exact
+		const FpQ<4, 12> a(-2.75);
+		const FpQ<16, 16> wide = a;
+		CHECK_EQUAL(wide.ToDouble(), -2.75);
+		CHECK((std::is_convertible<FpQ<4, 12>, FpQ<8, 12>>::value));
+		// Narrowing conversions are explicit, and truncate towards negative infinity
+		CHECK((!std::is_convertible<FpQ<8, 8>, FpQ<8, 4>>::value));
+		CHECK_EQUAL((FpQ<8, 4>(FpQ<8, 8>(-1.0 / 256.0))).ToDouble(), -1.0 / 16.0);
+		CHECK_EQUAL((FpQ<8, 4>(FpQ<8, 8>(2.5))).ToDouble(), 2.5);
+		// Products can be narrowed back to the format of the inputs
+		const FpQ<8, 8> x(3.0), y(-1.25);
+		CHECK_EQUAL((FpQ<8, 8>(x * y).ToDouble()), -3.75);
+	}
+
+	MTEST(ComparisonTest) {
+		CHECK((FpQ<8, 8>(1.5) == FpQ<4, 12>(1.5)));
+		CHECK((FpQ<8, 8>(1.5) != FpQ<4, 12>(1.25)));
+		CHECK((FpQ<8, 8>(-100.0) < FpQ<4, 12>(-7.0)));
+		CHECK((FpQ<4, 12>(0.25) > FpQ<16, 0>(0)));
+		CHECK((FpQ<4, 12>(0.25) <= FpQ<4, 12>(0.25)));
+		CHECK((FpQ<32, 0>(-5) < FpQ<2, 30>(-1.5)));
+		CHECK((FpQ<2, 30>(-1.5) >= FpQ<32, 0>(-5)));
+	}
+
+	MTEST(ConstexprTest) {
+		constexpr FpQ<8, 8> a(1.5);
+		constexpr FpQ<4, 12> b(-0.25);
+		constexpr auto result = a * b + a;
+		static_assert(result == FpQ<8, 8>(1.125), "expression should be evaluated at compile time");
+		static_assert(std::is_same<decltype(result), const FpQ<13, 20>>::value, "wrong result format");
+		CHECK_EQUAL(result.ToDouble(), 1.125);
+	}
+}
@@ -98,6 +98,21 @@ MTEST_GROUP(FpSArithmeticTests) {
 		CHECK_CLOSE(fp3.ToDouble(), 40.0, 0.1);		
 	}
 
+	MTEST(FpS64FullPrecisionMultiplication) {
+		// Raw product is approx. 2^77, which overflows an int64_t intermediary
+		FpS64 fp1(30000.5, 32);
+		FpS64 fp2(-1000.25, 32);
+		auto fp3 = fp1 * fp2;
+		CHECK_CLOSE(fp3.ToDouble(), 30000.5 * -1000.25, 1e-6);
+	}
+
+	MTEST(FpS64FullPrecisionDivision) {
+		FpS64 fp1(30000.5, 32);
+		FpS64 fp2(-0.125, 32);
+		auto fp3 = fp1 / fp2;
+		CHECK_CLOSE(fp3.ToDouble(), -240004.0, 1e-6);
+	}
+
 	MTEST(PositiveDivisionTest)	{
 		FpS32 fp1(3.2, 12);
 		FpS32 fp2(0.6, 12);		
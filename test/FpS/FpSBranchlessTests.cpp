@@ -0,0 +1,62 @@
+//!
+//! \file 				FpSBranchlessTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Checks the branching and branchless FpS operand alignment give the same results.
+//! \details
+//!		See README.rst in root dir for more info.
+
+// System includes
+#include <stdint.h>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpS.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpSBranchlessTests) {
+
+	MTEST(AlignmentMatchesBranchingTest) {
+		const int32_t rawVals[] = { 0, 1, -1, 12345, -12345, INT32_MAX, INT32_MIN };
+		for(int32_t lRaw : rawVals) {
+			for(int32_t rRaw : rawVals) {
+				for(uint8_t lNumFracBits = 0; lNumFracBits < 32; lNumFracBits += 3) {
+					for(uint8_t rNumFracBits = 0; rNumFracBits < 32; rNumFracBits += 5) {
+						int32_t lBranching = lRaw, rBranching = rRaw;
+						int32_t lBranchless = lRaw, rBranchless = rRaw;
+						const uint8_t branching = detail::FpSAlign<false>::Align(lBranching, lNumFracBits, rBranching, rNumFracBits);
+						const uint8_t branchless = detail::FpSAlign<true>::Align(lBranchless, lNumFracBits, rBranchless, rNumFracBits);
+						CHECK_EQUAL(branching, branchless);
+						CHECK_EQUAL(lBranching, lBranchless);
+						CHECK_EQUAL(rBranching, rBranchless);
+					}
+				}
+			}
+		}
+	}
+
+	MTEST(AlignsToLowestNumFracBitsTest) {
+		int64_t lRaw = (int64_t)3 << 20;
+		int64_t rRaw = (int64_t)-5 * 16;
+		CHECK_EQUAL(detail::FpSAlign<true>::Align(lRaw, 20, rRaw, 4), 4);
+		CHECK_EQUAL(lRaw, (int64_t)3 << 4);
+		CHECK_EQUAL(rRaw, (int64_t)-5 * 16);
+	}
+
+	MTEST(MixedPrecisionOperatorsTest) {
+		FpS32 a(3.25, 12);
+		FpS32 b(-1.5, 6);
+		CHECK_CLOSE((a + b).ToDouble(), 1.75, 0.001);
+		CHECK_EQUAL((a + b).GetNumFracBits(), 6);
+		CHECK_CLOSE((b * a).ToDouble(), -4.875, 0.001);
+		CHECK_CLOSE((a / b).ToDouble(), -2.1667, 0.02);
+		CHECK(b < a);
+		CHECK(a >= b);
+		CHECK(FpS32(2.5, 16) == FpS32(2.5, 3));
+	}
+}
@@ -28,6 +28,14 @@ MTEST_GROUP(FpSTests) {
 		CHECK_CLOSE(fp1.ToInt<int64_t>(), 75, 0.1);		
 	}
 
+	MTEST(CreateFromRawFpS64) {
+		// More fractional bits than an int has bits
+		FpS64 fp1 = FpS64::FromRaw(-((int64_t) 3 << 39), 40);
+		CHECK_EQUAL(fp1.GetNumFracBits(), 40);
+		CHECK_EQUAL(fp1.ToDouble(), -1.5);
+		CHECK_EQUAL(FpS64::FromRaw(INT64_MAX, 63).GetRawVal(), INT64_MAX);
+	}
+
 	MTEST(CreateFromFloat)	{
 		FpS32 fp1(34.2f, 8);		
         CHECK_EQUAL(fp1.GetRawVal(), (int32_t)(34.2f * (1 << 8)));
@@ -0,0 +1,56 @@
+//!
+//! \file 				FpSMathTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the FpS math functions.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// System includes
+#include <cmath>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpSMath.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpSMathTests) {
+
+	MTEST(Sqrt) {
+		FpS32 x(2.0, 16);
+		FpS32 root = Sqrt(x);
+		CHECK_EQUAL(root.GetNumFracBits(), 16);
+		CHECK_CLOSE(root.ToDouble(), std::sqrt(2.0), 1.0/65536);
+		CHECK_EQUAL(Sqrt(FpS32(9.0, 8)).ToDouble(), 3.0);
+		CHECK_EQUAL(Sqrt(FpS32(-1.0, 8)).GetRawVal(), 0);
+		CHECK_CLOSE(Sqrt(FpS16(2.0, 12)).ToDouble(), std::sqrt(2.0), 1.0/4096);
+		CHECK_CLOSE(Sqrt(FpS64(2.0, 40)).ToDouble(), std::sqrt(2.0), 1e-11);
+	}
+
+	MTEST(RSqrt) {
+		FpS32 x(4.0, 10);
+		FpS32 rRoot = RSqrt(x);
+		CHECK_EQUAL(rRoot.GetNumFracBits(), 10);
+		CHECK_EQUAL(rRoot.ToDouble(), 0.5);
+		CHECK_CLOSE(RSqrt(FpS32(3.0, 20)).ToDouble(), 1.0/std::sqrt(3.0), 2.0/(1 << 20));
+		CHECK_CLOSE(RSqrt(FpS16(0.5, 12)).ToDouble(), 1.0/std::sqrt(0.5), 2.0/4096);
+		CHECK_CLOSE(RSqrt(FpS64(7.0, 40)).ToDouble(), 1.0/std::sqrt(7.0), 1e-11);
+	}
+
+	MTEST(ArraySqrtAndRSqrt) {
+		FpS32 a[3] = { FpS32(1.0, 12), FpS32(4.0, 12), FpS32(9.0, 12) };
+		FpS32 roots[3] = { FpS32(0, 12), FpS32(0, 12), FpS32(0, 12) };
+		FpS32 rRoots[3] = { FpS32(0, 12), FpS32(0, 12), FpS32(0, 12) };
+		ArraySqrt(a, roots, 3);
+		ArrayRSqrt(a, rRoots, 3);
+		for(int i = 0; i < 3; i++) {
+			CHECK_EQUAL(roots[i].ToDouble(), (double) (i + 1));
+			CHECK_CLOSE(rRoots[i].ToDouble(), 1.0/(i + 1), 2.0/4096);
+		}
+	}
+}
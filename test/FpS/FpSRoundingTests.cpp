@@ -0,0 +1,69 @@
+//!
+//! \file 				FpSRoundingTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the FpS rounding mode functions.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/Rounding.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpSRoundingTests) {
+
+	MTEST(AddAndSubtractRealignment) {
+		// 2.5 with 1 fractional bit, realigned to 0 fractional bits
+		FpS32 a = FpS32::FromRaw(5, 1);
+		FpS32 b(0, 0);
+		CHECK_EQUAL(Add<RoundingMode::Truncate>(a, b).GetRawVal(), (a + b).GetRawVal());
+		CHECK_EQUAL(Add<RoundingMode::HalfUp>(a, b).GetRawVal(), 3);
+		CHECK_EQUAL(Add<RoundingMode::HalfEven>(a, b).GetRawVal(), 2);
+		CHECK_EQUAL(Add<RoundingMode::HalfEven>(b, a).GetNumFracBits(), 0);
+		CHECK_EQUAL(Subtract<RoundingMode::HalfUp>(b, a).GetRawVal(), -3);
+		CHECK_EQUAL(Subtract<RoundingMode::HalfEven>(b, a).GetRawVal(), -2);
+	}
+
+	MTEST(Multiply) {
+		FpS32 a = FpS32::FromRaw(5, 1);
+		FpS32 one(1, 0);
+		CHECK_EQUAL(Multiply<RoundingMode::Truncate>(a, one).GetRawVal(), 2);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfUp>(a, one).GetRawVal(), 3);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfEven>(one, a).GetRawVal(), 2);
+		CHECK_EQUAL(Multiply<RoundingMode::HalfEven>(one, a).GetNumFracBits(), 0);
+		FpS32 b(1.37, 12);
+		FpS32 c(-2.91, 12);
+		CHECK_EQUAL(Multiply<RoundingMode::Truncate>(b, c).GetRawVal(), (b * c).GetRawVal());
+		CHECK_CLOSE(Multiply<RoundingMode::HalfEven>(FpS64(1.37, 40), FpS64(-2.91, 20)).ToDouble(), 1.37 * -2.91, 1e-6);
+	}
+
+	MTEST(Divide) {
+		CHECK_EQUAL(Divide<RoundingMode::Truncate>(FpS32(5, 0), FpS32(2, 0)).GetRawVal(), 2);
+		CHECK_EQUAL(Divide<RoundingMode::HalfUp>(FpS32(5, 0), FpS32(2, 0)).GetRawVal(), 3);
+		CHECK_EQUAL(Divide<RoundingMode::HalfEven>(FpS32(-7, 0), FpS32(2, 0)).GetRawVal(), -4);
+		// Different num. frac bits
+		FpS32 d = Divide<RoundingMode::HalfEven>(FpS32(3.0, 8), FpS32(1.5, 12));
+		CHECK_EQUAL(d.GetNumFracBits(), 8);
+		CHECK_EQUAL(d.ToDouble(), 2.0);
+		CHECK_CLOSE(Divide<RoundingMode::HalfUp>(FpS32(1.0, 12), FpS32(3.0, 8)).ToDouble(), 1.0/3.0, 1.0/256);
+	}
+
+	MTEST(ConvertTo) {
+		// 2.5 LSBs of a number with no fractional bits
+		FpS32 a = FpS32::FromRaw(0x280, 8);
+		FpS16 b = ConvertTo<FpS16, RoundingMode::HalfEven>(a, 0);
+		CHECK_EQUAL(b.GetRawVal(), 2);
+		CHECK_EQUAL(b.GetNumFracBits(), 0);
+		CHECK_EQUAL((ConvertTo<FpS16, RoundingMode::HalfUp>(a, 0).GetRawVal()), 3);
+		CHECK_EQUAL(ConvertTo<FpS32>(a, 12).ToDouble(), 2.5);
+		// Widening to a type with a wider OverflowType
+		CHECK_EQUAL(ConvertTo<FpS64>(FpS16(1.5, 8), 40).ToDouble(), 1.5);
+		CHECK_EQUAL((ConvertTo<FpS64, RoundingMode::HalfEven>(FpS16(-100.25, 8), 56).ToDouble()), -100.25);
+	}
+}
@@ -0,0 +1,77 @@
+//!
+//! \file 				FpSSatTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the saturating FpSSat class.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpSSat.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpSSatTests) {
+
+	MTEST(ArithmeticInRangeMatchesFpS) {
+		FpSSat32 a(3.5, 12);
+		FpSSat32 b(-1.25, 8);
+		FpSSat32 c = a + b;
+		CHECK_EQUAL(c.GetNumFracBits(), 8);
+		CHECK_EQUAL(c.ToDouble(), 2.25);
+		CHECK_EQUAL((a - b).ToDouble(), 4.75);
+		CHECK_EQUAL((a * b).ToDouble(), -4.375);
+		CHECK_EQUAL((a * b).GetRawVal(), (FpS32(3.5, 12) * FpS32(-1.25, 8)).GetRawVal());
+		CHECK_CLOSE((a / b).ToDouble(), -2.8, 1.0/256);
+	}
+
+	MTEST(ArithmeticSaturates) {
+		FpSSat32 a(30000.0, 16);
+		CHECK_EQUAL((a + a).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((-a - a).GetRawVal(), INT32_MIN);
+		CHECK_EQUAL((a * a).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((a / FpSSat32(0.001, 16)).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((a / FpSSat32(0, 16)).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((a << 2).GetRawVal(), INT32_MAX);
+		CHECK_EQUAL((a >> 2).ToDouble(), 7500.0);
+		CHECK_EQUAL((-FpSSat32::FromRaw(INT32_MIN, 16)).GetRawVal(), INT32_MAX);
+		// Different num. frac bits, result has 7 frac bits (a range of +-256)
+		FpSSat16 b(100.0, 8);
+		FpSSat16 c(200.0, 7);
+		CHECK_EQUAL((b + c).GetRawVal(), INT16_MAX);
+	}
+
+	MTEST(CreateFromRaw64) {
+		FpSSat64 a = FpSSat64::FromRaw(-((int64_t) 3 << 39), 40);
+		CHECK_EQUAL(a.GetNumFracBits(), 40);
+		CHECK_EQUAL(a.ToDouble(), -1.5);
+	}
+
+	MTEST(ConstructorsSaturate) {
+		CHECK_EQUAL(FpSSat16(1000.0, 8).GetRawVal(), INT16_MAX);
+		CHECK_EQUAL(FpSSat16(-1000, 8).GetRawVal(), INT16_MIN);
+	}
+
+	MTEST(Comparisons) {
+		FpSSat32 a(1.5, 8);
+		FpSSat32 b(1.5, 16);
+		FpSSat32 c(2.0, 4);
+		CHECK(a == b);
+		CHECK(a < c);
+		CHECK(c > b);
+		CHECK(a <= b);
+		CHECK(c != a);
+	}
+
+	MTEST(ConversionToAndFromFpS) {
+		FpS32 a(1.5, 10);
+		FpSSat32 b(a);
+		CHECK_EQUAL(b.GetNumFracBits(), 10);
+		CHECK_EQUAL(b.ToFpS().GetRawVal(), a.GetRawVal());
+	}
+}
@@ -0,0 +1,102 @@
+//!
+//! \file 				FpSVectorTests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Unit tests for FpSVector.
+//! \details
+//!		See README.rst in root dir for more info.
+
+// System includes
+#include <stdint.h>
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/FpSVector.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(FpSVectorTests) {
+
+	MTEST(ElementAccessTest) {
+		FpSVector32 v(3, 8);
+		CHECK_EQUAL(v.size(), 3u);
+		CHECK_EQUAL(v.GetNumFracBits(), 8);
+		v[0] = FpS32(1.5, 8);
+		v[1] = FpS32(-2.25, 16);	// Converted to 8 fractional bits
+		v[2] = v[0];
+		v[2] += FpS32(0.5, 8);
+		CHECK_CLOSE(v[0].ToDouble(), 1.5, 0.001);
+		CHECK_EQUAL(v[1].GetRawVal(), -576);
+		CHECK_EQUAL(v[1].GetNumFracBits(), 8);
+		CHECK_CLOSE(((FpS32) v[2]).ToDouble(), 2.0, 0.001);
+		const FpSVector32& cv = v;
+		CHECK_CLOSE(cv[1].ToDouble(), -2.25, 0.001);
+		v.push_back(FpS32(4.0, 4));
+		CHECK_EQUAL(v.size(), 4u);
+		CHECK_EQUAL(v.data()[3], 4 << 8);
+	}
+
+	MTEST(SetNumFracBitsTest) {
+		FpSVector32 v(2, FpS32(3.75, 10));
+		v.SetNumFracBits(4);
+		CHECK_EQUAL(v.GetNumFracBits(), 4);
+		CHECK_CLOSE(v[0].ToDouble(), 3.75, 0.001);
+		v.SetNumFracBits(20);
+		CHECK_CLOSE(v[1].ToDouble(), 3.75, 0.001);
+	}
+
+	MTEST(SamePrecisionArithmeticTest) {
+		FpSVector32 a(0, 12), b(0, 12);
+		for(int i = 0; i < 37; i++) {
+			a.push_back(FpS32(i * 0.5, 12));
+			b.push_back(FpS32(-i * 0.25, 12));
+		}
+		FpSVector32 sum = a + b;
+		FpSVector32 diff = a - b;
+		FpSVector32 prod = a * b;
+		FpSVector32 scaled = a * FpS32(2.0, 12);
+		for(int i = 0; i < 37; i++) {
+			CHECK_CLOSE(sum[i].ToDouble(), i * 0.25, 0.001);
+			CHECK_CLOSE(diff[i].ToDouble(), i * 0.75, 0.001);
+			CHECK_CLOSE(prod[i].ToDouble(), -i * i * 0.125, 0.01);
+			CHECK_CLOSE(scaled[i].ToDouble(), i * 1.0, 0.001);
+		}
+		a.Negate();
+		CHECK_CLOSE(a[36].ToDouble(), -18.0, 0.001);
+	}
+
+	MTEST(MixedPrecisionArithmeticTest) {
+		FpSVector32 a(5, FpS32(1.5, 16));
+		FpSVector32 b(5, FpS32(-0.75, 8));
+		FpSVector32 sum = a + b;
+		CHECK_EQUAL(sum.GetNumFracBits(), 8);
+		CHECK_CLOSE(sum[4].ToDouble(), 0.75, 0.001);
+		FpSVector32 prod = b * a;
+		CHECK_EQUAL(prod.GetNumFracBits(), 8);
+		CHECK_CLOSE(prod[0].ToDouble(), -1.125, 0.01);
+		a *= FpS32(2.0, 4);
+		CHECK_EQUAL(a.GetNumFracBits(), 4);
+		CHECK_CLOSE(a[2].ToDouble(), 3.0, 0.001);
+	}
+
+	MTEST(DotProductTest) {
+		FpSVector16 a(0, 8), b(0, 10);
+		for(int i = 1; i <= 4; i++) {
+			a.push_back(FpS16(i, 8));
+			b.push_back(FpS16(0.5, 10));
+		}
+		FpS16 result = DotProduct(a, b);
+		CHECK_EQUAL(result.GetNumFracBits(), 8);
+		CHECK_CLOSE(result.ToDouble(), 5.0, 0.01);
+	}
+
+	MTEST(SizeTest) {
+		CHECK_EQUAL(sizeof(FpS32), 8u);
+		FpSVector32 v(1000, 16);
+		CHECK_EQUAL((size_t)((const char*)(v.data() + v.size()) - (const char*)v.data()), 4000u);
+	}
+}
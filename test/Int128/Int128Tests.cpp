@@ -0,0 +1,75 @@
+//!
+//! \file 				Int128Tests.cpp
+//! \author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! \edited 			n/a
+//! \created			2026-10-16
+//! \last-modified		2026-10-16
+//! \brief 				Performs unit tests on the emulated 128-bit integer.
+//! \details
+//!						See README.rst in root dir for more info.
+
+// 3rd party includes
+#include "MUnitTest/MUnitTestApi.hpp"
+
+// User includes
+#include "MFixedPoint/Int128.hpp"
+
+using namespace mn::MFixedPoint;
+
+MTEST_GROUP(Int128Tests) {
+
+	MTEST(SignExtension) {
+		Int128Emulated x(-5);
+		CHECK_EQUAL(x.GetHigh(), ~(uint64_t)0);
+		CHECK_EQUAL((int64_t)x, -5);
+	}
+
+	MTEST(FullWidthMultiplication) {
+		// (2^62 + 3) * -(2^62 + 5) = -(2^124 + 2^65 + 15)
+		Int128Emulated a((int64_t)(((uint64_t)1 << 62) + 3));
+		Int128Emulated b(-(int64_t)(((uint64_t)1 << 62) + 5));
+		Int128Emulated expected = -((Int128Emulated(1) << 124) + (Int128Emulated(1) << 65) + Int128Emulated(15));
+		CHECK(a * b == expected);
+	}
+
+	MTEST(Shifts) {
+		Int128Emulated x = Int128Emulated(-3) << 100;
+		CHECK(x < Int128Emulated(0));
+		CHECK_EQUAL((int64_t)(x >> 100), -3);
+		CHECK_EQUAL((int64_t)(x >> 127), -1);
+		CHECK_EQUAL((int64_t)(Int128Emulated(-3) >> 1), -2); // Rounds towards negative infinity
+		CHECK_EQUAL((int64_t)((Int128Emulated(7) << 64) >> 64), 7);
+	}
+
+	MTEST(Division) {
+		Int128Emulated big = (Int128Emulated(123456789) << 70) + Int128Emulated(987654321);
+		CHECK(big / Int128Emulated(123456789) == (Int128Emulated(1) << 70) + Int128Emulated(8));
+		CHECK(big % Int128Emulated(123456789) == Int128Emulated(987654321 - 8 * 123456789));
+		CHECK(-big / Int128Emulated(123456789) == -((Int128Emulated(1) << 70) + Int128Emulated(8)));
+		CHECK(-big % Int128Emulated(123456789) == -Int128Emulated(987654321 - 8 * 123456789));
+		CHECK_EQUAL((int64_t)(Int128Emulated(-7) / Int128Emulated(2)), -3);
+	}
+
+#if defined(__SIZEOF_INT128__)
+	MTEST(MatchesNativeInt128) {
+		__extension__ typedef __int128 Native;
+		__extension__ typedef unsigned __int128 UnsignedNative;
+		const int64_t values[] = { 0, 1, -1, 3, -7, 123456789, -987654321012, INT64_MAX, INT64_MIN + 1 };
+		bool passed = true;
+		for(int64_t a : values) {
+			for(int64_t b : values) {
+				Int128Emulated product = Int128Emulated(a) * Int128Emulated(b);
+				Native nativeProduct = (Native)a * b;
+				passed &= product.GetLow() == (uint64_t)nativeProduct;
+				passed &= product.GetHigh() == (uint64_t)(nativeProduct >> 64);
+				if(b != 0) {
+					Int128Emulated quotient = (product << 3) / Int128Emulated(b);
+					// Multiply as unsigned, so INT64_MAX^2 * 8 wraps-around like the emulated shift
+					passed &= quotient.GetLow() == (uint64_t)((Native)((UnsignedNative)nativeProduct * 8) / b);
+				}
+			}
+		}
+		CHECK(passed);
+	}
+#endif
+}